@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/book_snapshot_tests.dir/tests/book_snapshot_tests.cpp.o"
+  "CMakeFiles/book_snapshot_tests.dir/tests/book_snapshot_tests.cpp.o.d"
+  "book_snapshot_tests"
+  "book_snapshot_tests.pdb"
+  "book_snapshot_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/book_snapshot_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/bybit_book_sync_tests.cpp" "CMakeFiles/bybit_book_sync_tests.dir/tests/bybit_book_sync_tests.cpp.o" "gcc" "CMakeFiles/bybit_book_sync_tests.dir/tests/bybit_book_sync_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/CMakeFiles/trading_exchanges.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/_deps/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/CMakeFiles/trading_core.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/_deps/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
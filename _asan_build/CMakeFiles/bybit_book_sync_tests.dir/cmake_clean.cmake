@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bybit_book_sync_tests.dir/tests/bybit_book_sync_tests.cpp.o"
+  "CMakeFiles/bybit_book_sync_tests.dir/tests/bybit_book_sync_tests.cpp.o.d"
+  "bybit_book_sync_tests"
+  "bybit_book_sync_tests.pdb"
+  "bybit_book_sync_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bybit_book_sync_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
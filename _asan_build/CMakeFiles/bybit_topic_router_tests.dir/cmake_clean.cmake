@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bybit_topic_router_tests.dir/tests/bybit_topic_router_tests.cpp.o"
+  "CMakeFiles/bybit_topic_router_tests.dir/tests/bybit_topic_router_tests.cpp.o.d"
+  "bybit_topic_router_tests"
+  "bybit_topic_router_tests.pdb"
+  "bybit_topic_router_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bybit_topic_router_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bybit_ws_parser_tests.dir/tests/bybit_ws_parser_tests.cpp.o"
+  "CMakeFiles/bybit_ws_parser_tests.dir/tests/bybit_ws_parser_tests.cpp.o.d"
+  "bybit_ws_parser_tests"
+  "bybit_ws_parser_tests.pdb"
+  "bybit_ws_parser_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bybit_ws_parser_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/depth_feed_tests.dir/tests/depth_feed_tests.cpp.o"
+  "CMakeFiles/depth_feed_tests.dir/tests/depth_feed_tests.cpp.o.d"
+  "depth_feed_tests"
+  "depth_feed_tests.pdb"
+  "depth_feed_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/depth_feed_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/event_csv_tests.dir/tests/event_csv_tests.cpp.o"
+  "CMakeFiles/event_csv_tests.dir/tests/event_csv_tests.cpp.o.d"
+  "event_csv_tests"
+  "event_csv_tests.pdb"
+  "event_csv_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/event_csv_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
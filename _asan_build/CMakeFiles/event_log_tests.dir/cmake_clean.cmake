@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/event_log_tests.dir/tests/event_log_tests.cpp.o"
+  "CMakeFiles/event_log_tests.dir/tests/event_log_tests.cpp.o.d"
+  "event_log_tests"
+  "event_log_tests.pdb"
+  "event_log_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/event_log_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
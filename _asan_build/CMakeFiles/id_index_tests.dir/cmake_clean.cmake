@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/id_index_tests.dir/tests/id_index_tests.cpp.o"
+  "CMakeFiles/id_index_tests.dir/tests/id_index_tests.cpp.o.d"
+  "id_index_tests"
+  "id_index_tests.pdb"
+  "id_index_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/id_index_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
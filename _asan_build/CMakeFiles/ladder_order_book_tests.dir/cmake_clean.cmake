@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ladder_order_book_tests.dir/tests/ladder_order_book_tests.cpp.o"
+  "CMakeFiles/ladder_order_book_tests.dir/tests/ladder_order_book_tests.cpp.o.d"
+  "ladder_order_book_tests"
+  "ladder_order_book_tests.pdb"
+  "ladder_order_book_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ladder_order_book_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
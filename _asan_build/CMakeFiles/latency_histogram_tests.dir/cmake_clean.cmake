@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/latency_histogram_tests.dir/tests/latency_histogram_tests.cpp.o"
+  "CMakeFiles/latency_histogram_tests.dir/tests/latency_histogram_tests.cpp.o.d"
+  "latency_histogram_tests"
+  "latency_histogram_tests.pdb"
+  "latency_histogram_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/latency_histogram_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
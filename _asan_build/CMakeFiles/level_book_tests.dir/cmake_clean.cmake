@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/level_book_tests.dir/tests/level_book_tests.cpp.o"
+  "CMakeFiles/level_book_tests.dir/tests/level_book_tests.cpp.o.d"
+  "level_book_tests"
+  "level_book_tests.pdb"
+  "level_book_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/level_book_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
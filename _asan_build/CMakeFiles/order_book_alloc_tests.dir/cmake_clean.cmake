@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/order_book_alloc_tests.dir/tests/order_book_alloc_tests.cpp.o"
+  "CMakeFiles/order_book_alloc_tests.dir/tests/order_book_alloc_tests.cpp.o.d"
+  "order_book_alloc_tests"
+  "order_book_alloc_tests.pdb"
+  "order_book_alloc_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/order_book_alloc_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
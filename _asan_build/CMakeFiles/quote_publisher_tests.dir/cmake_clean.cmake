@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/quote_publisher_tests.dir/tests/quote_publisher_tests.cpp.o"
+  "CMakeFiles/quote_publisher_tests.dir/tests/quote_publisher_tests.cpp.o.d"
+  "quote_publisher_tests"
+  "quote_publisher_tests.pdb"
+  "quote_publisher_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/quote_publisher_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
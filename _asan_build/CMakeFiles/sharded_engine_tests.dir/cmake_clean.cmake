@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sharded_engine_tests.dir/tests/sharded_engine_tests.cpp.o"
+  "CMakeFiles/sharded_engine_tests.dir/tests/sharded_engine_tests.cpp.o.d"
+  "sharded_engine_tests"
+  "sharded_engine_tests.pdb"
+  "sharded_engine_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sharded_engine_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm_ring_tests.dir/tests/shm_ring_tests.cpp.o"
+  "CMakeFiles/shm_ring_tests.dir/tests/shm_ring_tests.cpp.o.d"
+  "shm_ring_tests"
+  "shm_ring_tests.pdb"
+  "shm_ring_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm_ring_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simd_kernels_tests.dir/tests/simd_kernels_tests.cpp.o"
+  "CMakeFiles/simd_kernels_tests.dir/tests/simd_kernels_tests.cpp.o.d"
+  "simd_kernels_tests"
+  "simd_kernels_tests.pdb"
+  "simd_kernels_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simd_kernels_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
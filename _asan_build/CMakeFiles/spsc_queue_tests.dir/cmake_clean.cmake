@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/spsc_queue_tests.dir/tests/spsc_queue_tests.cpp.o"
+  "CMakeFiles/spsc_queue_tests.dir/tests/spsc_queue_tests.cpp.o.d"
+  "spsc_queue_tests"
+  "spsc_queue_tests.pdb"
+  "spsc_queue_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spsc_queue_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_bench_csv_parse.dir/app/bench_csv_parse_main.cpp.o"
+  "CMakeFiles/trading_bench_csv_parse.dir/app/bench_csv_parse_main.cpp.o.d"
+  "trading_bench_csv_parse"
+  "trading_bench_csv_parse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_bench_csv_parse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_bench_order_book.dir/app/bench_order_book_main.cpp.o"
+  "CMakeFiles/trading_bench_order_book.dir/app/bench_order_book_main.cpp.o.d"
+  "trading_bench_order_book"
+  "trading_bench_order_book.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_bench_order_book.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
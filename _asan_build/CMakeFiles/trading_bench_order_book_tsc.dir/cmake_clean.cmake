@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_bench_order_book_tsc.dir/app/bench_order_book_tsc_main.cpp.o"
+  "CMakeFiles/trading_bench_order_book_tsc.dir/app/bench_order_book_tsc_main.cpp.o.d"
+  "trading_bench_order_book_tsc"
+  "trading_bench_order_book_tsc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_bench_order_book_tsc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_bench_scenarios.dir/app/bench_scenarios_main.cpp.o"
+  "CMakeFiles/trading_bench_scenarios.dir/app/bench_scenarios_main.cpp.o.d"
+  "trading_bench_scenarios"
+  "trading_bench_scenarios.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_bench_scenarios.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_bench_simd_kernels.dir/app/bench_simd_kernels_main.cpp.o"
+  "CMakeFiles/trading_bench_simd_kernels.dir/app/bench_simd_kernels_main.cpp.o.d"
+  "trading_bench_simd_kernels"
+  "trading_bench_simd_kernels.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_bench_simd_kernels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
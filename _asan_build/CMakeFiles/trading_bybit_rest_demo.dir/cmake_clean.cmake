@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_bybit_rest_demo.dir/app/bybit_rest_demo_main.cpp.o"
+  "CMakeFiles/trading_bybit_rest_demo.dir/app/bybit_rest_demo_main.cpp.o.d"
+  "trading_bybit_rest_demo"
+  "trading_bybit_rest_demo.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_bybit_rest_demo.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_bybit_ws_orderbook_live.dir/app/bybit_ws_orderbook_live_main.cpp.o"
+  "CMakeFiles/trading_bybit_ws_orderbook_live.dir/app/bybit_ws_orderbook_live_main.cpp.o.d"
+  "trading_bybit_ws_orderbook_live"
+  "trading_bybit_ws_orderbook_live.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_bybit_ws_orderbook_live.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
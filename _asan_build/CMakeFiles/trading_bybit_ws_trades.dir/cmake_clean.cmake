@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_bybit_ws_trades.dir/app/bybit_ws_trades_main.cpp.o"
+  "CMakeFiles/trading_bybit_ws_trades.dir/app/bybit_ws_trades_main.cpp.o.d"
+  "trading_bybit_ws_trades"
+  "trading_bybit_ws_trades.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_bybit_ws_trades.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
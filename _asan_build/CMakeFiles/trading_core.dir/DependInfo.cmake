@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/book_snapshot.cpp" "CMakeFiles/trading_core.dir/src/book_snapshot.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/book_snapshot.cpp.o.d"
+  "/root/repo/src/depth_feed.cpp" "CMakeFiles/trading_core.dir/src/depth_feed.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/depth_feed.cpp.o.d"
+  "/root/repo/src/event_csv.cpp" "CMakeFiles/trading_core.dir/src/event_csv.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/event_csv.cpp.o.d"
+  "/root/repo/src/event_log.cpp" "CMakeFiles/trading_core.dir/src/event_log.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/event_log.cpp.o.d"
+  "/root/repo/src/level_book.cpp" "CMakeFiles/trading_core.dir/src/level_book.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/level_book.cpp.o.d"
+  "/root/repo/src/order_book.cpp" "CMakeFiles/trading_core.dir/src/order_book.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/order_book.cpp.o.d"
+  "/root/repo/src/sharded_engine.cpp" "CMakeFiles/trading_core.dir/src/sharded_engine.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/sharded_engine.cpp.o.d"
+  "/root/repo/src/utils/line_reader.cpp" "CMakeFiles/trading_core.dir/src/utils/line_reader.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/utils/line_reader.cpp.o.d"
+  "/root/repo/src/utils/shm_ring.cpp" "CMakeFiles/trading_core.dir/src/utils/shm_ring.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/utils/shm_ring.cpp.o.d"
+  "/root/repo/src/utils/simd_kernels.cpp" "CMakeFiles/trading_core.dir/src/utils/simd_kernels.cpp.o" "gcc" "CMakeFiles/trading_core.dir/src/utils/simd_kernels.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,29 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_core.dir/src/book_snapshot.cpp.o"
+  "CMakeFiles/trading_core.dir/src/book_snapshot.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/depth_feed.cpp.o"
+  "CMakeFiles/trading_core.dir/src/depth_feed.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/event_csv.cpp.o"
+  "CMakeFiles/trading_core.dir/src/event_csv.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/event_log.cpp.o"
+  "CMakeFiles/trading_core.dir/src/event_log.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/level_book.cpp.o"
+  "CMakeFiles/trading_core.dir/src/level_book.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/order_book.cpp.o"
+  "CMakeFiles/trading_core.dir/src/order_book.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/sharded_engine.cpp.o"
+  "CMakeFiles/trading_core.dir/src/sharded_engine.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/utils/line_reader.cpp.o"
+  "CMakeFiles/trading_core.dir/src/utils/line_reader.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/utils/shm_ring.cpp.o"
+  "CMakeFiles/trading_core.dir/src/utils/shm_ring.cpp.o.d"
+  "CMakeFiles/trading_core.dir/src/utils/simd_kernels.cpp.o"
+  "CMakeFiles/trading_core.dir/src/utils/simd_kernels.cpp.o.d"
+  "libtrading_core.a"
+  "libtrading_core.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
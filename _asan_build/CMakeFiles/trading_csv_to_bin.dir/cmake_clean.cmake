@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_csv_to_bin.dir/app/csv_to_bin_main.cpp.o"
+  "CMakeFiles/trading_csv_to_bin.dir/app/csv_to_bin_main.cpp.o.d"
+  "trading_csv_to_bin"
+  "trading_csv_to_bin.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_csv_to_bin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/exchange/bybit_book_sync.cpp" "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_book_sync.cpp.o" "gcc" "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_book_sync.cpp.o.d"
+  "/root/repo/src/exchange/bybit_public_rest.cpp" "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_public_rest.cpp.o" "gcc" "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_public_rest.cpp.o.d"
+  "/root/repo/src/exchange/bybit_public_ws.cpp" "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_public_ws.cpp.o" "gcc" "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_public_ws.cpp.o.d"
+  "/root/repo/src/exchange/bybit_topic_router.cpp" "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_topic_router.cpp.o" "gcc" "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_topic_router.cpp.o.d"
+  "/root/repo/src/utils/http_client.cpp" "CMakeFiles/trading_exchanges.dir/src/utils/http_client.cpp.o" "gcc" "CMakeFiles/trading_exchanges.dir/src/utils/http_client.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/CMakeFiles/trading_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
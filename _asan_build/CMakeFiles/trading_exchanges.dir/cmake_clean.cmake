@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_book_sync.cpp.o"
+  "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_book_sync.cpp.o.d"
+  "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_public_rest.cpp.o"
+  "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_public_rest.cpp.o.d"
+  "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_public_ws.cpp.o"
+  "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_public_ws.cpp.o.d"
+  "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_topic_router.cpp.o"
+  "CMakeFiles/trading_exchanges.dir/src/exchange/bybit_topic_router.cpp.o.d"
+  "CMakeFiles/trading_exchanges.dir/src/utils/http_client.cpp.o"
+  "CMakeFiles/trading_exchanges.dir/src/utils/http_client.cpp.o.d"
+  "libtrading_exchanges.a"
+  "libtrading_exchanges.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_exchanges.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libtrading_exchanges.a"
+)
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_generate.dir/app/generate_events_main.cpp.o"
+  "CMakeFiles/trading_generate.dir/app/generate_events_main.cpp.o.d"
+  "trading_generate"
+  "trading_generate.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
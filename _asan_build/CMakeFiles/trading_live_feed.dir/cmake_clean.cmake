@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_live_feed.dir/app/live_feed_main.cpp.o"
+  "CMakeFiles/trading_live_feed.dir/app/live_feed_main.cpp.o.d"
+  "trading_live_feed"
+  "trading_live_feed.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_live_feed.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
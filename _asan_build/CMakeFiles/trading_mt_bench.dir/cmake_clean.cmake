@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_mt_bench.dir/app/mt_bench_main.cpp.o"
+  "CMakeFiles/trading_mt_bench.dir/app/mt_bench_main.cpp.o.d"
+  "trading_mt_bench"
+  "trading_mt_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_mt_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_replay.dir/app/replay_main.cpp.o"
+  "CMakeFiles/trading_replay.dir/app/replay_main.cpp.o.d"
+  "trading_replay"
+  "trading_replay.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_replay.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/trading_ws_orderbook_snapshot.dir/app/ws_orderbook_snapshot_main.cpp.o"
+  "CMakeFiles/trading_ws_orderbook_snapshot.dir/app/ws_orderbook_snapshot_main.cpp.o.d"
+  "trading_ws_orderbook_snapshot"
+  "trading_ws_orderbook_snapshot.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/trading_ws_orderbook_snapshot.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
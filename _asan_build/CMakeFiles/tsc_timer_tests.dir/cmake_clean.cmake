@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tsc_timer_tests.dir/tests/tsc_timer_tests.cpp.o"
+  "CMakeFiles/tsc_timer_tests.dir/tests/tsc_timer_tests.cpp.o.d"
+  "tsc_timer_tests"
+  "tsc_timer_tests.pdb"
+  "tsc_timer_tests[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tsc_timer_tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_asan_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_asan_build/order_book_basic_tests[1]_include.cmake")
+include("/root/repo/_asan_build/ladder_order_book_tests[1]_include.cmake")
+include("/root/repo/_asan_build/id_index_tests[1]_include.cmake")
+include("/root/repo/_asan_build/order_book_alloc_tests[1]_include.cmake")
+include("/root/repo/_asan_build/level_book_tests[1]_include.cmake")
+include("/root/repo/_asan_build/bybit_ws_parser_tests[1]_include.cmake")
+include("/root/repo/_asan_build/spsc_queue_tests[1]_include.cmake")
+include("/root/repo/_asan_build/sharded_engine_tests[1]_include.cmake")
+include("/root/repo/_asan_build/event_log_tests[1]_include.cmake")
+include("/root/repo/_asan_build/event_csv_tests[1]_include.cmake")
+include("/root/repo/_asan_build/latency_histogram_tests[1]_include.cmake")
+include("/root/repo/_asan_build/trace_tests[1]_include.cmake")
+include("/root/repo/_asan_build/tsc_timer_tests[1]_include.cmake")
+include("/root/repo/_asan_build/depth_feed_tests[1]_include.cmake")
+include("/root/repo/_asan_build/book_snapshot_tests[1]_include.cmake")
+include("/root/repo/_asan_build/bybit_topic_router_tests[1]_include.cmake")
+include("/root/repo/_asan_build/bybit_book_sync_tests[1]_include.cmake")
+include("/root/repo/_asan_build/shm_ring_tests[1]_include.cmake")
+include("/root/repo/_asan_build/quote_publisher_tests[1]_include.cmake")
+include("/root/repo/_asan_build/simd_kernels_tests[1]_include.cmake")
+subdirs("_deps/googletest-build")
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/book_snapshot_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/book_snapshot_tests[1]_tests.cmake")
+else()
+  add_test(book_snapshot_tests_NOT_BUILT book_snapshot_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,15 @@
+add_test([=[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/book_snapshot_tests [==[--gtest_filter=BookSnapshotTest/0.RestoredBookContinuesLikeTheOriginal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/book_snapshot_tests [==[--gtest_filter=BookSnapshotTest/1.RestoredBookContinuesLikeTheOriginal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/book_snapshot_tests [==[--gtest_filter=BookSnapshotTest/2.RestoredBookContinuesLikeTheOriginal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookSnapshot.EmptyBookRoundTrips]=]  /root/repo/_asan_build/book_snapshot_tests [==[--gtest_filter=BookSnapshot.EmptyBookRoundTrips]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookSnapshot.EmptyBookRoundTrips]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookSnapshot.RejectsMalformedImagesAndKeepsTheBook]=]  /root/repo/_asan_build/book_snapshot_tests [==[--gtest_filter=BookSnapshot.RejectsMalformedImagesAndKeepsTheBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookSnapshot.RejectsMalformedImagesAndKeepsTheBook]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookSnapshot.RejectsInconsistentLinksFreeListAndIndex]=]  /root/repo/_asan_build/book_snapshot_tests [==[--gtest_filter=BookSnapshot.RejectsInconsistentLinksFreeListAndIndex]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookSnapshot.RejectsInconsistentLinksFreeListAndIndex]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BookSnapshot.LadderOutOfSpanKeepsTheBook]=]  /root/repo/_asan_build/book_snapshot_tests [==[--gtest_filter=BookSnapshot.LadderOutOfSpanKeepsTheBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BookSnapshot.LadderOutOfSpanKeepsTheBook]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  book_snapshot_tests_TESTS [==[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[BookSnapshotTest.RestoredBookContinuesLikeTheOriginal<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] BookSnapshot.EmptyBookRoundTrips BookSnapshot.RejectsMalformedImagesAndKeepsTheBook BookSnapshot.RejectsInconsistentLinksFreeListAndIndex BookSnapshot.LadderOutOfSpanKeepsTheBook)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/bybit_book_sync_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/bybit_book_sync_tests[1]_tests.cmake")
+else()
+  add_test(bybit_book_sync_tests_NOT_BUILT bybit_book_sync_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,17 @@
+add_test([=[BybitBookSync.AppliesContiguousDeltasAndDropsStaleOnes]=]  /root/repo/_asan_build/bybit_book_sync_tests [==[--gtest_filter=BybitBookSync.AppliesContiguousDeltasAndDropsStaleOnes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitBookSync.AppliesContiguousDeltasAndDropsStaleOnes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitBookSync.GapBuffersUntilWsSnapshotThenReplays]=]  /root/repo/_asan_build/bybit_book_sync_tests [==[--gtest_filter=BybitBookSync.GapBuffersUntilWsSnapshotThenReplays]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitBookSync.GapBuffersUntilWsSnapshotThenReplays]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitBookSync.RestSnapshotBridgesBySequence]=]  /root/repo/_asan_build/bybit_book_sync_tests [==[--gtest_filter=BybitBookSync.RestSnapshotBridgesBySequence]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitBookSync.RestSnapshotBridgesBySequence]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitBookSync.RestSnapshotNewerThanBufferAnchorsOnSeq]=]  /root/repo/_asan_build/bybit_book_sync_tests [==[--gtest_filter=BybitBookSync.RestSnapshotNewerThanBufferAnchorsOnSeq]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitBookSync.RestSnapshotNewerThanBufferAnchorsOnSeq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitBookSync.FullBufferDiscardsOldestDeltas]=]  /root/repo/_asan_build/bybit_book_sync_tests [==[--gtest_filter=BybitBookSync.FullBufferDiscardsOldestDeltas]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitBookSync.FullBufferDiscardsOldestDeltas]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitBookSync.ResetWaitsForTheNextSnapshot]=]  /root/repo/_asan_build/bybit_book_sync_tests [==[--gtest_filter=BybitBookSync.ResetWaitsForTheNextSnapshot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitBookSync.ResetWaitsForTheNextSnapshot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitBookSync.SnapshotFailingHalfwayIsNotLive]=]  /root/repo/_asan_build/bybit_book_sync_tests [==[--gtest_filter=BybitBookSync.SnapshotFailingHalfwayIsNotLive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitBookSync.SnapshotFailingHalfwayIsNotLive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitBookSync.LostDeltaRejectsOlderRestSnapshots]=]  /root/repo/_asan_build/bybit_book_sync_tests [==[--gtest_filter=BybitBookSync.LostDeltaRejectsOlderRestSnapshots]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitBookSync.LostDeltaRejectsOlderRestSnapshots]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  bybit_book_sync_tests_TESTS BybitBookSync.AppliesContiguousDeltasAndDropsStaleOnes BybitBookSync.GapBuffersUntilWsSnapshotThenReplays BybitBookSync.RestSnapshotBridgesBySequence BybitBookSync.RestSnapshotNewerThanBufferAnchorsOnSeq BybitBookSync.FullBufferDiscardsOldestDeltas BybitBookSync.ResetWaitsForTheNextSnapshot BybitBookSync.SnapshotFailingHalfwayIsNotLive BybitBookSync.LostDeltaRejectsOlderRestSnapshots)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/bybit_topic_router_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/bybit_topic_router_tests[1]_tests.cmake")
+else()
+  add_test(bybit_topic_router_tests_NOT_BUILT bybit_topic_router_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,9 @@
+add_test([=[FindBybitTopic.TopicAnywhereAtTopLevel]=]  /root/repo/_asan_build/bybit_topic_router_tests [==[--gtest_filter=FindBybitTopic.TopicAnywhereAtTopLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[FindBybitTopic.TopicAnywhereAtTopLevel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitTopicRouter.RoutesByTopicWithoutCopy]=]  /root/repo/_asan_build/bybit_topic_router_tests [==[--gtest_filter=BybitTopicRouter.RoutesByTopicWithoutCopy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitTopicRouter.RoutesByTopicWithoutCopy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitTopicRouter.ReAddKeepsIdAndReplacesHandler]=]  /root/repo/_asan_build/bybit_topic_router_tests [==[--gtest_filter=BybitTopicRouter.ReAddKeepsIdAndReplacesHandler]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitTopicRouter.ReAddKeepsIdAndReplacesHandler]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitSubscribe.SplitsTopicsIntoRequestsOfTenArgs]=]  /root/repo/_asan_build/bybit_topic_router_tests [==[--gtest_filter=BybitSubscribe.SplitsTopicsIntoRequestsOfTenArgs]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitSubscribe.SplitsTopicsIntoRequestsOfTenArgs]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  bybit_topic_router_tests_TESTS FindBybitTopic.TopicAnywhereAtTopLevel BybitTopicRouter.RoutesByTopicWithoutCopy BybitTopicRouter.ReAddKeepsIdAndReplacesHandler BybitSubscribe.SplitsTopicsIntoRequestsOfTenArgs)
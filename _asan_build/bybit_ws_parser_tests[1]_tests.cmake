@@ -0,0 +1,13 @@
+add_test([=[ParseFixedPoint.ScalesPadsAndRounds]=]  /root/repo/_asan_build/bybit_ws_parser_tests [==[--gtest_filter=ParseFixedPoint.ScalesPadsAndRounds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParseFixedPoint.ScalesPadsAndRounds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ParseFixedPoint.RejectsMalformedAndOverflow]=]  /root/repo/_asan_build/bybit_ws_parser_tests [==[--gtest_filter=ParseFixedPoint.RejectsMalformedAndOverflow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ParseFixedPoint.RejectsMalformedAndOverflow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitWsParser.OrderbookSnapshot]=]  /root/repo/_asan_build/bybit_ws_parser_tests [==[--gtest_filter=BybitWsParser.OrderbookSnapshot]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitWsParser.OrderbookSnapshot]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitWsParser.DeltaWithDataFirstAndWhitespace]=]  /root/repo/_asan_build/bybit_ws_parser_tests [==[--gtest_filter=BybitWsParser.DeltaWithDataFirstAndWhitespace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitWsParser.DeltaWithDataFirstAndWhitespace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitWsParser.PublicTrade]=]  /root/repo/_asan_build/bybit_ws_parser_tests [==[--gtest_filter=BybitWsParser.PublicTrade]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitWsParser.PublicTrade]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[BybitWsParser.ControlUnsupportedAndErrors]=]  /root/repo/_asan_build/bybit_ws_parser_tests [==[--gtest_filter=BybitWsParser.ControlUnsupportedAndErrors]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[BybitWsParser.ControlUnsupportedAndErrors]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  bybit_ws_parser_tests_TESTS ParseFixedPoint.ScalesPadsAndRounds ParseFixedPoint.RejectsMalformedAndOverflow BybitWsParser.OrderbookSnapshot BybitWsParser.DeltaWithDataFirstAndWhitespace BybitWsParser.PublicTrade BybitWsParser.ControlUnsupportedAndErrors)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/depth_feed_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/depth_feed_tests[1]_tests.cmake")
+else()
+  add_test(depth_feed_tests_NOT_BUILT depth_feed_tests_NOT_BUILT)
+endif()
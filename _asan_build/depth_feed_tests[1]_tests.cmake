@@ -0,0 +1,13 @@
+add_test([=[DepthTest.DepthIsBestFirstAndBoundedByBuffer<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/depth_feed_tests [==[--gtest_filter=DepthTest/0.DepthIsBestFirstAndBoundedByBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DepthTest.DepthIsBestFirstAndBoundedByBuffer<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DepthTest.FeedReplayedOntoMirrorMatchesDepth<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/depth_feed_tests [==[--gtest_filter=DepthTest/0.FeedReplayedOntoMirrorMatchesDepth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DepthTest.FeedReplayedOntoMirrorMatchesDepth<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DepthTest.DepthIsBestFirstAndBoundedByBuffer<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/depth_feed_tests [==[--gtest_filter=DepthTest/1.DepthIsBestFirstAndBoundedByBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DepthTest.DepthIsBestFirstAndBoundedByBuffer<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DepthTest.FeedReplayedOntoMirrorMatchesDepth<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/depth_feed_tests [==[--gtest_filter=DepthTest/1.FeedReplayedOntoMirrorMatchesDepth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DepthTest.FeedReplayedOntoMirrorMatchesDepth<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LevelBookDepth.AggregatedLevelsBestFirst]=]  /root/repo/_asan_build/depth_feed_tests [==[--gtest_filter=LevelBookDepth.AggregatedLevelsBestFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LevelBookDepth.AggregatedLevelsBestFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DepthFeed.ReportsSnapshotThenOnlyChanges]=]  /root/repo/_asan_build/depth_feed_tests [==[--gtest_filter=DepthFeed.ReportsSnapshotThenOnlyChanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DepthFeed.ReportsSnapshotThenOnlyChanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  depth_feed_tests_TESTS [==[DepthTest.DepthIsBestFirstAndBoundedByBuffer<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[DepthTest.FeedReplayedOntoMirrorMatchesDepth<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[DepthTest.DepthIsBestFirstAndBoundedByBuffer<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[DepthTest.FeedReplayedOntoMirrorMatchesDepth<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] LevelBookDepth.AggregatedLevelsBestFirst DepthFeed.ReportsSnapshotThenOnlyChanges)
@@ -0,0 +1,9 @@
+add_test([=[EventCsv.ParsesReplayFormat]=]  /root/repo/_asan_build/event_csv_tests [==[--gtest_filter=EventCsv.ParsesReplayFormat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EventCsv.ParsesReplayFormat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EventCsv.RejectsMalformedLinesWithoutThrowing]=]  /root/repo/_asan_build/event_csv_tests [==[--gtest_filter=EventCsv.RejectsMalformedLinesWithoutThrowing]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EventCsv.RejectsMalformedLinesWithoutThrowing]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EventCsv.ParsesFeedFormat]=]  /root/repo/_asan_build/event_csv_tests [==[--gtest_filter=EventCsv.ParsesFeedFormat]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EventCsv.ParsesFeedFormat]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LineReader.SplitsLinesAcrossBlockBoundaries]=]  /root/repo/_asan_build/event_csv_tests [==[--gtest_filter=LineReader.SplitsLinesAcrossBlockBoundaries]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LineReader.SplitsLinesAcrossBlockBoundaries]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  event_csv_tests_TESTS EventCsv.ParsesReplayFormat EventCsv.RejectsMalformedLinesWithoutThrowing EventCsv.ParsesFeedFormat LineReader.SplitsLinesAcrossBlockBoundaries)
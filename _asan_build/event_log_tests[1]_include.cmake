@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/event_log_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/event_log_tests[1]_tests.cmake")
+else()
+  add_test(event_log_tests_NOT_BUILT event_log_tests_NOT_BUILT)
+endif()
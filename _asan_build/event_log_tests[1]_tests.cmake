@@ -0,0 +1,5 @@
+add_test([=[EventLog.RoundTripsEventsThroughMapping]=]  /root/repo/_asan_build/event_log_tests [==[--gtest_filter=EventLog.RoundTripsEventsThroughMapping]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EventLog.RoundTripsEventsThroughMapping]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[EventLog.RejectsForeignAndTruncatedFiles]=]  /root/repo/_asan_build/event_log_tests [==[--gtest_filter=EventLog.RejectsForeignAndTruncatedFiles]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[EventLog.RejectsForeignAndTruncatedFiles]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  event_log_tests_TESTS EventLog.RoundTripsEventsThroughMapping EventLog.RejectsForeignAndTruncatedFiles)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/id_index_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/id_index_tests[1]_tests.cmake")
+else()
+  add_test(id_index_tests_NOT_BUILT id_index_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,13 @@
+add_test([=[IdIndexTest.InsertFindEraseIncludingIdZero<trading::FlatIdIndex>]=]  /root/repo/_asan_build/id_index_tests [==[--gtest_filter=IdIndexTest/0.InsertFindEraseIncludingIdZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IdIndexTest.InsertFindEraseIncludingIdZero<trading::FlatIdIndex>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IdIndexTest.MatchesUnorderedMapOnRandomOps<trading::FlatIdIndex>]=]  /root/repo/_asan_build/id_index_tests [==[--gtest_filter=IdIndexTest/0.MatchesUnorderedMapOnRandomOps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IdIndexTest.MatchesUnorderedMapOnRandomOps<trading::FlatIdIndex>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IdIndexTest.InsertFindEraseIncludingIdZero<trading::DirectIdIndex>]=]  /root/repo/_asan_build/id_index_tests [==[--gtest_filter=IdIndexTest/1.InsertFindEraseIncludingIdZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IdIndexTest.InsertFindEraseIncludingIdZero<trading::DirectIdIndex>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[IdIndexTest.MatchesUnorderedMapOnRandomOps<trading::DirectIdIndex>]=]  /root/repo/_asan_build/id_index_tests [==[--gtest_filter=IdIndexTest/1.MatchesUnorderedMapOnRandomOps]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[IdIndexTest.MatchesUnorderedMapOnRandomOps<trading::DirectIdIndex>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectIdIndex.RejectsIdsAboveLimit]=]  /root/repo/_asan_build/id_index_tests [==[--gtest_filter=DirectIdIndex.RejectsIdsAboveLimit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectIdIndex.RejectsIdsAboveLimit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[DirectIdIndex.OrderBookWithDenseIds]=]  /root/repo/_asan_build/id_index_tests [==[--gtest_filter=DirectIdIndex.OrderBookWithDenseIds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[DirectIdIndex.OrderBookWithDenseIds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  id_index_tests_TESTS [==[IdIndexTest.InsertFindEraseIncludingIdZero<trading::FlatIdIndex>]==] [==[IdIndexTest.MatchesUnorderedMapOnRandomOps<trading::FlatIdIndex>]==] [==[IdIndexTest.InsertFindEraseIncludingIdZero<trading::DirectIdIndex>]==] [==[IdIndexTest.MatchesUnorderedMapOnRandomOps<trading::DirectIdIndex>]==] DirectIdIndex.RejectsIdsAboveLimit DirectIdIndex.OrderBookWithDenseIds)
@@ -0,0 +1,9 @@
+add_test([=[LadderOrderBook.BestLevelsFollowInsertAndCancel]=]  /root/repo/_asan_build/ladder_order_book_tests [==[--gtest_filter=LadderOrderBook.BestLevelsFollowInsertAndCancel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderOrderBook.BestLevelsFollowInsertAndCancel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderOrderBook.CursorSkipsEmptyWordsOfTheBitmap]=]  /root/repo/_asan_build/ladder_order_book_tests [==[--gtest_filter=LadderOrderBook.CursorSkipsEmptyWordsOfTheBitmap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderOrderBook.CursorSkipsEmptyWordsOfTheBitmap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderOrderBook.RecentersWhenPriceLeavesTheWindow]=]  /root/repo/_asan_build/ladder_order_book_tests [==[--gtest_filter=LadderOrderBook.RecentersWhenPriceLeavesTheWindow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderOrderBook.RecentersWhenPriceLeavesTheWindow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LadderOrderBook.MatchesMapBackendOnRandomStream]=]  /root/repo/_asan_build/ladder_order_book_tests [==[--gtest_filter=LadderOrderBook.MatchesMapBackendOnRandomStream]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LadderOrderBook.MatchesMapBackendOnRandomStream]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  ladder_order_book_tests_TESTS LadderOrderBook.BestLevelsFollowInsertAndCancel LadderOrderBook.CursorSkipsEmptyWordsOfTheBitmap LadderOrderBook.RecentersWhenPriceLeavesTheWindow LadderOrderBook.MatchesMapBackendOnRandomStream)
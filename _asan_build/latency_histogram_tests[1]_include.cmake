@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/latency_histogram_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/latency_histogram_tests[1]_tests.cmake")
+else()
+  add_test(latency_histogram_tests_NOT_BUILT latency_histogram_tests_NOT_BUILT)
+endif()
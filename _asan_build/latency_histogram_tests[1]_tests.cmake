@@ -0,0 +1,9 @@
+add_test([=[LatencyHistogram.BucketsAreContiguousAndNarrow]=]  /root/repo/_asan_build/latency_histogram_tests [==[--gtest_filter=LatencyHistogram.BucketsAreContiguousAndNarrow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogram.BucketsAreContiguousAndNarrow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogram.SmallValuesAreExact]=]  /root/repo/_asan_build/latency_histogram_tests [==[--gtest_filter=LatencyHistogram.SmallValuesAreExact]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogram.SmallValuesAreExact]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogram.PercentilesMatchSortedSamplesWithinBucketWidth]=]  /root/repo/_asan_build/latency_histogram_tests [==[--gtest_filter=LatencyHistogram.PercentilesMatchSortedSamplesWithinBucketWidth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogram.PercentilesMatchSortedSamplesWithinBucketWidth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LatencyHistogram.MergeEqualsRecordingEverythingInOne]=]  /root/repo/_asan_build/latency_histogram_tests [==[--gtest_filter=LatencyHistogram.MergeEqualsRecordingEverythingInOne]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LatencyHistogram.MergeEqualsRecordingEverythingInOne]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  latency_histogram_tests_TESTS LatencyHistogram.BucketsAreContiguousAndNarrow LatencyHistogram.SmallValuesAreExact LatencyHistogram.PercentilesMatchSortedSamplesWithinBucketWidth LatencyHistogram.MergeEqualsRecordingEverythingInOne)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/level_book_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/level_book_tests[1]_tests.cmake")
+else()
+  add_test(level_book_tests_NOT_BUILT level_book_tests_NOT_BUILT)
+endif()
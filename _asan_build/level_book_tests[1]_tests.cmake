@@ -0,0 +1,9 @@
+add_test([=[LevelBookTest.SetReplaceAndRemoveLevels<trading::BasicLevelBook<trading::MapLevels>>]=]  /root/repo/_asan_build/level_book_tests [==[--gtest_filter=LevelBookTest/0.SetReplaceAndRemoveLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LevelBookTest.SetReplaceAndRemoveLevels<trading::BasicLevelBook<trading::MapLevels>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LevelBookTest.RandomDeltasMatchReferenceMap<trading::BasicLevelBook<trading::MapLevels>>]=]  /root/repo/_asan_build/level_book_tests [==[--gtest_filter=LevelBookTest/0.RandomDeltasMatchReferenceMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LevelBookTest.RandomDeltasMatchReferenceMap<trading::BasicLevelBook<trading::MapLevels>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LevelBookTest.SetReplaceAndRemoveLevels<trading::BasicLevelBook<trading::LadderLevels>>]=]  /root/repo/_asan_build/level_book_tests [==[--gtest_filter=LevelBookTest/1.SetReplaceAndRemoveLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LevelBookTest.SetReplaceAndRemoveLevels<trading::BasicLevelBook<trading::LadderLevels>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[LevelBookTest.RandomDeltasMatchReferenceMap<trading::BasicLevelBook<trading::LadderLevels>>]=]  /root/repo/_asan_build/level_book_tests [==[--gtest_filter=LevelBookTest/1.RandomDeltasMatchReferenceMap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[LevelBookTest.RandomDeltasMatchReferenceMap<trading::BasicLevelBook<trading::LadderLevels>>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  level_book_tests_TESTS [==[LevelBookTest.SetReplaceAndRemoveLevels<trading::BasicLevelBook<trading::MapLevels>>]==] [==[LevelBookTest.RandomDeltasMatchReferenceMap<trading::BasicLevelBook<trading::MapLevels>>]==] [==[LevelBookTest.SetReplaceAndRemoveLevels<trading::BasicLevelBook<trading::LadderLevels>>]==] [==[LevelBookTest.RandomDeltasMatchReferenceMap<trading::BasicLevelBook<trading::LadderLevels>>]==])
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/order_book_alloc_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/order_book_alloc_tests[1]_tests.cmake")
+else()
+  add_test(order_book_alloc_tests_NOT_BUILT order_book_alloc_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,23 @@
+add_test([=[AllocationHook.CountsHeapAllocations]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=AllocationHook.CountsHeapAllocations]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[AllocationHook.CountsHeapAllocations]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBookTest/0.ReplayMakesNoAllocationsAfterReserve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBookTest/0.ClearKeepsReservedMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBookTest/1.ReplayMakesNoAllocationsAfterReserve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBookTest/1.ClearKeepsReservedMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBookTest/2.ReplayMakesNoAllocationsAfterReserve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBookTest/2.ClearKeepsReservedMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBookTest/3.ReplayMakesNoAllocationsAfterReserve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBookTest/3.ClearKeepsReservedMemory]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBook.DefaultMapBookAllocatesPerLevel]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBook.DefaultMapBookAllocatesPerLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBook.DefaultMapBookAllocatesPerLevel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[PreallocatedBook.LevelBookDeltasMakeNoAllocationsAfterReserve]=]  /root/repo/_asan_build/order_book_alloc_tests [==[--gtest_filter=PreallocatedBook.LevelBookDeltasMakeNoAllocationsAfterReserve]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[PreallocatedBook.LevelBookDeltasMakeNoAllocationsAfterReserve]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  order_book_alloc_tests_TESTS AllocationHook.CountsHeapAllocations [==[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::MapLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::FlatIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[PreallocatedBookTest.ReplayMakesNoAllocationsAfterReserve<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] [==[PreallocatedBookTest.ClearKeepsReservedMemory<trading::BasicOrderBook<trading::OrderBookTraits<trading::LadderLevels, trading::DirectIdIndex, trading::TickScale<2u, 0u>, 1024ul, 64ul> >>]==] PreallocatedBook.DefaultMapBookAllocatesPerLevel PreallocatedBook.LevelBookDeltasMakeNoAllocationsAfterReserve)
@@ -0,0 +1,65 @@
+add_test([=[OrderBookBasic.IsEmptyOnInit]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookBasic.IsEmptyOnInit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookBasic.IsEmptyOnInit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.SingleBidSetsBestBid]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.SingleBidSetsBestBid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.SingleBidSetsBestBid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.BestBidIsMaxPrice]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.BestBidIsMaxPrice]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.BestBidIsMaxPrice]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.ExecuteMarketBuyLessThanAvailable]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.ExecuteMarketBuyLessThanAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.ExecuteMarketBuyLessThanAvailable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.ExecuteMarketBuyMoreThanAvailable]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.ExecuteMarketBuyMoreThanAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.ExecuteMarketBuyMoreThanAvailable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.ExecuteMarketBuyFillingMultipleOrders]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.ExecuteMarketBuyFillingMultipleOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.ExecuteMarketBuyFillingMultipleOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.ExecuteMarketBuyFillingMultipleLayers]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.ExecuteMarketBuyFillingMultipleLayers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.ExecuteMarketBuyFillingMultipleLayers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.ExecuteMarketSellLessThanAvailable]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.ExecuteMarketSellLessThanAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.ExecuteMarketSellLessThanAvailable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.ExecuteMarketSellMoreThanAvailable]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.ExecuteMarketSellMoreThanAvailable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.ExecuteMarketSellMoreThanAvailable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.ExecuteMarketSellFillingMultipleOrders]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.ExecuteMarketSellFillingMultipleOrders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.ExecuteMarketSellFillingMultipleOrders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.ExecuteMarketSellFillingMultipleLayers]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.ExecuteMarketSellFillingMultipleLayers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.ExecuteMarketSellFillingMultipleLayers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookAddLimit.DuplicateIdReplacesRestingOrder]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookAddLimit.DuplicateIdReplacesRestingOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookAddLimit.DuplicateIdReplacesRestingOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookMarketSell.FillsBestBidFirstAcrossLevels]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookMarketSell.FillsBestBidFirstAcrossLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookMarketSell.FillsBestBidFirstAcrossLevels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookMarketSell.FillsBestAskFirstAcrossLevels]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookMarketSell.FillsBestAskFirstAcrossLevels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookMarketSell.FillsBestAskFirstAcrossLevels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookMarketSell.PartialFillKeepsRestOfLevel]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookMarketSell.PartialFillKeepsRestOfLevel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookMarketSell.PartialFillKeepsRestOfLevel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookCancel.CancelSingleBidMakesBookEmpty]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookCancel.CancelSingleBidMakesBookEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookCancel.CancelSingleBidMakesBookEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookCancel.CancelSingleAskMakesBookEmpty]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookCancel.CancelSingleAskMakesBookEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookCancel.CancelSingleAskMakesBookEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookCancel.CancelOneOfTwoOnSamePriceKeepsOther]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookCancel.CancelOneOfTwoOnSamePriceKeepsOther]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookCancel.CancelOneOfTwoOnSamePriceKeepsOther]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookCancel.CancelDoesNotChangeOtherSide]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookCancel.CancelDoesNotChangeOtherSide]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookCancel.CancelDoesNotChangeOtherSide]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookCancel.CancelNonExistingOrderReturnsFalseAndKeepsState]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookCancel.CancelNonExistingOrderReturnsFalseAndKeepsState]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookCancel.CancelNonExistingOrderReturnsFalseAndKeepsState]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookCancel.CancelFromMiddleOfLevelKeepsFifoOrder]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookCancel.CancelFromMiddleOfLevelKeepsFifoOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookCancel.CancelFromMiddleOfLevelKeepsFifoOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTopOfBook.ReturnsBothSidesWithAggregates]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookTopOfBook.ReturnsBothSidesWithAggregates]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTopOfBook.ReturnsBothSidesWithAggregates]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookFills.MarketOrderReportsEveryMakerFill]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookFills.MarketOrderReportsEveryMakerFill]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookFills.MarketOrderReportsEveryMakerFill]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookFills.CrossingLimitReportsTakerFillsAtMakerPrice]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookFills.CrossingLimitReportsTakerFillsAtMakerPrice]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookFills.CrossingLimitReportsTakerFillsAtMakerPrice]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookApply.BatchReportsCountsFillsAndTopOfBook]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookApply.BatchReportsCountsFillsAndTopOfBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookApply.BatchReportsCountsFillsAndTopOfBook]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookApply.EventHookRunsAfterEachEvent]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookApply.EventHookRunsAfterEachEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookApply.EventHookRunsAfterEachEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookApply.IdZeroAddsGetGeneratedIdsAndTopIsFinal]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookApply.IdZeroAddsGetGeneratedIdsAndTopIsFinal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookApply.IdZeroAddsGetGeneratedIdsAndTopIsFinal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookLoadLevels.MatchesPerLevelAddsAndReplacesContent]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookLoadLevels.MatchesPerLevelAddsAndReplacesContent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookLoadLevels.MatchesPerLevelAddsAndReplacesContent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookLoadLevels.RejectsUnsortedOrCrossedLevelsAndKeepsBook]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookLoadLevels.RejectsUnsortedOrCrossedLevelsAndKeepsBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookLoadLevels.RejectsUnsortedOrCrossedLevelsAndKeepsBook]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTraits.TickScaleConvertsAtTheEdges]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookTraits.TickScaleConvertsAtTheEdges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTraits.TickScaleConvertsAtTheEdges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookTraits.CustomTraitsBookMatchesDefaultBook]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookTraits.CustomTraitsBookMatchesDefaultBook]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookTraits.CustomTraitsBookMatchesDefaultBook]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[OrderBookCopy.CopyIsIndependentOfTheOriginal]=]  /root/repo/_asan_build/order_book_basic_tests [==[--gtest_filter=OrderBookCopy.CopyIsIndependentOfTheOriginal]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[OrderBookCopy.CopyIsIndependentOfTheOriginal]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  order_book_basic_tests_TESTS OrderBookBasic.IsEmptyOnInit OrderBookAddLimit.SingleBidSetsBestBid OrderBookAddLimit.BestBidIsMaxPrice OrderBookAddLimit.ExecuteMarketBuyLessThanAvailable OrderBookAddLimit.ExecuteMarketBuyMoreThanAvailable OrderBookAddLimit.ExecuteMarketBuyFillingMultipleOrders OrderBookAddLimit.ExecuteMarketBuyFillingMultipleLayers OrderBookAddLimit.ExecuteMarketSellLessThanAvailable OrderBookAddLimit.ExecuteMarketSellMoreThanAvailable OrderBookAddLimit.ExecuteMarketSellFillingMultipleOrders OrderBookAddLimit.ExecuteMarketSellFillingMultipleLayers OrderBookAddLimit.DuplicateIdReplacesRestingOrder OrderBookMarketSell.FillsBestBidFirstAcrossLevels OrderBookMarketSell.FillsBestAskFirstAcrossLevels OrderBookMarketSell.PartialFillKeepsRestOfLevel OrderBookCancel.CancelSingleBidMakesBookEmpty OrderBookCancel.CancelSingleAskMakesBookEmpty OrderBookCancel.CancelOneOfTwoOnSamePriceKeepsOther OrderBookCancel.CancelDoesNotChangeOtherSide OrderBookCancel.CancelNonExistingOrderReturnsFalseAndKeepsState OrderBookCancel.CancelFromMiddleOfLevelKeepsFifoOrder OrderBookTopOfBook.ReturnsBothSidesWithAggregates OrderBookFills.MarketOrderReportsEveryMakerFill OrderBookFills.CrossingLimitReportsTakerFillsAtMakerPrice OrderBookApply.BatchReportsCountsFillsAndTopOfBook OrderBookApply.EventHookRunsAfterEachEvent OrderBookApply.IdZeroAddsGetGeneratedIdsAndTopIsFinal OrderBookLoadLevels.MatchesPerLevelAddsAndReplacesContent OrderBookLoadLevels.RejectsUnsortedOrCrossedLevelsAndKeepsBook OrderBookTraits.TickScaleConvertsAtTheEdges OrderBookTraits.CustomTraitsBookMatchesDefaultBook OrderBookCopy.CopyIsIndependentOfTheOriginal)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/quote_publisher_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/quote_publisher_tests[1]_tests.cmake")
+else()
+  add_test(quote_publisher_tests_NOT_BUILT quote_publisher_tests_NOT_BUILT)
+endif()
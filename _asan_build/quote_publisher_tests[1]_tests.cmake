@@ -0,0 +1,7 @@
+add_test([=[QuotePublisher.PublishesTopAndDepth]=]  /root/repo/_asan_build/quote_publisher_tests [==[--gtest_filter=QuotePublisher.PublishesTopAndDepth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QuotePublisher.PublishesTopAndDepth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[QuotePublisher.TopOnlyFromBookOrApplyStats]=]  /root/repo/_asan_build/quote_publisher_tests [==[--gtest_filter=QuotePublisher.TopOnlyFromBookOrApplyStats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[QuotePublisher.TopOnlyFromBookOrApplyStats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Seqlock.ReadersNeverSeeTornValues]=]  /root/repo/_asan_build/quote_publisher_tests [==[--gtest_filter=Seqlock.ReadersNeverSeeTornValues]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Seqlock.ReadersNeverSeeTornValues]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  quote_publisher_tests_TESTS QuotePublisher.PublishesTopAndDepth QuotePublisher.TopOnlyFromBookOrApplyStats Seqlock.ReadersNeverSeeTornValues)
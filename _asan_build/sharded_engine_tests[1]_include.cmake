@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/sharded_engine_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/sharded_engine_tests[1]_tests.cmake")
+else()
+  add_test(sharded_engine_tests_NOT_BUILT sharded_engine_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,5 @@
+add_test([=[ShardedEngine.MatchesOneBookPerInstrumentReplayedInOrder]=]  /root/repo/_asan_build/sharded_engine_tests [==[--gtest_filter=ShardedEngine.MatchesOneBookPerInstrumentReplayedInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardedEngine.MatchesOneBookPerInstrumentReplayedInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShardedEngine.RejectsUnknownInstrumentAndSubmitWhenStopped]=]  /root/repo/_asan_build/sharded_engine_tests [==[--gtest_filter=ShardedEngine.RejectsUnknownInstrumentAndSubmitWhenStopped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShardedEngine.RejectsUnknownInstrumentAndSubmitWhenStopped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  sharded_engine_tests_TESTS ShardedEngine.MatchesOneBookPerInstrumentReplayedInOrder ShardedEngine.RejectsUnknownInstrumentAndSubmitWhenStopped)
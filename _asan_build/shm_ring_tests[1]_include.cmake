@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/shm_ring_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/shm_ring_tests[1]_tests.cmake")
+else()
+  add_test(shm_ring_tests_NOT_BUILT shm_ring_tests_NOT_BUILT)
+endif()
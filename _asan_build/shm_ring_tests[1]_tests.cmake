@@ -0,0 +1,9 @@
+add_test([=[ShmRing.ProducerAndConsumerShareMessagesInPlace]=]  /root/repo/_asan_build/shm_ring_tests [==[--gtest_filter=ShmRing.ProducerAndConsumerShareMessagesInPlace]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShmRing.ProducerAndConsumerShareMessagesInPlace]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShmRing.FullRingRejectsAndRecordsWrapAround]=]  /root/repo/_asan_build/shm_ring_tests [==[--gtest_filter=ShmRing.FullRingRejectsAndRecordsWrapAround]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShmRing.FullRingRejectsAndRecordsWrapAround]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShmRing.StreamsAcrossThreads]=]  /root/repo/_asan_build/shm_ring_tests [==[--gtest_filter=ShmRing.StreamsAcrossThreads]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShmRing.StreamsAcrossThreads]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ShmRing.AttachToMissingRingThrows]=]  /root/repo/_asan_build/shm_ring_tests [==[--gtest_filter=ShmRing.AttachToMissingRingThrows]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ShmRing.AttachToMissingRingThrows]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  shm_ring_tests_TESTS ShmRing.ProducerAndConsumerShareMessagesInPlace ShmRing.FullRingRejectsAndRecordsWrapAround ShmRing.StreamsAcrossThreads ShmRing.AttachToMissingRingThrows)
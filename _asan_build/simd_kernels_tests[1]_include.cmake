@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/simd_kernels_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/simd_kernels_tests[1]_tests.cmake")
+else()
+  add_test(simd_kernels_tests_NOT_BUILT simd_kernels_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,9 @@
+add_test([=[SimdKernels.DispatchFollowsSetActive]=]  /root/repo/_asan_build/simd_kernels_tests [==[--gtest_filter=SimdKernels.DispatchFollowsSetActive]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdKernels.DispatchFollowsSetActive]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimdKernels.SumAndCompactMatchScalar]=]  /root/repo/_asan_build/simd_kernels_tests [==[--gtest_filter=SimdKernels.SumAndCompactMatchScalar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdKernels.SumAndCompactMatchScalar]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimdKernels.ParseDecimalMatchesParseFixedPoint]=]  /root/repo/_asan_build/simd_kernels_tests [==[--gtest_filter=SimdKernels.ParseDecimalMatchesParseFixedPoint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdKernels.ParseDecimalMatchesParseFixedPoint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SimdKernels.ParseDecimalAtPageEnd]=]  /root/repo/_asan_build/simd_kernels_tests [==[--gtest_filter=SimdKernels.ParseDecimalAtPageEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SimdKernels.ParseDecimalAtPageEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  simd_kernels_tests_TESTS SimdKernels.DispatchFollowsSetActive SimdKernels.SumAndCompactMatchScalar SimdKernels.ParseDecimalMatchesParseFixedPoint SimdKernels.ParseDecimalAtPageEnd)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/spsc_queue_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/spsc_queue_tests[1]_tests.cmake")
+else()
+  add_test(spsc_queue_tests_NOT_BUILT spsc_queue_tests_NOT_BUILT)
+endif()
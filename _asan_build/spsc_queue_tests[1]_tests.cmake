@@ -0,0 +1,17 @@
+add_test([=[SpscQueueV2.CapacityIsRoundedUpToPowerOfTwo]=]  /root/repo/_asan_build/spsc_queue_tests [==[--gtest_filter=SpscQueueV2.CapacityIsRoundedUpToPowerOfTwo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscQueueV2.CapacityIsRoundedUpToPowerOfTwo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscQueueV2.IndexBlocksLiveOnSeparateCacheLines]=]  /root/repo/_asan_build/spsc_queue_tests [==[--gtest_filter=SpscQueueV2.IndexBlocksLiveOnSeparateCacheLines]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscQueueV2.IndexBlocksLiveOnSeparateCacheLines]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscQueueV2.EveryCellIsUsable]=]  /root/repo/_asan_build/spsc_queue_tests [==[--gtest_filter=SpscQueueV2.EveryCellIsUsable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscQueueV2.EveryCellIsUsable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscQueueV2.BulkTransfersWrapAroundAndStopAtBounds]=]  /root/repo/_asan_build/spsc_queue_tests [==[--gtest_filter=SpscQueueV2.BulkTransfersWrapAroundAndStopAtBounds]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscQueueV2.BulkTransfersWrapAroundAndStopAtBounds]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscQueueV2.TwoThreadsPreserveOrder]=]  /root/repo/_asan_build/spsc_queue_tests [==[--gtest_filter=SpscQueueV2.TwoThreadsPreserveOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscQueueV2.TwoThreadsPreserveOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SpscQueue.TwoThreadsPreserveOrder]=]  /root/repo/_asan_build/spsc_queue_tests [==[--gtest_filter=SpscQueue.TwoThreadsPreserveOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SpscQueue.TwoThreadsPreserveOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WaitStrategy.ParkedConsumerSeesEveryItem]=]  /root/repo/_asan_build/spsc_queue_tests [==[--gtest_filter=WaitStrategy.ParkedConsumerSeesEveryItem]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WaitStrategy.ParkedConsumerSeesEveryItem]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[WaitStrategy.ParsesModeNames]=]  /root/repo/_asan_build/spsc_queue_tests [==[--gtest_filter=WaitStrategy.ParsesModeNames]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[WaitStrategy.ParsesModeNames]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  spsc_queue_tests_TESTS SpscQueueV2.CapacityIsRoundedUpToPowerOfTwo SpscQueueV2.IndexBlocksLiveOnSeparateCacheLines SpscQueueV2.EveryCellIsUsable SpscQueueV2.BulkTransfersWrapAroundAndStopAtBounds SpscQueueV2.TwoThreadsPreserveOrder SpscQueue.TwoThreadsPreserveOrder WaitStrategy.ParkedConsumerSeesEveryItem WaitStrategy.ParsesModeNames)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/trace_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/trace_tests[1]_tests.cmake")
+else()
+  add_test(trace_tests_NOT_BUILT trace_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,9 @@
+add_test([=[Trace.ScopesAreCountedPerStageAfterFlush]=]  /root/repo/_asan_build/trace_tests [==[--gtest_filter=Trace.ScopesAreCountedPerStageAfterFlush]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Trace.ScopesAreCountedPerStageAfterFlush]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Trace.SameNameSharesOneStage]=]  /root/repo/_asan_build/trace_tests [==[--gtest_filter=Trace.SameNameSharesOneStage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Trace.SameNameSharesOneStage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Trace.RecordsOfFinishedThreadsAreFlushed]=]  /root/repo/_asan_build/trace_tests [==[--gtest_filter=Trace.RecordsOfFinishedThreadsAreFlushed]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Trace.RecordsOfFinishedThreadsAreFlushed]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Trace.FullRingDropsAndCounts]=]  /root/repo/_asan_build/trace_tests [==[--gtest_filter=Trace.FullRingDropsAndCounts]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Trace.FullRingDropsAndCounts]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  trace_tests_TESTS Trace.ScopesAreCountedPerStageAfterFlush Trace.SameNameSharesOneStage Trace.RecordsOfFinishedThreadsAreFlushed Trace.FullRingDropsAndCounts)
@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_asan_build/tsc_timer_tests[1]_tests.cmake")
+  include("/root/repo/_asan_build/tsc_timer_tests[1]_tests.cmake")
+else()
+  add_test(tsc_timer_tests_NOT_BUILT tsc_timer_tests_NOT_BUILT)
+endif()
@@ -0,0 +1,7 @@
+add_test([=[TscTimer.FrequencyIsDetected]=]  /root/repo/_asan_build/tsc_timer_tests [==[--gtest_filter=TscTimer.FrequencyIsDetected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TscTimer.FrequencyIsDetected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TscTimer.CalibrationAgreesWithDetectedFrequency]=]  /root/repo/_asan_build/tsc_timer_tests [==[--gtest_filter=TscTimer.CalibrationAgreesWithDetectedFrequency]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TscTimer.CalibrationAgreesWithDetectedFrequency]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TscTimer.FencedReadsAreOrderedAndMeasureSleep]=]  /root/repo/_asan_build/tsc_timer_tests [==[--gtest_filter=TscTimer.FencedReadsAreOrderedAndMeasureSleep]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TscTimer.FencedReadsAreOrderedAndMeasureSleep]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_asan_build SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  tsc_timer_tests_TESTS TscTimer.FrequencyIsDetected TscTimer.CalibrationAgreesWithDetectedFrequency TscTimer.FencedReadsAreOrderedAndMeasureSleep)
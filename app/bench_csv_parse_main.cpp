@@ -0,0 +1,122 @@
+#include "trading/event.hpp"
+#include "trading/event_csv.hpp"
+#include "utils/benchmark.hpp"
+#include "utils/line_reader.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace trading;
+
+namespace {
+
+// The getline + stringstream + stoll parser trading_replay used before
+// parse_csv_event, kept here as the baseline.
+bool legacy_parse(const std::string& line, Event& ev) {
+    if (line.empty() || line[0] == '#') return false;
+    std::stringstream ss(line);
+    std::string type, a, b, c, d;
+    if (!std::getline(ss, type, ',')) return false;
+    try {
+        if (type == "ADD") {
+            if (!std::getline(ss, a, ',') || !std::getline(ss, b, ',') ||
+                !std::getline(ss, c, ',') || !std::getline(ss, d, ',')) return false;
+            ev.type  = EventType::Add;
+            ev.side  = (a == "BUY" || a == "B") ? Side::Buy : Side::Sell;
+            ev.price = std::stoll(b);
+            ev.qty   = std::stoll(c);
+            ev.id    = std::stoull(d);
+        } else if (type == "MKT") {
+            if (!std::getline(ss, a, ',') || !std::getline(ss, b, ',')) return false;
+            ev.type = EventType::Market;
+            ev.side = (a == "BUY" || a == "B") ? Side::Buy : Side::Sell;
+            ev.qty  = std::stoll(b);
+        } else if (type == "CANCEL") {
+            if (!std::getline(ss, a, ',')) return false;
+            ev.type = EventType::Cancel;
+            ev.id   = std::stoull(a);
+        } else {
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: trading_bench_csv_parse <events.csv> [runs]\n";
+        return 1;
+    }
+    const std::string path = argv[1];
+    const std::size_t runs = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5;
+
+    // Whole file in memory: the per-line benchmarks measure parsing only.
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "Failed to open: " << path << "\n";
+        return 1;
+    }
+    const std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    std::vector<std::string_view> lines;
+    std::vector<std::string>      owned; // for the legacy parser's const std::string&
+    for (std::size_t pos = 0; pos < text.size();) {
+        std::size_t nl = text.find('\n', pos);
+        if (nl == std::string::npos) nl = text.size();
+        lines.emplace_back(text.data() + pos, nl - pos);
+        owned.emplace_back(lines.back());
+        pos = nl + 1;
+    }
+    if (lines.empty()) {
+        std::cerr << "Empty file: " << path << "\n";
+        return 1;
+    }
+
+    const std::size_t n     = lines.size();
+    const std::size_t batch = 1024;
+    std::size_t       ok    = 0;
+    Event             ev;
+
+    auto fast = bench::run_multi_benchmark("parse_csv_event", runs, [&](std::size_t) {
+        return bench::run_benchmark_with_percentiles_batched(
+            "parse_csv_event", n, batch,
+            [&](std::size_t i) { ok += parse_csv_event(lines[i], ev) == CsvParseStatus::Ok; });
+    });
+    bench::print_multi(fast);
+
+    auto legacy = bench::run_multi_benchmark("legacy stringstream+stoll", runs, [&](std::size_t) {
+        return bench::run_benchmark_with_percentiles_batched(
+            "legacy", n, batch, [&](std::size_t i) { ok += legacy_parse(owned[i], ev); });
+    });
+    bench::print_multi(legacy);
+
+    // End to end: block reads from the file + parse, as trading_replay does.
+    for (std::size_t r = 0; r < runs; ++r) {
+        const auto        t0 = std::chrono::steady_clock::now();
+        utils::LineReader reader(path);
+        std::string_view  line;
+        std::size_t       events = 0;
+        while (reader.next(line)) {
+            events += parse_csv_event(line, ev) == CsvParseStatus::Ok;
+        }
+        const double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        std::cout << "[file] LineReader + parse_csv_event run " << r << ": " << events << " events, "
+                  << static_cast<double>(reader.bytes_read()) / 1e6 / s << " MB/s, "
+                  << static_cast<double>(events) / s / 1e6 << " M events/s\n";
+        ok += events;
+    }
+
+    // Keep the parse results observable.
+    std::cout << "(checksum " << ok << ")\n";
+    return 0;
+}
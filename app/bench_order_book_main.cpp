@@ -2,7 +2,9 @@
 #include "trading/types.hpp"
 #include "utils/benchmark.hpp"
 
+#include <algorithm>
 #include <random>
+#include <string>
 #include <vector>
 #include <iostream>
 
@@ -14,6 +16,169 @@ struct AddParams {
     Quantity qty;
 };
 
+struct MktParams {
+    Side     side;
+    Quantity qty;
+};
+
+// Сколько ценовых уровней в cancel-heavy сценарии.
+constexpr std::size_t CANCEL_LEVELS = 5;
+
+// add_limit_order + execute_market_order + cancel для одного бэкенда книги.
+template <typename Book>
+void run_book_benchmarks(const std::string&             backend,
+                         const std::vector<AddParams>&  add_params,
+                         const std::vector<MktParams>&  mkt_params,
+                         const std::vector<AddParams>&  init_orders,
+                         const std::vector<OrderId>&    cancel_ids,
+                         const std::vector<PriceLevel>& snap_bids,
+                         const std::vector<PriceLevel>& snap_asks,
+                         std::size_t                    iterations,
+                         std::size_t                    runs,
+                         std::size_t                    batch_size,
+                         std::size_t                    warmup)
+{
+    using bench::run_benchmark_with_percentiles_batched;
+    using bench::run_multi_benchmark;
+    using bench::print_multi;
+
+    // ---------- add_limit_order ----------
+
+    auto add_summary = run_multi_benchmark(
+        backend + "::add_limit_order",
+        runs,
+        [&](std::size_t /*run_idx*/) {
+            Book book;
+
+            return run_benchmark_with_percentiles_batched(
+                backend + "::add_limit_order_single",
+                iterations,
+                batch_size,
+                [&](std::size_t i) {
+                    const auto& p = add_params[i];
+                    book.add_limit_order(p.side, p.price, p.qty);
+                },
+                warmup
+            );
+        }
+    );
+
+    print_multi(add_summary);
+    std::cout << "\n";
+
+    // ---------- execute_market_order ----------
+
+    auto mkt_summary = run_multi_benchmark(
+        backend + "::execute_market_order",
+        runs,
+        [&](std::size_t /*run_idx*/) {
+            Book book;
+
+            // заливаем ликвидность
+            for (const auto& p : init_orders) {
+                book.add_limit_order(p.side, p.price, p.qty);
+            }
+
+            return run_benchmark_with_percentiles_batched(
+                backend + "::execute_market_order_single",
+                iterations,
+                batch_size,
+                [&](std::size_t i) {
+                    const auto& p = mkt_params[i];
+                    book.execute_market_order(p.side, p.qty);
+                },
+                warmup
+            );
+        }
+    );
+
+    print_multi(mkt_summary);
+    std::cout << "\n";
+
+    // ---------- cancel (cancel-heavy: тысячи ордеров на уровне) ----------
+
+    auto cancel_summary = run_multi_benchmark(
+        backend + "::cancel",
+        runs,
+        [&](std::size_t /*run_idx*/) {
+            Book book;
+
+            // iterations ордеров на CANCEL_LEVELS уровнях bid, id = 1..iterations
+            for (std::size_t i = 0; i < iterations; ++i) {
+                auto px = static_cast<Price>(100 - static_cast<Price>(i % CANCEL_LEVELS));
+                book.add_limit_order_with_id(static_cast<OrderId>(i + 1), Side::Buy, px, 1);
+            }
+
+            return run_benchmark_with_percentiles_batched(
+                backend + "::cancel_single",
+                iterations,
+                batch_size,
+                [&](std::size_t i) {
+                    book.cancel(cancel_ids[i]);
+                },
+                warmup
+            );
+        }
+    );
+
+    print_multi(cancel_summary);
+    std::cout << "\n";
+
+    // ---------- snapshot build: clear + add_limit_order per level vs load_levels ----------
+    // Одна операция = полная сборка книги из снапшота (книга переиспользуется).
+
+    const std::size_t builds = std::max<std::size_t>(1, iterations / 100);
+
+    auto adds_summary = run_multi_benchmark(
+        backend + "::snapshot_build_adds",
+        runs,
+        [&](std::size_t /*run_idx*/) {
+            Book book;
+
+            return run_benchmark_with_percentiles_batched(
+                backend + "::snapshot_build_adds_single",
+                builds,
+                1,
+                [&](std::size_t) {
+                    book.clear();
+                    for (const auto& lvl : snap_bids) {
+                        book.add_limit_order(Side::Buy, lvl.price, lvl.qty);
+                    }
+                    for (const auto& lvl : snap_asks) {
+                        book.add_limit_order(Side::Sell, lvl.price, lvl.qty);
+                    }
+                },
+                builds / 10
+            );
+        }
+    );
+
+    print_multi(adds_summary);
+    std::cout << "\n";
+
+    auto bulk_summary = run_multi_benchmark(
+        backend + "::snapshot_build_load_levels",
+        runs,
+        [&](std::size_t /*run_idx*/) {
+            Book book;
+
+            return run_benchmark_with_percentiles_batched(
+                backend + "::snapshot_build_load_levels_single",
+                builds,
+                1,
+                [&](std::size_t) {
+                    book.load_levels(snap_bids, snap_asks);
+                },
+                builds / 10
+            );
+        }
+    );
+
+    print_multi(bulk_summary);
+    std::cout << "  " << snap_bids.size() + snap_asks.size() << " levels/build, load_levels speedup: x"
+              << adds_summary.mean_ns_per_op / bulk_summary.mean_ns_per_op << "\n\n";
+}
+
 int main(int argc, char** argv) {
     using bench::run_benchmark_with_percentiles_batched;
     using bench::run_multi_benchmark;
@@ -60,11 +225,6 @@ int main(int argc, char** argv) {
         add_params.push_back(AddParams{side, price, qty});
     }
 
-    struct MktParams {
-        Side     side;
-        Quantity qty;
-    };
-
     std::vector<MktParams> mkt_params;
     mkt_params.reserve(iterations);
     for (std::size_t i = 0; i < iterations; ++i) {
@@ -84,6 +244,22 @@ int main(int argc, char** argv) {
         init_orders.push_back(AddParams{side, price, qty});
     }
 
+    // Порядок отмен для cancel-heavy сценария: случайная перестановка id,
+    // т.е. отменяем из середины уровней, а не только с головы/хвоста.
+    std::vector<OrderId> cancel_ids(iterations);
+    for (std::size_t i = 0; i < iterations; ++i) {
+        cancel_ids[i] = static_cast<OrderId>(i + 1);
+    }
+    std::shuffle(cancel_ids.begin(), cancel_ids.end(), rng);
+
+    // Снапшот биржи для сборки книги: 200 уровней на сторону, тик 1, спред 1.
+    constexpr std::size_t SNAPSHOT_LEVELS = 200;
+    std::vector<PriceLevel> snap_bids, snap_asks;
+    for (std::size_t i = 0; i < SNAPSHOT_LEVELS; ++i) {
+        snap_bids.push_back(PriceLevel{static_cast<Price>(10'000 - i), qty_dist(rng)});
+        snap_asks.push_back(PriceLevel{static_cast<Price>(10'001 + i), qty_dist(rng)});
+    }
+
     // ---------- empty_loop (оверход бенч-харнесса) ----------
 
     auto empty_summary = run_multi_benchmark(
@@ -105,58 +281,16 @@ int main(int argc, char** argv) {
     print_multi(empty_summary);
     std::cout << "\n";
 
-    // ---------- OrderBook::add_limit_order ----------
-
-    auto add_summary = run_multi_benchmark(
-        "OrderBook::add_limit_order",
-        runs,
-        [&](std::size_t /*run_idx*/) {
-            OrderBook book;
-
-            return run_benchmark_with_percentiles_batched(
-                "OrderBook::add_limit_order_single",
-                iterations,
-                batch_size,
-                [&](std::size_t i) {
-                    const auto& p = add_params[i];
-                    book.add_limit_order(p.side, p.price, p.qty);
-                },
-                warmup
-            );
-        }
-    );
-
-    print_multi(add_summary);
-    std::cout << "\n";
-
-    // ---------- OrderBook::execute_market_order ----------
-
-    auto mkt_summary = run_multi_benchmark(
-        "OrderBook::execute_market_order",
-        runs,
-        [&](std::size_t /*run_idx*/) {
-            OrderBook book;
-
-            // заливаем ликвидность
-            for (const auto& p : init_orders) {
-                book.add_limit_order(p.side, p.price, p.qty);
-            }
-
-            return run_benchmark_with_percentiles_batched(
-                "OrderBook::execute_market_order_single",
-                iterations,
-                batch_size,
-                [&](std::size_t i) {
-                    const auto& p = mkt_params[i];
-                    book.execute_market_order(p.side, p.qty);
-                },
-                warmup
-            );
-        }
-    );
+    // ---------- оба бэкенда на одном и том же потоке параметров ----------
 
-    print_multi(mkt_summary);
-    std::cout << "\n";
+    run_book_benchmarks<OrderBook>("OrderBook", add_params, mkt_params, init_orders, cancel_ids,
+                                   snap_bids, snap_asks, iterations, runs, batch_size, warmup);
+    run_book_benchmarks<LadderOrderBook>("LadderOrderBook", add_params, mkt_params, init_orders, cancel_ids,
+                                         snap_bids, snap_asks, iterations, runs, batch_size, warmup);
+    // id во всех сценариях плотные (1..N), поэтому direct-mapped индекс применим.
+    run_book_benchmarks<OrderBookWith<LadderLevels, DirectIdIndex>>(
+        "LadderOrderBook<DirectIdIndex>", add_params, mkt_params, init_orders, cancel_ids,
+        snap_bids, snap_asks, iterations, runs, batch_size, warmup);
 
     return 0;
 }
@@ -1,11 +1,11 @@
 #include "trading/order_book.hpp"
 #include "trading/types.hpp"
+#include "utils/benchmark.hpp"    // OpSamples
 #include "utils/tsc_timer.hpp"   // your TscTimer
 #include <random>
 #include <vector>
 #include <iostream>
 #include <algorithm>
-#include <numeric>
 #include <string_view>
 
 using namespace trading;
@@ -30,21 +30,13 @@ struct Stats {
     double      p50_ns         = 0.0;
     double      p95_ns         = 0.0;
     double      p99_ns         = 0.0;
+    double      p999_ns        = 0.0;
+    double      p9999_ns       = 0.0;
     std::size_t iterations     = 0;
     std::size_t runs           = 1;
     std::size_t batch_size     = 1;
 };
 
-inline double pick_percentile(std::vector<double>& samples, double p) {
-    if (samples.empty()) return 0.0;
-    std::sort(samples.begin(), samples.end());
-    const std::size_t n   = samples.size();
-    double pos            = p * static_cast<double>(n - 1);
-    std::size_t idx       = static_cast<std::size_t>(pos + 0.5);
-    if (idx >= n) idx = n - 1;
-    return samples[idx];
-}
-
 // Single-run batched benchmark using TscTimer
 template<typename F>
 Stats run_single_tsc(
@@ -75,10 +67,7 @@ Stats run_single_tsc(
         fn(i);
     }
 
-    std::vector<double> samples_ns_per_op;
-    samples_ns_per_op.reserve(
-        (iterations - warmup_iters + batch_size - 1) / batch_size
-    );
+    bench::OpSamples samples;
 
     std::size_t i = warmup_iters;
     while (i < iterations) {
@@ -94,25 +83,12 @@ Stats run_single_tsc(
 
         double ns = bench::TscTimer::to_ns(t0, t1);
         double ns_per_op = ns / static_cast<double>(ops_in_batch);
-        samples_ns_per_op.push_back(ns_per_op);
+        samples.add(ns_per_op);
 
         i = batch_end;
     }
 
-    if (samples_ns_per_op.empty()) {
-        return stats;
-    }
-
-    // mean(ns/op)
-    double sum = std::accumulate(samples_ns_per_op.begin(),
-                                 samples_ns_per_op.end(), 0.0);
-    stats.mean_ns_per_op = sum / static_cast<double>(samples_ns_per_op.size());
-
-    // percentiles
-    stats.p50_ns = pick_percentile(samples_ns_per_op, 0.50);
-    stats.p95_ns = pick_percentile(samples_ns_per_op, 0.95);
-    stats.p99_ns = pick_percentile(samples_ns_per_op, 0.99);
-
+    samples.fill(stats);
     return stats;
 }
 
@@ -135,6 +111,8 @@ Stats run_multi_tsc(
     double sum_p50  = 0.0;
     double sum_p95  = 0.0;
     double sum_p99  = 0.0;
+    double sum_p999 = 0.0;
+    double sum_p9999 = 0.0;
 
     for (std::size_t r = 0; r < runs; ++r) {
         (void)r;
@@ -148,6 +126,8 @@ Stats run_multi_tsc(
         sum_p50  += s.p50_ns;
         sum_p95  += s.p95_ns;
         sum_p99  += s.p99_ns;
+        sum_p999 += s.p999_ns;
+        sum_p9999 += s.p9999_ns;
     }
 
     const double inv_runs = 1.0 / static_cast<double>(runs);
@@ -155,6 +135,8 @@ Stats run_multi_tsc(
     agg.p50_ns         = sum_p50  * inv_runs;
     agg.p95_ns         = sum_p95  * inv_runs;
     agg.p99_ns         = sum_p99  * inv_runs;
+    agg.p999_ns        = sum_p999 * inv_runs;
+    agg.p9999_ns       = sum_p9999 * inv_runs;
 
     return agg;
 }
@@ -181,6 +163,8 @@ inline void print_stats(const Stats& s) {
     std::cout << "  p50 ns:     " << s.p50_ns << "\n";
     std::cout << "  p95 ns:     " << s.p95_ns << "\n";
     std::cout << "  p99 ns:     " << s.p99_ns << "\n";
+    std::cout << "  p99.9 ns:   " << s.p999_ns << "\n";
+    std::cout << "  p99.99 ns:  " << s.p9999_ns << "\n";
 }
 
 } // namespace tsc_bench
@@ -210,7 +194,11 @@ int main(int argc, char** argv) {
               << "  iterations = " << iterations << "\n"
               << "  runs       = " << runs << "\n"
               << "  batch_size = " << batch_size << "\n"
-              << "  warmup     = " << warmup << "\n\n";
+              << "  warmup     = " << warmup << "\n";
+
+    const bench::TscInfo& tsc = bench::tsc_info();
+    std::cout << "  tsc        = " << tsc.ghz << " GHz (" << bench::to_string(tsc.source)
+              << (tsc.invariant ? ", invariant" : ", NOT invariant: results may drift") << ")\n\n";
 
     // ---------- Random generators (same as chrono bench) ----------
     std::mt19937_64 rng(42);
@@ -0,0 +1,556 @@
+#include "trading/event.hpp"
+#include "trading/event_csv.hpp"
+#include "trading/event_log.hpp"
+#include "trading/order_book.hpp"
+#include "trading/types.hpp"
+#include "utils/benchmark.hpp"
+#include "utils/cpu_affinity.hpp"
+#include "utils/line_reader.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace trading;
+
+namespace {
+
+// Named order flow: `setup` builds the resting book (untimed), `ops` are
+// timed one event per op. Ids are explicit and dense (1, 2, ...), so every
+// backend, DirectIdIndex included, sees exactly the same flow.
+struct Scenario {
+    std::string        name;
+    std::string        description;
+    std::vector<Event> setup;
+    std::vector<Event> ops;
+    OrderBookConfig    config;
+};
+
+constexpr Price kMid = 1'000'000;
+
+// Deterministic flow generator that tracks live ids, so cancels can target
+// resting orders without simulating the book.
+class FlowBuilder {
+public:
+    explicit FlowBuilder(std::uint64_t seed) : rng_(seed) {}
+
+    OrderId add(std::vector<Event>& out, Side side, Price price, Quantity qty) {
+        Event ev;
+        ev.type  = EventType::Add;
+        ev.side  = side;
+        ev.price = price;
+        ev.qty   = qty;
+        ev.id    = next_id_++;
+        out.push_back(ev);
+        live_.push_back(ev.id);
+        return ev.id;
+    }
+
+    // Cancel a random live order (swap-remove from the live list).
+    void cancel_random(std::vector<Event>& out) {
+        if (live_.empty()) {
+            return;
+        }
+        const std::size_t i = uniform(live_.size());
+        cancel(out, live_[i]);
+        live_[i] = live_.back();
+        live_.pop_back();
+    }
+
+    void cancel(std::vector<Event>& out, OrderId id) {
+        Event ev;
+        ev.type = EventType::Cancel;
+        ev.id   = id;
+        out.push_back(ev);
+    }
+
+    void market(std::vector<Event>& out, Side side, Quantity qty) {
+        Event ev;
+        ev.type = EventType::Market;
+        ev.side = side;
+        ev.qty  = qty;
+        out.push_back(ev);
+    }
+
+    std::size_t uniform(std::size_t n) { return std::uniform_int_distribution<std::size_t>(0, n - 1)(rng_); }
+    int         percent() { return static_cast<int>(uniform(100)); }
+    Side        side() { return uniform(2) ? Side::Sell : Side::Buy; }
+
+    OrderId     next_id() const noexcept { return next_id_; }
+    std::size_t live() const noexcept { return live_.size(); }
+
+private:
+    std::mt19937_64      rng_;
+    OrderId              next_id_ = 1;
+    std::vector<OrderId> live_;
+};
+
+// 10k levels per side, two orders each; adds spread over the whole depth,
+// cancels of random resting orders, a few small market orders.
+Scenario deep_book(std::size_t ops) {
+    constexpr std::size_t kLevels = 10'000;
+
+    Scenario s;
+    s.name        = "deep_book";
+    s.description = "10k levels per side; 45% add anywhere in depth, 45% cancel, 10% market";
+
+    FlowBuilder f(1);
+    for (std::size_t i = 1; i <= kLevels; ++i) {
+        for (int k = 0; k < 2; ++k) {
+            f.add(s.setup, Side::Buy, kMid - static_cast<Price>(i), 10);
+            f.add(s.setup, Side::Sell, kMid + static_cast<Price>(i), 10);
+        }
+    }
+    while (s.ops.size() < ops) {
+        const int r = f.percent();
+        if (r < 45) {
+            const auto  depth = static_cast<Price>(1 + f.uniform(kLevels));
+            const Side  side  = f.side();
+            f.add(s.ops, side, side == Side::Buy ? kMid - depth : kMid + depth, 10);
+        } else if (r < 90) {
+            f.cancel_random(s.ops);
+        } else {
+            // Qty of the top level at most: keeps the depth roughly constant.
+            f.market(s.ops, f.side(), 5);
+        }
+    }
+    s.config.max_orders = f.next_id();
+    s.config.max_levels = 2 * kLevels;
+    return s;
+}
+
+// One bid and one ask level with 10k orders each: long FIFOs, cancels in
+// the middle of the queue, small market orders eating the head.
+Scenario hot_level(std::size_t ops) {
+    constexpr std::size_t kOrders = 10'000;
+
+    Scenario s;
+    s.name        = "hot_level";
+    s.description = "10k orders on the best bid / ask; 50% add to the hot level, 35% cancel, 15% market";
+
+    FlowBuilder f(2);
+    for (std::size_t i = 0; i < kOrders; ++i) {
+        f.add(s.setup, Side::Buy, kMid - 1, 1);
+        f.add(s.setup, Side::Sell, kMid + 1, 1);
+    }
+    while (s.ops.size() < ops) {
+        const int r = f.percent();
+        if (r < 50) {
+            const Side side = f.side();
+            f.add(s.ops, side, side == Side::Buy ? kMid - 1 : kMid + 1, 1);
+        } else if (r < 85) {
+            f.cancel_random(s.ops);
+        } else {
+            f.market(s.ops, f.side(), 2);
+        }
+    }
+    s.config.max_orders = f.next_id();
+    s.config.max_levels = 16;
+    return s;
+}
+
+// 20k orders over 100 levels per side; 80% cancels of resting orders, 10%
+// cancels of unknown ids, 10% adds.
+Scenario cancel_heavy(std::size_t ops) {
+    constexpr std::size_t kLevels = 100;
+    constexpr std::size_t kOrders = 20'000;
+
+    Scenario s;
+    s.name        = "cancel_heavy";
+    s.description = "20k orders over 100 levels; 80% cancel, 10% cancel of unknown id, 10% add";
+
+    FlowBuilder f(3);
+    for (std::size_t i = 0; i < kOrders; ++i) {
+        const auto depth = static_cast<Price>(1 + i % kLevels);
+        f.add(s.setup, i % 2 ? Side::Sell : Side::Buy, i % 2 ? kMid + depth : kMid - depth, 5);
+    }
+    while (s.ops.size() < ops) {
+        const int r = f.percent();
+        if (r < 80 && f.live() > kOrders / 2) {
+            f.cancel_random(s.ops);
+        } else if (r < 90) {
+            f.cancel(s.ops, f.next_id() + 1'000'000 + f.uniform(1'000'000));
+        } else {
+            const auto depth = static_cast<Price>(1 + f.uniform(kLevels));
+            const Side side  = f.side();
+            f.add(s.ops, side, side == Side::Buy ? kMid - depth : kMid + depth, 5);
+        }
+    }
+    s.config.max_orders = f.next_id();
+    s.config.max_levels = 2 * kLevels;
+    return s;
+}
+
+// 1000 levels per side, 5 orders each. Each round a market order sweeps the
+// best 50 levels of one side, then 250 adds rebuild exactly those levels.
+Scenario sweep(std::size_t ops) {
+    constexpr std::size_t kLevels      = 1'000;
+    constexpr std::size_t kPerLevel    = 5;
+    constexpr Quantity    kQty         = 10;
+    constexpr std::size_t kSweepLevels = 50;
+
+    Scenario s;
+    s.name        = "sweep";
+    s.description = "1000 levels per side; market orders clearing 50 levels, then 250 adds refilling them";
+
+    // No cancels here, so the book state is known exactly: after a sweep
+    // and its refill the top 50 levels are full again.
+    FlowBuilder f(4);
+    for (std::size_t i = 1; i <= kLevels; ++i) {
+        for (std::size_t k = 0; k < kPerLevel; ++k) {
+            f.add(s.setup, Side::Buy, kMid - static_cast<Price>(i), kQty);
+            f.add(s.setup, Side::Sell, kMid + static_cast<Price>(i), kQty);
+        }
+    }
+
+    bool sell_side = true;
+    while (s.ops.size() < ops) {
+        const Side taker = sell_side ? Side::Buy : Side::Sell; // a Buy sweeps asks
+        const Side maker = sell_side ? Side::Sell : Side::Buy;
+        f.market(s.ops, taker, static_cast<Quantity>(kSweepLevels * kPerLevel) * kQty);
+        for (std::size_t i = 1; i <= kSweepLevels; ++i) {
+            const Price price = maker == Side::Sell ? kMid + static_cast<Price>(i) : kMid - static_cast<Price>(i);
+            for (std::size_t k = 0; k < kPerLevel; ++k) {
+                f.add(s.ops, maker, price, kQty);
+            }
+        }
+        sell_side = !sell_side;
+    }
+    s.config.max_orders = f.next_id();
+    s.config.max_levels = kLevels + kSweepLevels;
+    return s;
+}
+
+// Recorded flow: an event log (.bin) or replay CSV, e.g. a Bybit capture
+// converted with trading_csv_to_bin.
+Scenario replay(const std::string& path, std::size_t max_ops) {
+    Scenario s;
+    s.name        = "replay";
+    s.description = "recorded events from " + path;
+
+    if (is_event_log(path)) {
+        MappedEventLog log(path);
+        const auto     events = log.events();
+        s.ops.assign(events.begin(), events.end());
+    } else {
+        utils::LineReader in(path);
+        std::string_view  line;
+        Event             ev;
+        while (in.next(line)) {
+            if (parse_csv_event(line, ev) == CsvParseStatus::Ok) {
+                s.ops.push_back(ev);
+            }
+        }
+        if (in.failed()) {
+            throw std::runtime_error("cannot read " + path);
+        }
+    }
+    if (max_ops != 0 && s.ops.size() > max_ops) {
+        s.ops.resize(max_ops);
+    }
+    OrderId max_id = 0;
+    for (const Event& ev : s.ops) {
+        max_id = std::max(max_id, ev.id);
+    }
+    s.config.max_orders = std::max<std::size_t>(s.ops.size(), static_cast<std::size_t>(max_id) + 1);
+    s.config.max_levels = 4096;
+    return s;
+}
+
+template <typename Book>
+inline void apply_one(Book& book, const Event& ev) {
+    switch (ev.type) {
+        case EventType::Add:
+            book.add_limit_order_with_id(ev.id, ev.side, ev.price, ev.qty);
+            break;
+        case EventType::Market:
+            book.execute_market_order(ev.side, ev.qty);
+            break;
+        case EventType::Cancel:
+            book.cancel(ev.id);
+            break;
+        default:
+            break;
+    }
+}
+
+struct Options {
+    std::size_t ops     = 200'000;
+    std::size_t runs    = 5;
+    std::size_t batch   = 128;
+    std::size_t warmup  = 20'000;
+    int         cpu     = -1;
+    std::string format  = "text"; // text | json | csv
+    std::string out;              // empty: stdout
+    std::string replay;           // replay scenario input
+    std::vector<std::string> scenarios; // empty: all
+    std::vector<std::string> backends;  // empty: all
+};
+
+struct Row {
+    std::string   scenario;
+    std::string   backend;
+    bench::Result result;
+    std::size_t   setup_events = 0;
+    std::string   error; // non-empty: backend could not run the scenario
+};
+
+template <typename Book>
+Row run_scenario(const Scenario& s, const std::string& backend, const Options& opt) {
+    Row row;
+    row.scenario     = s.name;
+    row.backend      = backend;
+    row.setup_events = s.setup.size();
+
+    const std::size_t warmup = std::min(opt.warmup, s.ops.size() / 2);
+    try {
+        row.result = bench::run_multi_benchmark(
+            s.name + "/" + backend, opt.runs,
+            [&](std::size_t) {
+                Book book(s.config);
+                for (const Event& ev : s.setup) {
+                    apply_one(book, ev);
+                }
+                // Warmup = the first `warmup` ops of the flow, identical for
+                // every backend and run; the rest is timed.
+                return bench::run_benchmark_with_percentiles_batched(
+                    s.name, s.ops.size(), opt.batch,
+                    [&](std::size_t i) { apply_one(book, s.ops[i]); },
+                    warmup);
+            });
+        row.result.iterations = s.ops.size() - warmup;
+    } catch (const std::exception& ex) {
+        row.error = ex.what();
+    }
+    return row;
+}
+
+using Runner = std::function<Row(const Scenario&, const Options&)>;
+
+struct Backend {
+    const char* name;
+    Runner      run;
+};
+
+const std::vector<Backend>& all_backends() {
+    static const std::vector<Backend> backends = {
+        {"map-flat", [](const Scenario& s, const Options& o) {
+             return run_scenario<OrderBookWith<MapLevels, FlatIdIndex>>(s, "map-flat", o); }},
+        {"map-direct", [](const Scenario& s, const Options& o) {
+             return run_scenario<OrderBookWith<MapLevels, DirectIdIndex>>(s, "map-direct", o); }},
+        {"ladder-flat", [](const Scenario& s, const Options& o) {
+             return run_scenario<OrderBookWith<LadderLevels, FlatIdIndex>>(s, "ladder-flat", o); }},
+        {"ladder-direct", [](const Scenario& s, const Options& o) {
+             return run_scenario<OrderBookWith<LadderLevels, DirectIdIndex>>(s, "ladder-direct", o); }},
+    };
+    return backends;
+}
+
+std::vector<std::string> split_list(std::string_view s) {
+    std::vector<std::string> out;
+    while (!s.empty()) {
+        const auto comma = s.find(',');
+        out.emplace_back(s.substr(0, comma));
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        s.remove_prefix(comma + 1);
+    }
+    return out;
+}
+
+bool selected(const std::vector<std::string>& list, std::string_view name) {
+    return list.empty() || std::find(list.begin(), list.end(), name) != list.end();
+}
+
+std::string json_escape(std::string_view s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+
+void write_text(std::ostream& os, const std::vector<Row>& rows) {
+    for (const Row& r : rows) {
+        if (!r.error.empty()) {
+            os << "[bench-multi] " << r.scenario << "/" << r.backend << ": skipped (" << r.error << ")\n";
+            continue;
+        }
+        bench::print_multi(r.result);
+    }
+}
+
+void write_csv(std::ostream& os, const std::vector<Row>& rows) {
+    os << "scenario,backend,runs,ops,batch,setup_events,mean_ns,p50_ns,p95_ns,p99_ns,p999_ns,p9999_ns,mops,error\n";
+    for (const Row& r : rows) {
+        const bench::Result& x = r.result;
+        os << r.scenario << ',' << r.backend << ',' << x.runs << ',' << x.iterations << ','
+           << x.batch_size << ',' << r.setup_events << ',' << x.mean_ns_per_op << ',' << x.p50_ns << ','
+           << x.p95_ns << ',' << x.p99_ns << ',' << x.p999_ns << ',' << x.p9999_ns << ','
+           << (x.mean_ns_per_op > 0.0 ? 1e3 / x.mean_ns_per_op : 0.0) << ',' << r.error << '\n';
+    }
+}
+
+void write_json(std::ostream& os, const std::vector<Row>& rows, const Options& opt) {
+    os << "{\n  \"benchmark\": \"trading_bench_scenarios\",\n"
+       << "  \"runs\": " << opt.runs << ",\n  \"batch\": " << opt.batch
+       << ",\n  \"warmup\": " << opt.warmup << ",\n  \"cpu\": " << opt.cpu
+       << ",\n  \"results\": [";
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+        const Row&           r = rows[i];
+        const bench::Result& x = r.result;
+        os << (i ? "," : "") << "\n    {\"scenario\": \"" << r.scenario << "\", \"backend\": \"" << r.backend << "\"";
+        if (!r.error.empty()) {
+            os << ", \"error\": \"" << json_escape(r.error) << "\"}";
+            continue;
+        }
+        os << ", \"ops\": " << x.iterations << ", \"setup_events\": " << r.setup_events
+           << ", \"mean_ns\": " << x.mean_ns_per_op << ", \"p50_ns\": " << x.p50_ns
+           << ", \"p95_ns\": " << x.p95_ns << ", \"p99_ns\": " << x.p99_ns
+           << ", \"p999_ns\": " << x.p999_ns << ", \"p9999_ns\": " << x.p9999_ns
+           << ", \"mops\": " << (x.mean_ns_per_op > 0.0 ? 1e3 / x.mean_ns_per_op : 0.0) << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+void usage() {
+    std::cerr << "Usage: trading_bench_scenarios [scenario=a,b|all] [backend=a,b|all]"
+                 " [ops=N] [runs=N] [batch=N] [warmup=N] [cpu=N]"
+                 " [format=text|json|csv] [out=path] [replay=events.bin|csv]\n"
+                 "  scenarios: deep_book, hot_level, cancel_heavy, sweep, replay (needs replay=)\n"
+                 "  backends:  map-flat, map-direct, ladder-flat, ladder-direct\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const auto             eq  = arg.find('=');
+        if (eq == std::string_view::npos) {
+            usage();
+            return 1;
+        }
+        const std::string_view key   = arg.substr(0, eq);
+        const std::string      value = std::string(arg.substr(eq + 1));
+        try {
+            if (key == "scenario") {
+                opt.scenarios = value == "all" ? std::vector<std::string>{} : split_list(value);
+            } else if (key == "backend") {
+                opt.backends = value == "all" ? std::vector<std::string>{} : split_list(value);
+            } else if (key == "ops") {
+                opt.ops = std::stoull(value);
+            } else if (key == "runs") {
+                opt.runs = std::stoull(value);
+            } else if (key == "batch") {
+                opt.batch = std::stoull(value);
+            } else if (key == "warmup") {
+                opt.warmup = std::stoull(value);
+            } else if (key == "cpu") {
+                if (!utils::parse_cpu(value, opt.cpu)) {
+                    throw std::invalid_argument(value);
+                }
+            } else if (key == "format") {
+                if (value != "text" && value != "json" && value != "csv") {
+                    throw std::invalid_argument(value);
+                }
+                opt.format = value;
+            } else if (key == "out") {
+                opt.out = value;
+            } else if (key == "replay") {
+                opt.replay = value;
+            } else {
+                std::cerr << "Unknown argument: " << arg << "\n";
+                usage();
+                return 1;
+            }
+        } catch (const std::exception&) {
+            std::cerr << "Bad value: " << arg << "\n";
+            return 1;
+        }
+    }
+    if (opt.ops == 0 || opt.runs == 0) {
+        std::cerr << "ops and runs must be > 0\n";
+        return 1;
+    }
+
+    if (!utils::pin_current_thread(opt.cpu)) {
+        std::cerr << "warning: cannot pin to cpu " << opt.cpu << ", running unpinned\n";
+    }
+
+    // Build the flows once; every backend replays the same events.
+    std::vector<Scenario> scenarios;
+    const std::vector<std::pair<const char*, Scenario (*)(std::size_t)>> builders = {
+        {"deep_book", deep_book}, {"hot_level", hot_level}, {"cancel_heavy", cancel_heavy}, {"sweep", sweep},
+    };
+    for (const auto& [name, build] : builders) {
+        if (selected(opt.scenarios, name)) {
+            scenarios.push_back(build(opt.ops));
+        }
+    }
+    if (selected(opt.scenarios, "replay") && !opt.replay.empty()) {
+        try {
+            scenarios.push_back(replay(opt.replay, opt.ops));
+        } catch (const std::exception& ex) {
+            std::cerr << "replay: " << ex.what() << "\n";
+            return 1;
+        }
+    } else if (!opt.scenarios.empty() && selected(opt.scenarios, "replay")) {
+        std::cerr << "scenario=replay needs replay=<events.bin|csv>\n";
+        return 1;
+    }
+    if (scenarios.empty()) {
+        std::cerr << "no scenario selected\n";
+        usage();
+        return 1;
+    }
+
+    std::vector<Row> rows;
+    for (const Scenario& s : scenarios) {
+        if (opt.format == "text") {
+            std::cerr << "== " << s.name << ": " << s.description << " (" << s.setup.size()
+                      << " setup events, " << s.ops.size() << " ops)\n";
+        }
+        for (const Backend& b : all_backends()) {
+            if (selected(opt.backends, b.name)) {
+                rows.push_back(b.run(s, opt));
+            }
+        }
+    }
+    if (rows.empty()) {
+        std::cerr << "no backend selected\n";
+        usage();
+        return 1;
+    }
+
+    std::ofstream file;
+    if (!opt.out.empty()) {
+        file.open(opt.out);
+        if (!file) {
+            std::cerr << "cannot write " << opt.out << "\n";
+            return 1;
+        }
+    }
+    std::ostream& os = opt.out.empty() ? std::cout : file;
+
+    if (opt.format == "json") {
+        write_json(os, rows, opt);
+    } else if (opt.format == "csv") {
+        write_csv(os, rows);
+    } else {
+        write_text(os, rows);
+    }
+    return 0;
+}
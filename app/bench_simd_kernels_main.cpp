@@ -0,0 +1,147 @@
+#include "utils/benchmark.hpp"
+#include "utils/decimal.hpp"
+#include "utils/simd_kernels.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace utils;
+
+namespace {
+
+// Level arrays as a Bybit orderbook.200 side gives them: close prices,
+// a share of qty 0 (levels removed by a delta).
+struct LevelArrays {
+    std::vector<std::int64_t> prices;
+    std::vector<std::int64_t> qtys;
+};
+
+LevelArrays make_levels(std::size_t n, double empty_share, std::mt19937_64& rng) {
+    std::uniform_int_distribution<std::int64_t> qty(1, 50'000);
+    std::bernoulli_distribution                 empty(empty_share);
+    LevelArrays                                 out;
+    for (std::size_t i = 0; i < n; ++i) {
+        out.prices.push_back(1'649'350 + static_cast<std::int64_t>(i));
+        out.qtys.push_back(empty(rng) ? 0 : qty(rng));
+    }
+    return out;
+}
+
+// Price / qty fields as they appear in Bybit spot frames.
+std::vector<std::string> make_fields(std::size_t n, std::mt19937_64& rng) {
+    std::uniform_int_distribution<int> price(1'600'000, 1'700'000);
+    std::uniform_int_distribution<int> qty(1, 2'000'000);
+    std::vector<std::string>           out;
+    char                               buf[32];
+    for (std::size_t i = 0; i < n; ++i) {
+        if (i % 2 == 0) {
+            const int p = price(rng);
+            std::snprintf(buf, sizeof(buf), "%d.%02d", p / 100, p % 100);
+        } else {
+            const int q = qty(rng);
+            std::snprintf(buf, sizeof(buf), "%d.%06d", q / 1'000'000, q % 1'000'000);
+        }
+        out.emplace_back(buf);
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200'000;
+    const std::size_t runs       = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 5;
+    const std::size_t batch      = 256;
+
+    std::cout << "SIMD kernels, detected: " << simd::name(simd::detected()) << "\n";
+
+    std::vector<simd::Level> levels{simd::Level::Scalar};
+    if (simd::kernels(simd::Level::Avx2)) {
+        levels.push_back(simd::Level::Avx2);
+    }
+
+    std::mt19937_64 rng(42);
+    std::int64_t    sink = 0; // keeps results observable
+
+    // ---- sum_qty ----
+    for (std::size_t n : {std::size_t{50}, std::size_t{200}, std::size_t{1000}}) {
+        const LevelArrays lv = make_levels(n, 0.0, rng);
+        for (simd::Level level : levels) {
+            const simd::Kernels& k    = *simd::kernels(level);
+            const std::string    name = "sum_qty n=" + std::to_string(n) + " " + simd::name(level);
+            auto res = bench::run_multi_benchmark(name, runs, [&](std::size_t) {
+                return bench::run_benchmark_with_percentiles_batched(
+                    name, iterations, batch, [&](std::size_t) { sink += k.sum_qty(lv.qtys.data(), n); });
+            });
+            bench::print_multi(res);
+        }
+    }
+
+    // ---- compact_levels: every op restores the input first ----
+    for (std::size_t n : {std::size_t{50}, std::size_t{200}, std::size_t{1000}}) {
+        const LevelArrays lv = make_levels(n, 0.3, rng);
+        LevelArrays       work = lv;
+
+        const std::string copy_name = "copy only n=" + std::to_string(n);
+        auto copy = bench::run_multi_benchmark(copy_name, runs, [&](std::size_t) {
+            return bench::run_benchmark_with_percentiles_batched(copy_name, iterations, batch, [&](std::size_t) {
+                std::memcpy(work.prices.data(), lv.prices.data(), n * sizeof(std::int64_t));
+                std::memcpy(work.qtys.data(), lv.qtys.data(), n * sizeof(std::int64_t));
+                sink += work.qtys[n / 2];
+            });
+        });
+        bench::print_multi(copy);
+
+        for (simd::Level level : levels) {
+            const simd::Kernels& k    = *simd::kernels(level);
+            const std::string    name = "copy+compact_levels n=" + std::to_string(n) + " " + simd::name(level);
+            auto res = bench::run_multi_benchmark(name, runs, [&](std::size_t) {
+                return bench::run_benchmark_with_percentiles_batched(name, iterations, batch, [&](std::size_t) {
+                    std::memcpy(work.prices.data(), lv.prices.data(), n * sizeof(std::int64_t));
+                    std::memcpy(work.qtys.data(), lv.qtys.data(), n * sizeof(std::int64_t));
+                    sink += static_cast<std::int64_t>(k.compact_levels(work.prices.data(), work.qtys.data(), n));
+                });
+            });
+            bench::print_multi(res);
+        }
+    }
+
+    // ---- decimal -> ticks, one field per op ----
+    const std::vector<std::string> fields = make_fields(4096, rng);
+    const auto field_decimals = [](std::size_t i) { return i % 2 == 0 ? 2u : 6u; };
+
+    auto inl = bench::run_multi_benchmark("parse_fixed_point (inline)", runs, [&](std::size_t) {
+        return bench::run_benchmark_with_percentiles_batched(
+            "parse_fixed_point (inline)", iterations, batch, [&](std::size_t i) {
+                const std::size_t j = i % fields.size();
+                std::int64_t      v = 0;
+                parse_fixed_point(fields[j], field_decimals(j), v);
+                sink += v;
+            });
+    });
+    bench::print_multi(inl);
+
+    for (simd::Level level : levels) {
+        const simd::Kernels& k    = *simd::kernels(level);
+        const std::string    name = std::string("parse_decimal ") + simd::name(level);
+        auto res = bench::run_multi_benchmark(name, runs, [&](std::size_t) {
+            return bench::run_benchmark_with_percentiles_batched(name, iterations, batch, [&](std::size_t i) {
+                const std::size_t j = i % fields.size();
+                std::int64_t      v = 0;
+                k.parse_decimal(fields[j], field_decimals(j), v);
+                sink += v;
+            });
+        });
+        bench::print_multi(res);
+    }
+
+    std::cout << "(checksum " << sink << ")\n";
+    return 0;
+}
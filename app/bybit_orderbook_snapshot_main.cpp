@@ -1,6 +1,7 @@
 // app/bybit_orderbook_snapshot_main.cpp
 #include "exchange/bybit_public_rest.hpp"
 #include "trading/order_book.hpp"
+#include "snapshot_build_bench.hpp"
 
 #include <chrono>
 #include <cstdint>
@@ -61,74 +62,16 @@ int main(int argc, char** argv) {
             return 0;
         }
 
-        // Warm-up: build once to touch code & caches
-        {
-            trading::OrderBook book;
-            for (const auto& lvl : snap.bids) {
-                auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-                auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-                book.add_limit_order(trading::Side::Buy, px, qty);
-            }
-            for (const auto& lvl : snap.asks) {
-                auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-                auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-                book.add_limit_order(trading::Side::Sell, px, qty);
-            }
-        }
+        const auto bids = snapshot_bench::to_price_levels(snap.bids, PRICE_SCALE, QTY_SCALE);
+        const auto asks = snapshot_bench::to_price_levels(snap.asks, PRICE_SCALE, QTY_SCALE);
 
         std::cout << "\nBenchmarking OrderBook snapshot build...\n";
-        std::cout << "  runs          : " << runs << "\n";
-        std::cout << "  total levels  : " << total_levels << "\n";
-
-        auto t_start = Clock::now();
-        for (int r = 0; r < runs; ++r) {
-            trading::OrderBook book;
-
-            for (const auto& lvl : snap.bids) {
-                auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-                auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-                book.add_limit_order(trading::Side::Buy, px, qty);
-            }
-            for (const auto& lvl : snap.asks) {
-                auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-                auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-                book.add_limit_order(trading::Side::Sell, px, qty);
-            }
-
-            // Optional: read best bid/ask at the end of each run to
-            // ensure the optimizer does not completely remove the work.
-            auto bb = book.best_bid();
-            auto ba = book.best_ask();
-            (void)bb;
-            (void)ba;
-        }
-        auto t_end = Clock::now();
-
-        auto total_ns =
-            std::chrono::duration_cast<std::chrono::nanoseconds>(t_end - t_start)
-                .count();
-
-        double ns_per_run   = static_cast<double>(total_ns) / runs;
-        double ns_per_level = ns_per_run / static_cast<double>(total_levels);
-
-        std::cout << "\nBuild timings (OrderBook from snapshot):\n";
-        std::cout << "  total time:   " << total_ns << " ns\n";
-        std::cout << "  per run:      " << ns_per_run << " ns/snapshot\n";
-        std::cout << "  per level:    " << ns_per_level << " ns/level\n";
+        snapshot_bench::run("OrderBook from snapshot", bids, asks, runs);
 
         // Build once more and print human-readable best bid/ask.
         {
             trading::OrderBook book;
-            for (const auto& lvl : snap.bids) {
-                auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-                auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-                book.add_limit_order(trading::Side::Buy, px, qty);
-            }
-            for (const auto& lvl : snap.asks) {
-                auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-                auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-                book.add_limit_order(trading::Side::Sell, px, qty);
-            }
+            book.load_levels(bids, asks);
 
             auto bb = book.best_bid();
             auto ba = book.best_ask();
@@ -4,6 +4,8 @@
 #include <chrono>
 #include <ctime>
 #include <iostream>
+#include <string>
+#include <vector>
 
 int main() {
     try {
@@ -21,6 +23,28 @@ int main() {
         std::cout << "  last:      " << ticker.last_price << "\n";
         std::cout << "  best bid:  " << ticker.best_bid << "\n";
         std::cout << "  best ask:  " << ticker.best_ask << "\n";
+
+        // Keep-alive: the connection opened above is reused, so these calls
+        // cost one round trip each, without TCP / TLS handshakes.
+        using Clock = std::chrono::steady_clock;
+        std::cout << "\nRepeated server time requests (same connection):\n";
+        for (int i = 0; i < 3; ++i) {
+            const auto t0 = Clock::now();
+            client.get_server_time_ms();
+            const auto us = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count();
+            std::cout << "  request " << i << ": " << us << " us\n";
+        }
+
+        // Startup / resync: several order book snapshots fetched concurrently.
+        const std::vector<std::string> symbols{"BTCUSDT", "ETHUSDT", "SOLUSDT", "XRPUSDT"};
+        const auto t0    = Clock::now();
+        const auto snaps = client.get_spot_orderbook_snapshots(symbols, 50);
+        const auto us    = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - t0).count();
+        std::cout << "\nParallel orderbook snapshots (" << snaps.size() << " symbols) in " << us << " us:\n";
+        for (const auto& snap : snaps) {
+            std::cout << "  " << snap.symbol << ": seq=" << snap.seq << ", bids=" << snap.bids.size()
+                      << ", asks=" << snap.asks.size() << "\n";
+        }
     } catch (const std::exception& ex) {
         std::cerr << "bybit_rest_demo error: " << ex.what() << "\n";
         return 1;
@@ -1,13 +1,28 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <future>
 #include <iostream>
 #include <string>
-#include <map>
+#include <string_view>
+#include <thread>
 #include <limits>
-#include <cmath> 
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <vector>
 
 #include <nlohmann/json.hpp>
 
+#include "exchange/bybit_book_sync.hpp"
+#include "exchange/bybit_public_rest.hpp"
 #include "exchange/bybit_public_ws.hpp"
-#include "trading/order_book.hpp"
+#include "exchange/bybit_topic_router.hpp"
+#include "exchange/bybit_ws_parser.hpp"
+#include "trading/level_book.hpp"
+#include "trading/order_book_traits.hpp"
+#include "utils/latency_histogram.hpp"
+#include "utils/trace.hpp"
 
 using nlohmann::json;
 
@@ -15,192 +30,75 @@ namespace {
 
 constexpr bool kVerbosePrint = false;  // или true, когда хочешь посмотреть вживую
 
-constexpr double PRICE_MULT = 10.0;       // хранить цену с точностью 0.1
-constexpr double QTY_MULT   = 1'000'000.; // хранить объём с точностью 1e-6
+// Тики инструмента: цена с точностью 0.1, объём 1e-6.
+using Ticks = trading::TickScale<1, 6>;
+constexpr exchange::BybitScale kScale{Ticks::price_decimals, Ticks::qty_decimals};
 
 using SteadyClock = std::chrono::steady_clock;
 using SysClock    = std::chrono::system_clock;
 
+// Fixed-size histograms: memory does not grow on a 24/7 feed.
 struct LiveStats {
-    std::vector<double> process_ns;      // handler time per msg
-    std::vector<double> data_latency_ms; // now_ms - msg.ts
-    std::size_t snapshots = 0;
-    std::size_t deltas    = 0;
-
-    void add(double proc_ns, double lat_ms, bool is_snapshot) {
-        process_ns.push_back(proc_ns);
-        data_latency_ms.push_back(lat_ms);
+    utils::LatencyHistogram process_ns;      // handler time per msg
+    utils::LatencyHistogram dispatch_ns;     // WS receive -> book thread dispatch
+    utils::LatencyHistogram data_latency_ms; // recv_ms - msg.ts (negative -> 0)
+    std::size_t snapshots  = 0;
+    std::size_t deltas     = 0;
+    std::size_t clock_skew = 0; // msg.ts ahead of the local clock
+
+    void add(std::uint64_t proc_ns, std::uint64_t disp_ns, long long lat_ms, bool is_snapshot) {
+        process_ns.record(proc_ns);
+        dispatch_ns.record(disp_ns);
+        if (lat_ms < 0) {
+            ++clock_skew;
+            lat_ms = 0;
+        }
+        data_latency_ms.record(static_cast<std::uint64_t>(lat_ms));
         if (is_snapshot)
             ++snapshots;
         else
             ++deltas;
     }
+
+    std::size_t messages() const { return static_cast<std::size_t>(process_ns.count()); }
 };
 
-double percentile(std::vector<double> v, double p) {
-    if (v.empty()) return 0.0;
-    std::sort(v.begin(), v.end());
-    double idx = (p / 100.0) * (v.size() - 1);
-    std::size_t i = static_cast<std::size_t>(idx);
-    return v[i];
+void print_histogram(const char* title, const utils::LatencyHistogram& h, const char* unit) {
+    std::cout << title << "\n";
+    std::cout << "  mean  : " << h.mean()                << " " << unit << "\n";
+    std::cout << "  p50   : " << h.percentile(0.50)      << " " << unit << "\n";
+    std::cout << "  p95   : " << h.percentile(0.95)      << " " << unit << "\n";
+    std::cout << "  p99   : " << h.percentile(0.99)      << " " << unit << "\n";
+    std::cout << "  p99.9 : " << h.percentile(0.999)     << " " << unit << "\n";
+    std::cout << "  p99.99: " << h.percentile(0.9999)    << " " << unit << "\n";
+    std::cout << "  max   : " << h.max()                 << " " << unit << "\n\n";
 }
 
-void print_stats(const LiveStats& s) {
-    if (s.process_ns.empty()) {
+void print_stats(const LiveStats& s, const exchange::WsSessionStats& ws) {
+    std::cout << "\nWS session: frames=" << ws.frames_received
+              << ", dropped=" << ws.frames_dropped
+              << ", connects=" << ws.connects
+              << ", failures=" << ws.connect_failures << "\n";
+
+    if (s.messages() == 0) {
         std::cout << "\n[stats] no messages processed\n";
         return;
     }
 
-    auto proc = s.process_ns;
-    auto lat  = s.data_latency_ms;
-
-    double mean_proc = std::accumulate(proc.begin(), proc.end(), 0.0) / proc.size();
-    double mean_lat  = std::accumulate(lat.begin(),  lat.end(),  0.0) / lat.size();
-
     std::cout << "\n=== Live WS orderbook stats ===\n";
-    std::cout << "Messages: " << s.process_ns.size()
+    std::cout << "Messages: " << s.messages()
               << " (snapshots=" << s.snapshots
               << ", deltas="    << s.deltas  << ")\n\n";
 
-    std::cout << "Processing time (handler):\n";
-    std::cout << "  mean: " << mean_proc             << " ns\n";
-    std::cout << "  p50 : " << percentile(proc, 50.) << " ns\n";
-    std::cout << "  p95 : " << percentile(proc, 95.) << " ns\n";
-    std::cout << "  p99 : " << percentile(proc, 99.) << " ns\n\n";
-
-    std::cout << "Data latency (local_now_ms - msg.ts_ms):\n";
-    std::cout << "  mean: " << mean_lat              << " ms\n";
-    std::cout << "  p50 : " << percentile(lat, 50.)  << " ms\n";
-    std::cout << "  p95 : " << percentile(lat, 95.)  << " ms\n";
-    std::cout << "  p99 : " << percentile(lat, 99.)  << " ms\n";
-}
-
-inline trading::Price to_price_ticks(double px)
-{
-    return static_cast<trading::Price>(std::llround(px * PRICE_MULT));
-}
-
-inline trading::Quantity to_qty_ticks(double q)
-{
-    const double scaled = q * QTY_MULT;
-    if (scaled <= 0.0) {
-        return static_cast<trading::Quantity>(0);
-    }
-    return static_cast<trading::Quantity>(std::llround(scaled));
-}
-
-inline double from_price_ticks(trading::Price p)
-{
-    return static_cast<double>(p) / PRICE_MULT;
-}
-
-inline double from_qty_ticks(trading::Quantity q)
-{
-    return static_cast<double>(q) / QTY_MULT;
-}
-
-struct SimpleLevelBook {
-    // Aggregated book per price level
-    std::map<double, double, std::greater<double>> bids; // price -> qty
-    std::map<double, double, std::less<double>>    asks; // price -> qty
-};
-
-// Build level-book from snapshot JSON: data.b / data.a
-void build_level_book_from_snapshot(SimpleLevelBook& lvl_book, const json& data)
-{
-    lvl_book.bids.clear();
-    lvl_book.asks.clear();
-
-    const auto& bids = data.at("b");
-    const auto& asks = data.at("a");
-
-    for (const auto& lvl : bids) {
-        // lvl = ["price", "qty"]
-        const std::string price_str = lvl.at(0).get<std::string>();
-        const std::string qty_str   = lvl.at(1).get<std::string>();
-
-        double price = std::stod(price_str);
-        double qty   = std::stod(qty_str);
-        if (qty > 0.0) {
-            lvl_book.bids[price] = qty;
-        }
-    }
-
-    for (const auto& lvl : asks) {
-        const std::string price_str = lvl.at(0).get<std::string>();
-        const std::string qty_str   = lvl.at(1).get<std::string>();
-
-        double price = std::stod(price_str);
-        double qty   = std::stod(qty_str);
-        if (qty > 0.0) {
-            lvl_book.asks[price] = qty;
-        }
-    }
-}
-
-// Apply delta to existing level-book: qty==0 -> erase, else set qty
-void apply_level_book_delta(SimpleLevelBook& lvl_book, const json& data)
-{
-    const auto& bids = data.at("b");
-    const auto& asks = data.at("a");
-
-    for (const auto& lvl : bids) {
-        const std::string price_str = lvl.at(0).get<std::string>();
-        const std::string qty_str   = lvl.at(1).get<std::string>();
-
-        double price = std::stod(price_str);
-        double qty   = std::stod(qty_str);
-
-        if (qty == 0.0) {
-            lvl_book.bids.erase(price);
-        } else {
-            lvl_book.bids[price] = qty;
-        }
-    }
-
-    for (const auto& lvl : asks) {
-        const std::string price_str = lvl.at(0).get<std::string>();
-        const std::string qty_str   = lvl.at(1).get<std::string>();
-
-        double price = std::stod(price_str);
-        double qty   = std::stod(qty_str);
-
-        if (qty == 0.0) {
-            lvl_book.asks.erase(price);
-        } else {
-            lvl_book.asks[price] = qty;
-        }
-    }
-}
-
-// Rebuild your trading::OrderBook from SimpleLevelBook
-void build_order_book_from_levels(trading::OrderBook& book,
-                                  const SimpleLevelBook& lvl_book)
-{
-    // simplest reset: assign a fresh empty book
-    book = trading::OrderBook{};
-
-    // bids
-    for (const auto& [price, qty] : lvl_book.bids) {
-        auto p = to_price_ticks(price);
-        auto q = to_qty_ticks(qty);
-        if (q > 0) {
-            book.add_limit_order(trading::Side::Buy, p, q);
-        }
-    }
-
-    // asks
-    for (const auto& [price, qty] : lvl_book.asks) {
-        auto p = to_price_ticks(price);
-        auto q = to_qty_ticks(qty);
-        if (q > 0) {
-            book.add_limit_order(trading::Side::Sell, p, q);
-        }
+    print_histogram("Processing time (handler):", s.process_ns, "ns");
+    print_histogram("Receive -> dispatch (I/O thread -> book thread queue):", s.dispatch_ns, "ns");
+    print_histogram("Data latency (local_recv_ms - msg.ts_ms):", s.data_latency_ms, "ms");
+    if (s.clock_skew != 0) {
+        std::cout << "  (" << s.clock_skew << " messages stamped ahead of the local clock, counted as 0 ms)\n";
     }
 }
 
-
-void print_best(const trading::OrderBook& book, const char* tag)
+void print_best(const trading::LevelBook& book, const char* tag)
 {
     auto bb = book.best_bid();
     auto ba = book.best_ask();
@@ -208,31 +106,62 @@ void print_best(const trading::OrderBook& book, const char* tag)
     std::cout << tag << " "
               << "best bid=";
     if (bb.valid) {
-        std::cout << from_price_ticks(bb.price)
+        std::cout << Ticks::from_price_ticks(bb.price)
                   << " x "
-                  << from_qty_ticks(bb.qty);
+                  << Ticks::from_qty_ticks(bb.qty);
     } else {
         std::cout << "none";
     }
 
     std::cout << ", best ask=";
     if (ba.valid) {
-        std::cout << from_price_ticks(ba.price)
+        std::cout << Ticks::from_price_ticks(ba.price)
                   << " x "
-                  << from_qty_ticks(ba.qty);
+                  << Ticks::from_qty_ticks(ba.qty);
     } else {
         std::cout << "none";
     }
     std::cout << "\n";
 }
 
+// One subscribed symbol: its book and the sequence tracker feeding it.
+// Bybit levels go straight into the level book in ticks (fast-path parser);
+// snapshot -> clear() + set every level, delta -> only the changed levels.
+struct SymbolFeed {
+    std::string             symbol;
+    trading::LevelBook      book{256}; // orderbook.50: 50 levels per side; leave room for transient extras
+    exchange::BybitBookSync sync{book};
+    std::uint32_t           connection = 0;
+
+    // REST resync retries (stale snapshot / failed fetch): exponential
+    // backoff, the same schedule as the WS session's reconnects.
+    std::chrono::milliseconds resync_backoff{0};
+    SteadyClock::time_point   resync_not_before{};
+    std::uint64_t             resync_retries = 0;
+
+    explicit SymbolFeed(std::string s) : symbol(std::move(s)) {}
+};
+
+std::vector<std::string> split_symbols(const std::string& list)
+{
+    std::vector<std::string> out;
+    std::istringstream       in(list);
+    for (std::string item; std::getline(in, item, ',');) {
+        if (!item.empty()) {
+            out.push_back(item);
+        }
+    }
+    return out;
+}
+
 } // namespace
 
 int main(int argc, char** argv)
 {
-    std::string symbol = "BTCUSDT";
+    // Comma-separated: BTCUSDT,ETHUSDT,SOLUSDT share one socket.
+    std::vector<std::string> symbols = {"BTCUSDT"};
     if (argc > 1) {
-        symbol = argv[1];
+        symbols = split_symbols(argv[1]);
     }
 
     int max_messages = 0; // 0 = run until Ctrl+C
@@ -240,90 +169,176 @@ int main(int argc, char** argv)
         max_messages = std::stoi(argv[2]);
     }
 
-    std::cout << "Connecting to Bybit WS orderbook for " << symbol
+    std::cout << "Connecting to Bybit WS orderbook for " << symbols.size() << " symbol(s)"
               << ", max_messages=" << max_messages << " (0 = infinite)...\n";
 
     exchange::BybitPublicWs client;
 
-    SimpleLevelBook lvl_book;
-    trading::OrderBook book;
-    bool snapshot_ready = false;
-
     LiveStats stats;
 
-    std::string expected_topic = "orderbook.50." + symbol;
-
-    auto on_message = [&](const json& msg) {
-        // 1) отметим время и local now в мс
-        auto t_start = SteadyClock::now();
-        auto now_ms  = std::chrono::duration_cast<std::chrono::milliseconds>(
-                        SysClock::now().time_since_epoch())
-                        .count();
-
-        long long msg_ts_ms = 0;
-        if (msg.contains("ts") && msg["ts"].is_number_integer()) {
-            msg_ts_ms = msg["ts"].get<long long>();
-        } else if (msg.contains("cts") && msg["cts"].is_number_integer()) {
-            // fallback, если потребуется
-            msg_ts_ms = msg["cts"].get<long long>();
+    // Stable addresses: the router handlers keep a pointer to their feed.
+    std::vector<std::unique_ptr<SymbolFeed>> feeds;
+    exchange::BybitTopicRouter               router;
+
+    // Runs on the book (main) thread; the session's I/O thread only reads
+    // frames into its queue. The router has already matched the topic.
+    auto on_book_frame = [&](SymbolFeed& feed, std::string_view frame, const exchange::WsFrameInfo& info) {
+        // 1) отметим время и local time приёма фрейма в мс
+        auto t_start   = SteadyClock::now();
+        auto sys_now   = SysClock::now() - std::chrono::nanoseconds(info.dispatch_latency_ns);
+        auto now_ms    = std::chrono::duration_cast<std::chrono::milliseconds>(
+                          sys_now.time_since_epoch())
+                          .count();
+
+        // Новое соединение: u начинается заново со снапшота подписки.
+        if (info.connection != feed.connection) {
+            feed.connection = info.connection;
+            feed.sync.reset();
         }
-        double latency_ms = 0.0;
-        if (msg_ts_ms > 0) {
-            latency_ms = static_cast<double>(now_ms - msg_ts_ms);
+
+        // Заголовок (ts/type/u/seq) парсится вместе с уровнями, за один проход.
+        exchange::BybitBookSync& sync = feed.sync;
+        exchange::BybitParseStatus status;
+        {
+            TRADING_TRACE_SCOPE("parse+book");
+            status = exchange::parse_bybit_message(frame, kScale, sync);
         }
-        
-        if (!msg.contains("topic")) return;
 
-        const std::string topic = msg.value("topic", "");
-        if (topic != expected_topic) {
+        if (status != exchange::BybitParseStatus::Ok) {
+            std::cerr << "[WS] unexpected frame on " << feed.symbol << ": " << frame << "\n";
             return;
         }
+        if (!sync.applied()) {
+            return; // delta до снапшота / во время resync (в буфер) / устаревшая
+        }
 
-        const std::string type = msg.value("type", "");
-        const auto& data = msg.at("data");
-
-        if (type == "snapshot") {
-            build_level_book_from_snapshot(lvl_book, data);
-            build_order_book_from_levels(book, lvl_book);
-            snapshot_ready = true;
-            // 3) фиксируем время обработки
-            auto t_end   = SteadyClock::now();
-            double proc_ns =
-                std::chrono::duration_cast<std::chrono::nanoseconds>(t_end - t_start)
-                    .count();
-
-            stats.add(proc_ns, latency_ms, true);
-            if (kVerbosePrint) {
-                print_best(book, "[SNAPSHOT]");
-            }
-        } else if (type == "delta") {
-            if (!snapshot_ready) {
-                // Bybit гарантирует сначала снапшот, но подстрахуемся
+        const exchange::BybitMessageHeader& last = sync.last();
+        const long long msg_ts_ms = last.ts_ms > 0 ? last.ts_ms : last.cts_ms;
+        long long latency_ms = 0;
+        if (msg_ts_ms > 0) {
+            latency_ms = static_cast<long long>(now_ms - msg_ts_ms);
+        }
+
+        const bool is_snapshot = last.kind == exchange::BybitMessageKind::OrderbookSnapshot;
+
+        // 3) фиксируем время обработки
+        auto t_end   = SteadyClock::now();
+        auto proc_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t_end - t_start)
+                .count();
+
+        stats.add(static_cast<std::uint64_t>(proc_ns),
+                  static_cast<std::uint64_t>(info.dispatch_latency_ns), latency_ms, is_snapshot);
+        if (kVerbosePrint) {
+            print_best(feed.book, is_snapshot ? "[SNAPSHOT]" : "[DELTA]");
+        }
+    };
+
+    for (const std::string& symbol : symbols) {
+        feeds.push_back(std::make_unique<SymbolFeed>(symbol));
+        SymbolFeed* feed = feeds.back().get();
+        router.add("orderbook.50." + symbol,
+                   [&on_book_frame, feed](exchange::TopicId, std::string_view frame, const exchange::WsFrameInfo& info) {
+                       on_book_frame(*feed, frame, info);
+                   });
+    }
+
+    // Служебные сообщения (subscribe ack, pong): медленный DOM-путь.
+    router.set_fallback([](std::string_view frame, const exchange::WsFrameInfo&) {
+        TRADING_TRACE_SCOPE("json.control");
+        const json msg = json::parse(frame, nullptr, /*allow_exceptions=*/false);
+        if (msg.is_object() && msg.contains("success") && !msg.value("success", true)) {
+            std::cerr << "[WS] request failed: " << msg.dump() << "\n";
+        }
+    });
+
+    // Resync after a sequence gap: REST snapshot on a helper thread while the
+    // book thread keeps draining the socket (the tracker buffers the deltas).
+    // One fetch in flight; the client is warmed up now, so the TCP / TLS
+    // connection is already open when the first gap happens.
+    exchange::BybitPublicRest rest;
+    try {
+        rest.get_server_time_ms();
+    } catch (const std::exception& ex) {
+        std::cerr << "[REST] warm-up failed: " << ex.what() << "\n";
+    }
+
+    std::future<exchange::OrderBookSnapshot> resync_fetch;
+    SymbolFeed*                              resync_feed = nullptr;
+    const exchange::WsSessionOptions         session_options;
+
+    auto service_resync = [&] {
+        if (resync_feed) {
+            if (resync_fetch.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
                 return;
             }
-            apply_level_book_delta(lvl_book, data);
-            build_order_book_from_levels(book, lvl_book);
-            // 3) фиксируем время обработки
-            auto t_end   = SteadyClock::now();
-            double proc_ns =
-                std::chrono::duration_cast<std::chrono::nanoseconds>(t_end - t_start)
-                    .count();
-
-            stats.add(proc_ns, latency_ms, false);
-            if (kVerbosePrint) {
-                print_best(book, "[DELTA]");
+            SymbolFeed& feed = *resync_feed;
+            resync_feed      = nullptr;
+            try {
+                feed.sync.apply_snapshot(resync_fetch.get(), kScale);
+            } catch (const std::exception& ex) {
+                std::cerr << "[REST] resync " << feed.symbol << " failed: " << ex.what() << "\n";
+            }
+            if (feed.sync.state() == exchange::BookSyncState::Live) {
+                feed.resync_backoff = std::chrono::milliseconds{0};
+            } else {
+                // Still Resyncing (stale snapshot, error): not before the backoff.
+                feed.resync_backoff = feed.resync_backoff.count() == 0
+                                          ? session_options.backoff_initial
+                                          : std::min(feed.resync_backoff * 2, session_options.backoff_max);
+                feed.resync_not_before = SteadyClock::now() + feed.resync_backoff;
+                ++feed.resync_retries;
+                std::cerr << "[REST] resync " << feed.symbol << " retry in " << feed.resync_backoff.count()
+                          << " ms\n";
+            }
+        }
+        const auto now = SteadyClock::now();
+        for (const auto& feed : feeds) {
+            if (feed->sync.state() == exchange::BookSyncState::Resyncing && now >= feed->resync_not_before) {
+                resync_feed  = feed.get();
+                resync_fetch = std::async(std::launch::async, [&rest, symbol = feed->symbol] {
+                    return rest.get_spot_orderbook_snapshot(symbol, 50);
+                });
+                return;
             }
         }
-
     };
 
-    std::vector<std::string> topics = {
-        "orderbook.50." + symbol
-    };
+    // Persistent session: I/O (with reconnects) on its own thread, book
+    // updates here. Every registered topic is subscribed (10 per request).
+    client.start(router, session_options);
 
-    client.run(topics, on_message, max_messages);
+    const auto limit = static_cast<std::size_t>(max_messages > 0 ? max_messages : 0);
+    while (limit == 0 || stats.messages() < limit) {
+        service_resync();
+        if (client.poll(router, 64) == 0) {
+            if (!client.running()) {
+                break;
+            }
+            TRADING_TRACE_FLUSH(); // idle: drain the trace rings
+            std::this_thread::yield();
+        }
+    }
+    client.stop();
+    if (resync_feed) {
+        resync_fetch.wait();
+    }
 
-    print_stats(stats);
+    print_stats(stats, client.stats());
+    const exchange::TopicRouterStats& rs = router.stats();
+    std::cout << "Router: topics=" << router.size() << ", routed=" << rs.routed
+              << ", control=" << rs.control << ", unrouted=" << rs.unrouted << "\n";
+    for (const auto& feed : feeds) {
+        const exchange::BookSyncStats& ss = feed->sync.stats();
+        std::cout << feed->symbol << ": last u=" << feed->sync.last_update_id()
+                  << ", snapshots=" << ss.snapshots << ", deltas=" << ss.deltas
+                  << ", gaps=" << ss.gaps << ", stale=" << ss.stale_deltas
+                  << ", buffered=" << ss.buffered << ", replayed=" << ss.replayed
+                  << ", overflows=" << ss.buffer_overflows << ", resync_retries=" << feed->resync_retries
+                  << "\n";
+        print_best(feed->book, feed->symbol.c_str());
+    }
+    TRADING_TRACE_REPORT(std::cout);
 
     std::cout << "Done.\n";
     return 0;
@@ -1,22 +1,27 @@
 // app/bybit_ws_trades_main.cpp
 #include "exchange/bybit_public_ws.hpp"
+#include "exchange/bybit_ws_parser.hpp"
+#include "utils/decimal.hpp"
 
 #include <nlohmann/json.hpp>
 
 #include <cstdint>
 #include <cstdlib>
+#include <functional>
+#include <limits>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 using json = nlohmann::json;
 
 struct PublicTrade {
-    std::string  symbol;
-    double       price = 0.0;
-    double       qty   = 0.0;
-    std::int64_t ts_ms = 0;
-    bool         is_buy = false; // true = buy, false = sell
+    std::string_view symbol;      // view into the WS frame
+    double           price = 0.0;
+    double           qty   = 0.0;
+    std::int64_t     ts_ms = 0;
+    bool             is_buy = false; // taker side: true = buy, false = sell
 };
 
 struct TradeStats {
@@ -37,66 +42,22 @@ struct TradeStats {
     }
 };
 
-void handle_public_trade_message(const json& msg,
-                                 const std::function<void(const PublicTrade&)>& on_trade)
-{
-    // Ожидаем, что data — это массив трейдов.
-    if (!msg.contains("data")) {
-        return;
-    }
-
-    const auto& data = msg.at("data");
-
-    // Bybit v5 publicTrade возвращает массив объектов.
-    if (!data.is_array()) {
-        return;
-    }
+// Fast path: publicTrade frames are decoded in place into ticks, then
+// converted to doubles for printing.
+struct TradeHandler : exchange::BybitHandlerBase {
+    exchange::BybitScale                     scale;
+    std::function<void(const PublicTrade&)> on_trade_cb;
 
-    for (const auto& tr : data) {
+    void on_trade(const exchange::BybitMessageHeader& h, const exchange::BybitTrade& tr) {
         PublicTrade t;
-
-        // symbol: либо в самом объекте tr["s"], либо fallback
-        t.symbol = tr.value("s", std::string{});
-
-        // price
-        std::string p_str = tr.value("p", std::string{});
-        if (!p_str.empty()) {
-            try {
-                t.price = std::stod(p_str);
-            } catch (...) {
-                t.price = 0.0;
-            }
-        }
-
-        // qty: иногда "q", иногда "v" — подстраховываемся
-        std::string q_str;
-        if (tr.contains("q")) {
-            q_str = tr.at("q").get<std::string>();
-        } else if (tr.contains("v")) {
-            q_str = tr.at("v").get<std::string>();
-        } else {
-            q_str = "0";
-        }
-
-        if (!q_str.empty()) {
-            try {
-                t.qty = std::stod(q_str);
-            } catch (...) {
-                t.qty = 0.0;
-            }
-        }
-
-        // timestamp
-        t.ts_ms = tr.value("T", 0LL);
-
-        // side: Bybit обычно даёт m = isBuyerMaker
-        // m == true → maker is seller → агрессивная сторона buy
-        bool m = tr.value("m", false);
-        t.is_buy = !m;
-
-        on_trade(t);
+        t.symbol = h.symbol;
+        t.price  = static_cast<double>(tr.price) / static_cast<double>(utils::kPow10[scale.price_decimals]);
+        t.qty    = static_cast<double>(tr.qty)   / static_cast<double>(utils::kPow10[scale.qty_decimals]);
+        t.ts_ms  = tr.ts_ms;
+        t.is_buy = tr.taker_side == trading::Side::Buy;
+        on_trade_cb(t);
     }
-}
+};
 
 int main(int argc, char** argv) {
     std::string symbol       = "BTCUSDT";
@@ -110,6 +71,19 @@ int main(int argc, char** argv) {
         max_messages = std::atoi(argv[2]);
     }
 
+    // Tick scale of the instrument (BTCUSDT spot: price 0.01, qty 1e-6).
+    exchange::BybitScale scale{2, 6};
+    if (argc >= 4) {
+        scale.price_decimals = static_cast<unsigned>(std::atoi(argv[3]));
+    }
+    if (argc >= 5) {
+        scale.qty_decimals = static_cast<unsigned>(std::atoi(argv[4]));
+    }
+    if (scale.price_decimals > utils::kMaxDecimals || scale.qty_decimals > utils::kMaxDecimals) {
+        std::cerr << "decimals must be <= " << utils::kMaxDecimals << "\n";
+        return 1;
+    }
+
     const std::string channel = "publicTrade." + symbol;
     std::vector<std::string> channels{channel};
 
@@ -120,37 +94,36 @@ int main(int argc, char** argv) {
 
     TradeStats stats;
 
-    auto on_message = [&](const json& msg) {
-        // 1. Игнорируем служебные сообщения (success/subscribe и т.п.)
-        if (msg.contains("success") && msg.contains("op")) {
-            if (print_raw_non_trade) {
-                std::cout << "[sub-ack] " << msg.dump() << "\n";
-            }
-            return;
-        }
+    TradeHandler handler;
+    handler.scale       = scale;
+    handler.on_trade_cb = [&](const PublicTrade& t) {
+        stats.update(t);
+        std::cout << "Trade: " << t.symbol
+                << " price=" << t.price
+                << " qty="   << t.qty
+                << " ts_ms=" << t.ts_ms
+                << " side="  << (t.is_buy ? "BUY" : "SELL")
+                << "\n";
+    };
 
-        // 2. Интересуют только publicTrade.*
-        const std::string topic = msg.value("topic", "");
-        if (topic.rfind("publicTrade.", 0) != 0) {
-            if (print_raw_non_trade) {
-                std::cout << "[non-trade] " << msg.dump() << "\n";
-            }
+    auto on_frame = [&](std::string_view frame) {
+        const auto status = exchange::parse_bybit_message(frame, scale, handler);
+        if (status == exchange::BybitParseStatus::Ok) {
             return;
         }
 
-        // 3. Передаём JSON в наш обработчик, а тот уже вытащит все trades
-        handle_public_trade_message(msg, [&](const PublicTrade& t) {
-            stats.update(t);
-            std::cout << "Trade: " << t.symbol
-                    << " price=" << t.price
-                    << " qty="   << t.qty
-                    << " ts_ms=" << t.ts_ms
-                    << " side="  << (t.is_buy ? "BUY" : "SELL")
-                    << "\n";
-        });
+        // Служебные сообщения (success/subscribe и т.п.) и чужие топики:
+        // DOM-путь, только для печати.
+        if (print_raw_non_trade) {
+            const json msg = json::parse(frame, nullptr, /*allow_exceptions=*/false);
+            const char* tag = status == exchange::BybitParseStatus::Control ? "[sub-ack] "
+                            : status == exchange::BybitParseStatus::Error   ? "[malformed] "
+                                                                             : "[non-trade] ";
+            std::cout << tag << (msg.is_discarded() ? std::string(frame) : msg.dump()) << "\n";
+        }
     };
 
-    client.run(channels, on_message, max_messages);
+    client.run_raw(channels, on_frame, max_messages);
 
     std::cout << "\nSummary for " << symbol << ":\n"
           << "  trades:     " << stats.count << "\n"
@@ -0,0 +1,65 @@
+#include "trading/event_csv.hpp"
+#include "trading/event_log.hpp"
+#include "utils/line_reader.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+using namespace trading;
+
+// CSV (replay format) -> binary event log for trading_replay's mmap mode.
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: trading_csv_to_bin <in.csv> <out.bin> [price_decimals] [qty_decimals]\n"
+                     "  decimals are stored in the log header (tick scale of the integer prices/qty)\n";
+        return 1;
+    }
+
+    utils::LineReader in(argv[1]);
+    if (in.failed()) {
+        std::cerr << "Failed to open: " << argv[1] << "\n";
+        return 1;
+    }
+
+    EventLogScale scale;
+    if (argc > 3) {
+        scale.price_decimals = static_cast<std::uint32_t>(std::strtoul(argv[3], nullptr, 10));
+    }
+    if (argc > 4) {
+        scale.qty_decimals = static_cast<std::uint32_t>(std::strtoul(argv[4], nullptr, 10));
+    }
+
+    std::size_t skipped = 0;
+    try {
+        EventLogWriter out(argv[2], scale);
+
+        std::string_view line;
+        Event            ev;
+        while (in.next(line)) {
+            const CsvParseStatus status = parse_csv_event(line, ev);
+            if (status == CsvParseStatus::Ok) {
+                out.write(ev);
+            } else if (status == CsvParseStatus::Error) {
+                if (skipped++ < 10) {
+                    std::cerr << "line " << in.line_number() << ": malformed: " << line << "\n";
+                }
+            }
+        }
+        out.close();
+        if (in.failed()) {
+            std::cerr << "Read error: " << argv[1] << "\n";
+            return 1;
+        }
+
+        std::cout << "csv_to_bin: wrote " << out.count() << " events to " << argv[2]
+                  << " (skipped " << skipped << " malformed lines)\n";
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+// app/feed_source.hpp
+// Message sources shared by trading_ws_orderbook_snapshot and trading_live_feed:
+//   source=stdin      lines from a Python bridge over a pipe (default);
+//   source=ws         in-process exchange::BybitPublicWs session, raw frames;
+//   source=shm:NAME   utils::ShmRing created here, filled by an external
+//                     producer (tools/*.py --shm NAME), messages read in place.
+#pragma once
+
+#include "exchange/bybit_public_ws.hpp"
+#include "utils/latency_histogram.hpp"
+#include "utils/line_reader.hpp"
+#include "utils/shm_ring.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+namespace feed_source {
+
+enum class Kind : std::uint8_t { Stdin, Ws, Shm };
+
+struct Options {
+    Kind        kind = Kind::Stdin;
+    std::string shm_name;
+    std::size_t shm_bytes = std::size_t{1} << 22;
+};
+
+// Value of a source= option.
+inline bool parse(std::string_view value, Options& out) {
+    if (value == "stdin") {
+        out.kind = Kind::Stdin;
+    } else if (value == "ws") {
+        out.kind = Kind::Ws;
+    } else if (value.rfind("shm:", 0) == 0 && value.size() > 4) {
+        out.kind     = Kind::Shm;
+        out.shm_name = std::string(value.substr(4));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+inline const char* name(Kind kind) {
+    switch (kind) {
+    case Kind::Stdin: return "stdin pipe";
+    case Kind::Ws:    return "in-process WS";
+    case Kind::Shm:   return "shared-memory ring";
+    }
+    return "?";
+}
+
+// Wall clock in ns: exchange timestamps are epoch based.
+inline std::int64_t wall_now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// End-to-end latency: exchange timestamp -> message available in this
+// process, in µs. The same metric for every source, so runs compare.
+struct E2eLatency {
+    utils::LatencyHistogram us;
+    std::size_t             clock_skew = 0; // stamped ahead of the local clock
+
+    void record(std::int64_t exchange_ts_ns, std::int64_t local_ns) {
+        const std::int64_t d = local_ns - exchange_ts_ns;
+        if (d < 0) {
+            ++clock_skew;
+        }
+        us.record(static_cast<std::uint64_t>(d < 0 ? 0 : d / 1000));
+    }
+
+    void print(Kind kind) const {
+        std::cout << "End-to-end latency (exchange ts -> in process, " << name(kind) << "):\n";
+        if (us.count() == 0) {
+            std::cout << "  no samples\n";
+            return;
+        }
+        std::cout << "  samples: " << us.count() << "\n";
+        std::cout << "  mean   : " << us.mean() << " us\n";
+        std::cout << "  p50    : " << us.percentile(0.50) << " us\n";
+        std::cout << "  p99    : " << us.percentile(0.99) << " us\n";
+        std::cout << "  max    : " << us.max() << " us\n";
+        if (clock_skew != 0) {
+            std::cout << "  (" << clock_skew << " stamped ahead of the local clock, counted as 0)\n";
+        }
+    }
+};
+
+// Call on_msg(std::string_view msg) for each message until it returns false
+// or the source ends (EOF, producer closed the ring, WS session gave up).
+// ws_topics is the subscription of the WS source. The view is valid only
+// during the call.
+template <typename OnMsg>
+void run(const Options& opts, const std::vector<std::string>& ws_topics, OnMsg&& on_msg) {
+    switch (opts.kind) {
+    case Kind::Stdin: {
+        utils::LineReader in(STDIN_FILENO);
+        std::string_view  line;
+        while (in.next(line)) {
+            if (!on_msg(line)) {
+                return;
+            }
+        }
+        return;
+    }
+    case Kind::Shm: {
+        utils::ShmRing ring(opts.shm_name, opts.shm_bytes);
+        std::cerr << "Waiting for a producer on shared memory ring " << opts.shm_name << "...\n";
+        std::string_view msg;
+        for (;;) {
+            if (ring.front(msg)) {
+                const bool more = on_msg(msg);
+                ring.pop();
+                if (!more) {
+                    return;
+                }
+                continue;
+            }
+            if (ring.closed() && !ring.front(msg)) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+    case Kind::Ws: {
+        exchange::BybitPublicWs ws;
+        ws.start(ws_topics);
+        bool more = true;
+        const exchange::BybitPublicWs::FrameHandler handler =
+            [&](std::string_view frame, const exchange::WsFrameInfo&) {
+                if (more) {
+                    more = on_msg(frame);
+                }
+            };
+        while (more) {
+            if (ws.poll(handler, 64) == 0) {
+                if (!ws.running()) {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        }
+        ws.stop();
+        return;
+    }
+    }
+}
+
+} // namespace feed_source
@@ -1,22 +1,96 @@
+#include "trading/event.hpp"
+#include "trading/event_log.hpp"
+#include "trading/types.hpp"
+
+#include <exception>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <vector>
 #include <string>
 #include <cstdint>
 
-using OrderId = std::uint64_t;
+using namespace trading;
+
+// Output: CSV on stdout (default) or a binary event log.
+class EventSink {
+public:
+    explicit EventSink(const char* bin_path) {
+        if (bin_path) {
+            log_ = std::make_unique<EventLogWriter>(bin_path);
+        } else {
+            // Комментарий-хедер (replay его пропустит, т.к. строка начинается с '#')
+            std::cout << "# type,side,price,qty,id\n";
+        }
+    }
+
+    void add(Side side, Price price, Quantity qty, OrderId id) {
+        if (log_) {
+            Event ev;
+            ev.type  = EventType::Add;
+            ev.side  = side;
+            ev.price = price;
+            ev.qty   = qty;
+            ev.id    = id;
+            log_->write(ev);
+        } else {
+            std::cout << "ADD," << side_str(side) << "," << price << "," << qty << "," << id << "\n";
+        }
+    }
 
-enum class Side { Buy, Sell };
+    void market(Side side, Quantity qty) {
+        if (log_) {
+            Event ev;
+            ev.type = EventType::Market;
+            ev.side = side;
+            ev.qty  = qty;
+            log_->write(ev);
+        } else {
+            std::cout << "MKT," << side_str(side) << "," << qty << "\n";
+        }
+    }
+
+    void cancel(OrderId id) {
+        if (log_) {
+            Event ev;
+            ev.type = EventType::Cancel;
+            ev.id   = id;
+            log_->write(ev);
+        } else {
+            std::cout << "CANCEL," << id << "\n";
+        }
+    }
+
+    void close() {
+        if (log_) {
+            log_->close();
+        }
+    }
+
+private:
+    static const char* side_str(Side side) { return side == Side::Buy ? "BUY" : "SELL"; }
+
+    std::unique_ptr<EventLogWriter> log_;
+};
 
 int main(int argc, char** argv) {
     if (argc < 3) {
-        std::cerr << "Usage: trading_generate <num_events> <seed>\n";
+        std::cerr << "Usage: trading_generate <num_events> <seed> [out.bin]\n"
+                     "  without out.bin the events are printed as CSV to stdout\n";
         return 1;
     }
 
     const std::size_t num_events = static_cast<std::size_t>(std::stoull(argv[1]));
     const std::uint32_t seed     = static_cast<std::uint32_t>(std::stoul(argv[2]));
 
+    std::unique_ptr<EventSink> sink;
+    try {
+        sink = std::make_unique<EventSink>(argc > 3 ? argv[3] : nullptr);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+
     std::mt19937_64 rng(seed);
 
     // Вероятности типов событий:
@@ -33,9 +107,6 @@ int main(int argc, char** argv) {
 
     OrderId next_id_for_cancel = 1; // логический счётчик ADD'ов
 
-    // Комментарий-хедер (replay его пропустит, т.к. строка начинается с '#')
-    std::cout << "# type,side,price,qty,id\n";
-
     for (std::size_t i = 0; i < num_events; ++i) {
         int r = event_type_dist(rng);
 
@@ -45,23 +116,23 @@ int main(int argc, char** argv) {
         if (force_add || r < 60) {
             // ADD
             int side_val = side_dist(rng);
-            std::string side_str = (side_val == 0) ? "BUY" : "SELL";
+            Side side = (side_val == 0) ? Side::Buy : Side::Sell;
             auto price = price_dist(rng);
             auto qty   = qty_dist(rng);
 
             // логический id ордера
             OrderId id = next_id_for_cancel++;
 
-            std::cout << "ADD," << side_str << "," << price << "," << qty << "," << id << "\n";
+            sink->add(side, price, qty, id);
 
             active_ids.push_back(id);
         } else if (r < 90) {
             // MKT
             int side_val = side_dist(rng);
-            std::string side_str = (side_val == 0) ? "BUY" : "SELL";
+            Side side = (side_val == 0) ? Side::Buy : Side::Sell;
             auto qty = qty_dist(rng);
 
-            std::cout << "MKT," << side_str << "," << qty << "\n";
+            sink->market(side, qty);
         } else {
             // CANCEL
             if (!active_ids.empty()) {
@@ -70,7 +141,7 @@ int main(int argc, char** argv) {
                 std::size_t idx = idx_dist(rng);
                 OrderId id = active_ids[idx];
 
-                std::cout << "CANCEL," << id << "\n";
+                sink->cancel(id);
 
                 // Убираем id, чтобы не отменять один и тот же много раз
                 active_ids[idx] = active_ids.back();
@@ -78,17 +149,23 @@ int main(int argc, char** argv) {
             } else {
                 // Нет активных ордеров — откат к ADD с корректным форматом
                 int side_val = side_dist(rng);
-                std::string side_str = (side_val == 0) ? "BUY" : "SELL";
+                Side side = (side_val == 0) ? Side::Buy : Side::Sell;
                 auto price = price_dist(rng);
                 auto qty   = qty_dist(rng);
 
                 OrderId id = next_id_for_cancel++;
 
-                std::cout << "ADD," << side_str << "," << price << "," << qty << "," << id << "\n";
+                sink->add(side, price, qty, id);
                 active_ids.push_back(id);
             }
         }
     }
 
+    try {
+        sink->close();
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
     return 0;
 }
@@ -1,150 +1,170 @@
+#include "exchange/bybit_ws_parser.hpp"
 #include "trading/order_book.hpp"
 #include "trading/event.hpp"
+#include "trading/event_csv.hpp"
 #include "trading/types.hpp"
-#include "utils/spsc_queue.hpp"
+#include "utils/cpu_affinity.hpp"
+#include "utils/spsc_queue_v2.hpp"
+#include "utils/wait_strategy.hpp"
+#include "feed_source.hpp"
 
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
-#include <sstream>
+#include <span>
 #include <string>
+#include <string_view>
 #include <thread>
+#include <vector>
 
 using namespace trading;
 
 namespace {
 
-// Simple line parser: ts_ns,type,side,price_int,qty_int
-bool parse_event_line(const std::string& line, Event& ev) {
-    if (line.empty()) return false;
-
-    std::stringstream ss(line);
-    std::string token;
-
-    std::string ts_str;
-    std::string type_str;
-    std::string side_str;
-    std::string price_str;
-    std::string qty_str;
-
-    if (!std::getline(ss, ts_str, ','))   return false;
-    if (!std::getline(ss, type_str, ',')) return false;
-    if (!std::getline(ss, side_str, ',')) return false;
-    if (!std::getline(ss, price_str, ','))return false;
-    if (!std::getline(ss, qty_str, ','))  return false;
-
-    try {
-        ev.ts_ns = std::stoll(ts_str);
-        // type
-        if (type_str == "T") {
-            ev.type = EventType::Market;
-        } else if (type_str == "A") {
-            ev.type = EventType::Add;
-        } else if (type_str == "C") {
-            ev.type = EventType::Cancel;
-        } else {
-            return false;
-        }
-
-        // side
-        if (!side_str.empty() && (side_str[0] == 'B' || side_str[0] == 'b')) {
-            ev.side = Side::Buy;
-        } else {
-            ev.side = Side::Sell;
-        }
+// Native WS mode: publicTrade frames -> the Events the Python bridge would
+// have printed (tools/bybit_ws_feed.py: price in 1e-2, qty in 1e-3, T in ns).
+constexpr exchange::BybitScale kTradeScale{2, 3};
 
-        ev.price = static_cast<Price>(std::stoll(price_str));
-        ev.qty   = static_cast<Quantity>(std::stoll(qty_str));
+template <typename Push>
+struct TradeToEvent : exchange::BybitHandlerBase {
+    Push& push;
 
-        // For now we do not support real CANCEL by id in the line format,
-        // so ev.id stays 0 (no-op for cancel).
-        ev.id = 0;
+    explicit TradeToEvent(Push& p) : push(p) {}
 
-    } catch (...) {
-        return false;
+    void on_trade(const exchange::BybitMessageHeader&, const exchange::BybitTrade& t) {
+        Event ev;
+        ev.type  = EventType::Market;
+        ev.side  = t.taker_side;
+        ev.price = t.price;
+        ev.qty   = t.qty;
+        ev.ts_ns = t.ts_ms * 1'000'000;
+        push(ev);
     }
-
-    return true;
-}
+};
 
 } // namespace
 
 int main(int argc, char** argv) {
-    // Optional limit: max events to read, 0 = unlimited.
-    std::size_t max_events = 0;
-    if (argc > 1) {
-        max_events = std::strtoull(argv[1], nullptr, 10);
+    // Optional limit: max events to read, 0 = unlimited; then key=value
+    // options: wait=spin|yield|park (engine idle strategy), engine_cpu=N,
+    // source=stdin|ws|shm:NAME (feed_source.hpp), symbol=BTCUSDT (ws).
+    std::size_t          max_events = 0;
+    utils::WaitMode      wait_mode  = utils::WaitMode::Yield;
+    int                  engine_cpu = -1;
+    feed_source::Options source;
+    std::string          symbol = "BTCUSDT";
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg.rfind("source=", 0) == 0) {
+            if (!feed_source::parse(arg.substr(7), source)) {
+                std::cerr << "Unknown source: " << arg.substr(7) << " (expected stdin, ws or shm:NAME)\n";
+                return 1;
+            }
+        } else if (arg.rfind("symbol=", 0) == 0) {
+            symbol = std::string(arg.substr(7));
+        } else if (arg.rfind("wait=", 0) == 0) {
+            if (!utils::parse_wait_mode(arg.substr(5), wait_mode)) {
+                std::cerr << "Unknown wait mode: " << arg.substr(5) << " (expected spin, yield or park)\n";
+                return 1;
+            }
+        } else if (arg.rfind("engine_cpu=", 0) == 0) {
+            if (!utils::parse_cpu(arg.substr(11), engine_cpu)) {
+                std::cerr << "Bad cpu index: " << arg << "\n";
+                return 1;
+            }
+        } else {
+            max_events = std::strtoull(argv[i], nullptr, 10);
+        }
     }
 
     constexpr std::size_t QUEUE_CAPACITY = 4096;
-    utils::SpscQueue<Event> queue(QUEUE_CAPACITY);
+    utils::SpscQueueV2<Event> queue(QUEUE_CAPACITY);
 
     std::atomic<bool> done{false};
     std::atomic<std::size_t> processed{0};
     OrderBook book;
 
-    // Engine thread: consume events and apply to OrderBook
+    // Engine thread: drain whatever is queued (up to BATCH_SIZE) and apply
+    // it to the OrderBook in one call. Cancels carry no id in the current
+    // line format (id 0), so they miss; adds get book-generated ids.
+    constexpr std::size_t BATCH_SIZE = 256;
+    utils::WakeSignal items_ready;
     std::thread engine_thread([&]() {
-        Event ev;
+        if (!utils::pin_current_thread(engine_cpu)) {
+            std::cerr << "live_feed: cannot pin engine to cpu " << engine_cpu << "\n";
+        }
+        utils::Waiter waiter(wait_mode, &items_ready);
+        const auto    has_data = [&] {
+            return !queue.empty() || done.load(std::memory_order_acquire);
+        };
+
+        std::vector<Event> batch(BATCH_SIZE);
         while (!done.load(std::memory_order_acquire) || !queue.empty()) {
-            if (queue.pop(ev)) {
-                switch (ev.type) {
-                case EventType::Add:
-                    book.add_limit_order(ev.side, ev.price, ev.qty);
-                    break;
-                case EventType::Market:
-                    book.execute_market_order(ev.side, ev.qty);
-                    break;
-                case EventType::Cancel:
-                    // No real id in the current format -> ignore for now.
-                    // You can extend line format later to pass order_id.
-                    break;
-                case EventType::End:
-                    // Sentinel used by synthetic generators (mt_bench).
-                    // Live feed should never receive this, just ignore.
-                    break;
-                }
-
-                processed.fetch_add(1, std::memory_order_relaxed);
-            } else {
-                std::this_thread::yield();
+            const std::size_t n = queue.pop_bulk(batch.data(), BATCH_SIZE);
+            if (n == 0) {
+                waiter.idle(has_data);
+                continue;
             }
-        }
-    });
+            waiter.reset();
 
-    // Producer: read lines from stdin and push into SPSC queue
-    std::size_t read_count = 0;
-    std::string line;
-    while (std::getline(std::cin, line)) {
-        if (line.empty()) {
-            continue;
-        }
-        if (max_events > 0 && read_count >= max_events) {
-            break;
+            (void)book.apply(std::span<const Event>(batch.data(), n));
+            processed.fetch_add(n, std::memory_order_relaxed);
         }
+    });
 
-        Event ev;
-        if (!parse_event_line(line, ev)) {
-            continue;
-        }
+    // Producer: messages from the source (stdin lines parsed in place, ring
+    // records read in shared memory, or WS frames), pushed into the SPSC queue.
+    std::size_t             read_count = 0;
+    std::size_t             bad_lines  = 0;
+    feed_source::E2eLatency latency;
+    Event                   ev;
 
+    const auto push = [&](const Event& e) {
+        latency.record(e.ts_ns, feed_source::wall_now_ns());
         ++read_count;
         // Backpressure: if queue is full, yield until there is space
-        while (!queue.push(ev)) {
+        while (!queue.push(e)) {
             std::this_thread::yield();
         }
-    }
+        if (wait_mode == utils::WaitMode::Park) {
+            items_ready.notify(); // fence + load: only worth it when the engine may sleep
+        }
+    };
+    const auto limit_reached = [&] { return max_events > 0 && read_count >= max_events; };
+
+    TradeToEvent<decltype(push)> trades(push);
+    feed_source::run(source, {"publicTrade." + symbol}, [&](std::string_view msg) {
+        if (source.kind == feed_source::Kind::Ws) {
+            // Trades straight from the frame; acks / pongs are Control.
+            const auto status = exchange::parse_bybit_message(msg, kTradeScale, trades);
+            bad_lines += status == exchange::BybitParseStatus::Error;
+            return !limit_reached(); // a frame may carry several trades
+        }
+
+        const CsvParseStatus status = parse_feed_event(msg, ev);
+        if (status != CsvParseStatus::Ok) {
+            bad_lines += status == CsvParseStatus::Error;
+            return true;
+        }
+        push(ev);
+        return !limit_reached();
+    });
 
     done.store(true, std::memory_order_release);
+    items_ready.notify();
     engine_thread.join();
 
     auto best_bid = book.best_bid();
     auto best_ask = book.best_ask();
 
     std::cout << "Live feed summary:\n";
-    std::cout << "  lines read:      " << read_count << "\n";
+    std::cout << "  source:          " << feed_source::name(source.kind) << "\n";
+    std::cout << "  events read:     " << read_count << "\n";
+    if (bad_lines > 0) {
+        std::cout << "  bad messages:    " << bad_lines << "\n";
+    }
     std::cout << "  events processed:" << processed.load() << "\n";
 
     std::cout << "  final best bid:  ";
@@ -161,5 +181,7 @@ int main(int argc, char** argv) {
         std::cout << "none\n";
     }
 
+    latency.print(source.kind);
+
     return 0;
 }
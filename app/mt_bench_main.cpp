@@ -1,45 +1,38 @@
 #include "trading/event.hpp"
 #include "trading/order_book.hpp"
+#include "trading/quote_publisher.hpp"
+#include "trading/sharded_engine.hpp"
 #include "trading/types.hpp"
+#include "utils/cpu_affinity.hpp"
+#include "utils/latency_histogram.hpp"
 #include "utils/spsc_queue.hpp"
+#include "utils/spsc_queue_v2.hpp"
+#include "utils/tsc_timer.hpp"
+#include "utils/wait_strategy.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <iostream>
 #include <random>
+#include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
 using namespace trading;
 
 using Clock      = std::chrono::steady_clock;
-using TimePoint  = Clock::time_point;
 using Nanoseconds = std::chrono::nanoseconds;
 
-/*class Backoff {
-public:
-    void pause() {
-        if (spins_ < kMaxSpins) {
-            ++spins_;
-            // Небольшой active spin: на x86 можно использовать _mm_pause(), 
-            // но можно и пустой цикл / asm volatile("" ::: "memory");
-        } else {
-            spins_ = 0;
-            std::this_thread::yield();
-        }
-    }
-
-private:
-    static constexpr int kMaxSpins = 100; // можно потом поиграться
-    int spins_ = 0;
-};*/
 
 
 struct TimedEvent {
     trading::Event ev;
     std::uint64_t  id;          // порядковый номер (0..num_events-1)
-    TimePoint      enqueue_ts;  // когда продюсер положил event в очередь
+    std::uint64_t  enqueue_tsc; // TSC, когда продюсер положил event в очередь
 };
 
 // Event generator
@@ -131,86 +124,182 @@ private:
 
 constexpr std::size_t QUEUE_CAPACITY = 4096;
 constexpr int K_WARMUP_EVENTS = 20000;
-
-int main(int argc, char** argv) {
-    if (argc < 3) {
-        std::cerr << "Usage: trading_mt_bench <num_events> <seed>\n";
-        return 1;
+constexpr std::size_t CONSUMER_BATCH = 64;
+
+// Pop up to max events into out. SpscQueueV2 moves the whole run with one
+// index store; SpscQueue pops them one by one.
+template <typename Queue>
+std::size_t drain(Queue& queue, TimedEvent* out, std::size_t max) {
+    if constexpr (requires { queue.pop_bulk(out, max); }) {
+        return queue.pop_bulk(out, max);
+    } else {
+        std::size_t n = 0;
+        while (n < max && queue.pop(out[n])) {
+            ++n;
+        }
+        return n;
     }
+}
 
-    const std::size_t num_events = static_cast<std::size_t>(std::stoull(argv[1]));
-    const std::uint32_t seed     = static_cast<std::uint32_t>(std::stoul(argv[2]));
+// Threading knobs: how both threads wait and where they run (-1 = unpinned).
+// shards > 0 switches to the multi-instrument ShardedEngine: the producer
+// becomes the router and consumer_cpu is the cpu of shard 0 (shard i: +i).
+struct PipelineOptions {
+    utils::WaitMode wait          = utils::WaitMode::Yield;
+    int             producer_cpu  = -1;
+    int             consumer_cpu  = -1;
+    std::size_t     shards        = 0;
+    std::size_t     instruments   = 1;
+    std::size_t     quote_readers = 0; // threads polling the published top of book (single book only)
+};
+
+// What one quote reader thread saw (written once, after its loop).
+struct QuoteReaderStats {
+    std::uint64_t reads   = 0; // consistent quotes copied
+    std::uint64_t updates = 0; // distinct publishes among them
+    std::uint64_t crossed = 0; // bid >= ask: would mean a torn / inconsistent quote
+};
+
+void pin_or_warn(const char* who, int cpu) {
+    if (!utils::pin_current_thread(cpu)) {
+        std::cerr << "mt_bench: cannot pin " << who << " to cpu " << cpu << "\n";
+    }
+}
 
+// Producer/consumer pipeline over one book backend (OrderBook or LadderOrderBook)
+// and one queue implementation (SpscQueue or SpscQueueV2).
+template <typename Book, typename Queue>
+void run_pipeline(std::size_t num_events, std::uint32_t seed, const PipelineOptions& options) {
     EventGenerator generator(num_events, seed);
 
     const std::size_t queue_capacity = QUEUE_CAPACITY;
-    utils::SpscQueue<TimedEvent> queue(queue_capacity);
+    Queue queue(queue_capacity);
 
-    OrderBook book;
+    // Ids are dense and bounded by num_events: preallocate so the consumer
+    // never hits the allocator while matching.
+    OrderBookConfig book_config;
+    book_config.max_orders = num_events;
+    Book book(book_config);
 
     std::atomic<bool> producer_done{false};
     std::atomic<std::size_t> consumed_count{0};
 
-    std::vector<long long> latencies_ns(num_events, 0);
+    // Park mode: the producer wakes the consumer after a push, the consumer
+    // wakes the producer after draining (queue was full).
+    utils::WakeSignal items_ready;
+    utils::WakeSignal space_ready;
+    const bool        parking = options.wait == utils::WaitMode::Park;
+
+    // Queue latency is stamped with the TSC (one rdtsc per side instead of
+    // two clock_gettime calls); ticks are converted to ns for the report.
+    const bench::TscInfo& tsc = bench::tsc_info();
+
+    // Written by the consumer only; read after join().
+    utils::LatencyHistogram latency_ticks;
+    std::uint64_t           tsc_backwards = 0; // consumer TSC behind producer's
+
+    // quote_readers > 0: after each batch the consumer publishes the top of
+    // book (ApplyStats::top, no extra book read) into a seqlock slot, and
+    // reader threads poll it the way strategy / risk threads would.
+    const bool                    publishing = options.quote_readers > 0;
+    trading::QuotePublisher<>     quotes;
+    std::atomic<bool>             readers_stop{false};
+    std::vector<QuoteReaderStats> reader_stats(options.quote_readers);
+    std::vector<std::thread>      readers;
+    for (std::size_t r = 0; r < options.quote_readers; ++r) {
+        readers.emplace_back([&, r] {
+            QuoteReaderStats st;
+            std::uint64_t    seen = 0;
+            while (!readers_stop.load(std::memory_order_relaxed)) {
+                if (quotes.update() == seen) {
+                    utils::cpu_relax(); // nothing new: one shared load
+                    continue;
+                }
+                const auto q = quotes.read();
+                ++st.reads;
+                if (q.update != seen) {
+                    ++st.updates;
+                    seen = q.update;
+                }
+                st.crossed += q.top.bid.valid && q.top.ask.valid && q.top.bid.price >= q.top.ask.price;
+            }
+            reader_stats[r] = st;
+        });
+    }
 
     auto start_time = Clock::now();
 
-    // consumer / matching thread
+    // consumer / matching thread: pops up to CONSUMER_BATCH queued events and
+    // applies them with one OrderBook::apply; its per-event hook stamps each
+    // event right after its own processing (enqueue -> processed, as with one
+    // pop per event; a stamp after the batch would add the later events' work).
     std::thread consumer_thread([&]() {
-        TimedEvent tev;
-        //Backoff backoff;
-        for (;;) {
-            // try read frrom queue
-            if (!queue.pop(tev)) {
-                if (producer_done.load(std::memory_order_acquire)) {
-                    if (queue.empty()) {
-                        break;
-                    }
+        pin_or_warn("consumer", options.consumer_cpu);
+        utils::Waiter waiter(options.wait, &items_ready);
+        const auto    has_data = [&] {
+            return !queue.empty() || producer_done.load(std::memory_order_acquire);
+        };
+
+        std::array<TimedEvent, CONSUMER_BATCH> pending;
+        std::vector<Event>                     batch;
+        batch.reserve(CONSUMER_BATCH);
+
+        // record processing time (warmup events are skipped)
+        const auto stamp = [&](std::size_t i) {
+            if (pending[i].id >= K_WARMUP_EVENTS) {
+                const std::uint64_t t1 = bench::detail::read_tsc();
+                const std::uint64_t t0 = pending[i].enqueue_tsc;
+                if (t1 >= t0) {
+                    latency_ticks.record(t1 - t0);
+                } else {
+                    ++tsc_backwards;
                 }
-                //backoff.pause();
-                std::this_thread::yield();
-                continue;
             }
-
-            const auto& ev = tev.ev;
-
-            if (ev.type == EventType::End) {
-                // end of event stream
-                break;
+        };
+
+        bool end_seen = false;
+        while (!end_seen) {
+            // try read from queue
+            std::size_t n = drain(queue, pending.data(), CONSUMER_BATCH);
+            // End is the last event ever pushed, so it can only close a batch.
+            if (n != 0 && pending[n - 1].ev.type == EventType::End) {
+                end_seen = true;
+                --n;
             }
 
-            // record processing time
-            auto t1 = Clock::now();
-            auto id = tev.id;
-            if (id < latencies_ns.size()) {
-                auto dt = std::chrono::duration_cast<Nanoseconds>(t1 - tev.enqueue_ts).count();
-                latencies_ns[static_cast<std::size_t>(id)] = dt;
+            if (n == 0) {
+                if (end_seen ||
+                    (producer_done.load(std::memory_order_acquire) && queue.empty())) {
+                    break;
+                }
+                waiter.idle(has_data);
+                continue;
+            }
+            waiter.reset();
+            if (parking) {
+                space_ready.notify();
             }
 
-            switch (ev.type) {
-            case EventType::Add:
-                book.add_limit_order_with_id(ev.id, ev.side, ev.price, ev.qty);
-                break;
-            case EventType::Market:
-                (void)book.execute_market_order(ev.side, ev.qty);
-                break;
-            case EventType::Cancel:
-                (void)book.cancel(ev.id);
-                break;
-            case EventType::End:
-                // already handled above
-                break;
+            for (std::size_t i = 0; i < n; ++i) {
+                batch.push_back(pending[i].ev);
+            }
+            const ApplyStats applied = book.apply(batch, NullFillSink{}, stamp);
+            if (publishing) {
+                quotes.publish(applied.top);
             }
 
-            consumed_count.fetch_add(1, std::memory_order_relaxed);
+            consumed_count.fetch_add(n, std::memory_order_relaxed);
+            batch.clear();
         }
     });
 
     // producer / feed thread
     std::thread producer_thread([&]() {
-        std::uint64_t next_id = 0;
+        pin_or_warn("producer", options.producer_cpu);
+        utils::Waiter waiter(options.wait, &space_ready);
+        const auto    has_space = [&] { return !queue.full(); };
 
-        //Backoff backoff;
+        std::uint64_t next_id = 0;
 
         for (;;) {
             trading::Event base_ev = generator.next();
@@ -220,19 +309,21 @@ int main(int argc, char** argv) {
 
             if (base_ev.type == EventType::End) {
                 // "end marker": id not required
-                tev.id         = static_cast<std::uint64_t>(-1);
-                tev.enqueue_ts = Clock::now(); // not so important, can be omitted
+                tev.id          = static_cast<std::uint64_t>(-1);
+                tev.enqueue_tsc = 0;
             } else {
-                tev.id         = next_id;
-                tev.enqueue_ts = Clock::now();
+                tev.id          = next_id;
+                tev.enqueue_tsc = bench::detail::read_tsc();
                 ++next_id;
             }
 
-            // push to queue (as before)
-            for (;;) {
-                if (queue.push(tev)) break;
-                //backoff.pause();
-                std::this_thread::yield();
+            // push to queue, waiting per options.wait while it is full
+            while (!queue.push(tev)) {
+                waiter.idle(has_space);
+            }
+            waiter.reset();
+            if (parking) {
+                items_ready.notify();
             }
 
             if (base_ev.type == EventType::End) {
@@ -241,12 +332,17 @@ int main(int argc, char** argv) {
         }
 
         producer_done.store(true, std::memory_order_release);
+        items_ready.notify();
     });
 
     producer_thread.join();
     consumer_thread.join();
 
     auto end_time = Clock::now();
+    readers_stop.store(true, std::memory_order_relaxed);
+    for (std::thread& t : readers) {
+        t.join();
+    }
     auto ns = std::chrono::duration_cast<Nanoseconds>(end_time - start_time).count();
 
     double seconds = static_cast<double>(ns) / 1e9;
@@ -261,34 +357,35 @@ int main(int argc, char** argv) {
         std::cout << "  mean:       " << ns_per_event << " ns/event\n";
     }
 
-    // === New: latency distribution ===
-    std::vector<long long> samples;
-    samples.reserve(processed);
-
-    // latencies_ns may be slightly longer (by num_events),
-    // and processed is the actual number of processed events.
-    // Just in case, take the min.
-    /*for (std::size_t i = 0; i < processed && i < latencies_ns.size(); ++i) {
-        samples.push_back(latencies_ns[i]);
-    }*/
-
-    // add warmup
-    for (std::size_t i = K_WARMUP_EVENTS; i < processed && i < latencies_ns.size(); ++i) {
-        samples.push_back(latencies_ns[i]);
+    if (!latency_ticks.empty()) {
+        const auto ns = [&](std::uint64_t ticks) {
+            return static_cast<double>(ticks) * tsc.ns_per_tick;
+        };
+        std::cout << "Latency (enqueue -> processed, " << latency_ticks.count() << " samples, TSC "
+                  << tsc.ghz << " GHz " << bench::to_string(tsc.source)
+                  << (tsc.invariant ? ", invariant" : ", NOT invariant") << "):\n";
+        std::cout << "  p50:    " << ns(latency_ticks.percentile(0.50)) << " ns\n";
+        std::cout << "  p95:    " << ns(latency_ticks.percentile(0.95)) << " ns\n";
+        std::cout << "  p99:    " << ns(latency_ticks.percentile(0.99)) << " ns\n";
+        std::cout << "  p99.9:  " << ns(latency_ticks.percentile(0.999)) << " ns\n";
+        std::cout << "  p99.99: " << ns(latency_ticks.percentile(0.9999)) << " ns\n";
+        std::cout << "  max:    " << ns(latency_ticks.max()) << " ns\n";
+    }
+    if (!tsc.invariant || tsc_backwards != 0) {
+        std::cout << "  warning: " << tsc_backwards << " samples with the consumer TSC behind the producer's"
+                  << (tsc.invariant ? "" : "; TSC is not invariant, cross-core latency is unreliable") << "\n";
     }
 
-    if (!samples.empty()) {
-        std::sort(samples.begin(), samples.end());
-        auto N = samples.size();
-
-        auto p50 = samples[static_cast<std::size_t>(0.50 * (N - 1))];
-        auto p95 = samples[static_cast<std::size_t>(0.95 * (N - 1))];
-        auto p99 = samples[static_cast<std::size_t>(0.99 * (N - 1))];
-
-        std::cout << "Latency (enqueue -> processed):\n";
-        std::cout << "  p50: " << p50 << " ns\n";
-        std::cout << "  p95: " << p95 << " ns\n";
-        std::cout << "  p99: " << p99 << " ns\n";
+    if (publishing) {
+        QuoteReaderStats total;
+        for (const QuoteReaderStats& st : reader_stats) {
+            total.reads += st.reads;
+            total.updates += st.updates;
+            total.crossed += st.crossed;
+        }
+        std::cout << "Published quotes: " << quotes.update() << " (one per batch), "
+                  << options.quote_readers << " reader(s): " << total.reads << " reads, "
+                  << total.updates << " distinct updates seen, " << total.crossed << " crossed\n";
     }
 
     auto bb = book.best_bid();
@@ -297,6 +394,193 @@ int main(int argc, char** argv) {
               << ", price=" << bb.price << ", qty=" << bb.qty << "\n";
     std::cout << "Final best ask valid=" << ba.valid
               << ", price=" << ba.price << ", qty=" << ba.qty << "\n";
+}
+
+// Sharded mode: one EventGenerator (and book) per instrument; the main thread
+// picks a random instrument per event and routes it into a ShardedEngine.
+template <typename Book>
+void run_sharded(std::size_t num_events, std::uint32_t seed, const PipelineOptions& options) {
+    const std::size_t instruments    = options.instruments;
+    const std::size_t per_instrument = (num_events + instruments - 1) / instruments;
+
+    std::vector<EventGenerator> generators;
+    generators.reserve(instruments);
+    for (std::size_t i = 0; i < instruments; ++i) {
+        generators.emplace_back(per_instrument, seed + static_cast<std::uint32_t>(i));
+    }
+
+    ShardedEngineConfig config;
+    config.shards             = options.shards;
+    config.instruments        = instruments;
+    config.queue_capacity     = QUEUE_CAPACITY;
+    config.batch_size         = CONSUMER_BATCH;
+    config.book.max_orders    = per_instrument;
+    config.wait               = options.wait;
+    if (options.consumer_cpu >= 0) {
+        for (std::size_t i = 0; i < options.shards; ++i) {
+            config.shard_cpus.push_back(options.consumer_cpu + static_cast<int>(i));
+        }
+    }
+    BasicShardedEngine<Book> engine(config);
+
+    pin_or_warn("router", options.producer_cpu);
+
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<std::size_t> pick(0, instruments - 1);
+    std::vector<bool> exhausted(instruments, false);
+    std::size_t       live      = instruments;
+    std::size_t       submitted = 0;
+
+    auto start_time = Clock::now();
+    engine.start();
+    while (live > 0) {
+        std::size_t i = pick(rng);
+        while (exhausted[i]) {
+            i = (i + 1) % instruments;
+        }
+        Event ev = generators[i].next();
+        if (ev.type == EventType::End) {
+            exhausted[i] = true;
+            --live;
+            continue;
+        }
+        ev.instrument = static_cast<InstrumentId>(i);
+        if (engine.submit(ev)) {
+            ++submitted;
+        }
+    }
+    engine.stop();
+    auto end_time = Clock::now();
+
+    const double seconds =
+        static_cast<double>(std::chrono::duration_cast<Nanoseconds>(end_time - start_time).count()) / 1e9;
+
+    std::cout << "mt_bench (sharded): " << submitted << " events, " << instruments
+              << " instruments, " << engine.shard_count() << " shards in " << seconds << " s\n";
+
+    auto print_row = [&](const std::string& name, const ShardStats& st) {
+        const double events = static_cast<double>(st.latency.count());
+        std::cout << "  " << name
+                  << ": books=" << st.instruments
+                  << ", events=" << st.latency.count()
+                  << ", throughput=" << (seconds > 0.0 ? events / seconds : 0.0) << " ev/s"
+                  << ", apply=" << (st.latency.empty() ? 0.0 : static_cast<double>(st.busy_ns) / events)
+                  << " ns/ev"
+                  << ", batch-applied latency p50=" << st.latency.percentile(0.50)
+                  << " p99=" << st.latency.percentile(0.99)
+                  << " p99.9=" << st.latency.percentile(0.999)
+                  << " max=" << st.latency.max() << " ns"
+                  << (st.pinned ? ", pinned" : "") << "\n";
+    };
+    for (std::size_t s = 0; s < engine.shard_count(); ++s) {
+        print_row("shard " + std::to_string(s), engine.shard_stats(s));
+    }
+    print_row("total  ", engine.total_stats());
+}
+
+template <typename Book>
+void run_bench(const std::string& queue, std::size_t num_events, std::uint32_t seed,
+               const PipelineOptions& options) {
+    if (options.shards > 0) {
+        run_sharded<Book>(num_events, seed, options);
+    } else if (queue == "v2") {
+        run_pipeline<Book, utils::SpscQueueV2<TimedEvent>>(num_events, seed, options);
+    } else {
+        run_pipeline<Book, utils::SpscQueue<TimedEvent>>(num_events, seed, options);
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Usage: trading_mt_bench <num_events> <seed>"
+                     " [backend=map|ladder] [index=flat|direct] [queue=v1|v2]"
+                     " [wait=spin|yield|park] [producer_cpu=N] [consumer_cpu=N]"
+                     " [shards=K] [instruments=M] [quote_readers=R]\n";
+        return 1;
+    }
+
+    const std::size_t num_events = static_cast<std::size_t>(std::stoull(argv[1]));
+    const std::uint32_t seed     = static_cast<std::uint32_t>(std::stoul(argv[2]));
+
+    // Optional key=value arguments after the positional ones.
+    std::string backend = "map";
+    std::string index   = "flat";
+    std::string queue   = "v1";
+    PipelineOptions options;
+    for (int i = 3; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg.rfind("backend=", 0) == 0) {
+            backend = std::string(arg.substr(8));
+        } else if (arg.rfind("index=", 0) == 0) {
+            index = std::string(arg.substr(6));
+        } else if (arg.rfind("queue=", 0) == 0) {
+            queue = std::string(arg.substr(6));
+        } else if (arg.rfind("wait=", 0) == 0) {
+            if (!utils::parse_wait_mode(arg.substr(5), options.wait)) {
+                std::cerr << "Unknown wait mode: " << arg.substr(5) << " (expected spin, yield or park)\n";
+                return 1;
+            }
+        } else if (arg.rfind("producer_cpu=", 0) == 0) {
+            if (!utils::parse_cpu(arg.substr(13), options.producer_cpu)) {
+                std::cerr << "Bad cpu index: " << arg << "\n";
+                return 1;
+            }
+        } else if (arg.rfind("shards=", 0) == 0) {
+            options.shards = static_cast<std::size_t>(std::stoull(std::string(arg.substr(7))));
+        } else if (arg.rfind("quote_readers=", 0) == 0) {
+            options.quote_readers = static_cast<std::size_t>(std::stoull(std::string(arg.substr(14))));
+        } else if (arg.rfind("instruments=", 0) == 0) {
+            options.instruments = static_cast<std::size_t>(std::stoull(std::string(arg.substr(12))));
+        } else if (arg.rfind("consumer_cpu=", 0) == 0) {
+            if (!utils::parse_cpu(arg.substr(13), options.consumer_cpu)) {
+                std::cerr << "Bad cpu index: " << arg << "\n";
+                return 1;
+            }
+        } else {
+            std::cerr << "Unknown argument: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    std::cout << "mt_bench: backend=" << backend << ", index=" << index
+              << ", queue=" << queue << ", wait=" << utils::to_string(options.wait)
+              << ", producer_cpu=" << options.producer_cpu
+              << ", consumer_cpu=" << options.consumer_cpu;
+    if (options.shards > 0) {
+        std::cout << ", shards=" << options.shards << ", instruments=" << options.instruments;
+    }
+    if (options.quote_readers > 0) {
+        std::cout << ", quote_readers=" << options.quote_readers;
+    }
+    std::cout << "\n";
+
+    if (backend != "map" && backend != "ladder") {
+        std::cerr << "Unknown backend: " << backend << " (expected map or ladder)\n";
+        return 1;
+    }
+    if (index != "flat" && index != "direct") {
+        std::cerr << "Unknown index: " << index << " (expected flat or direct)\n";
+        return 1;
+    }
+    if (queue != "v1" && queue != "v2") {
+        std::cerr << "Unknown queue: " << queue << " (expected v1 or v2)\n";
+        return 1;
+    }
+    if (options.instruments == 0 || options.instruments > 65536) {
+        std::cerr << "instruments must be in [1, 65536]\n";
+        return 1;
+    }
+
+    // EventGenerator ids are dense and increasing, so the direct-mapped index applies.
+    if (backend == "map" && index == "flat") {
+        run_bench<OrderBookWith<MapLevels, FlatIdIndex>>(queue, num_events, seed, options);
+    } else if (backend == "map") {
+        run_bench<OrderBookWith<MapLevels, DirectIdIndex>>(queue, num_events, seed, options);
+    } else if (index == "flat") {
+        run_bench<OrderBookWith<LadderLevels, FlatIdIndex>>(queue, num_events, seed, options);
+    } else {
+        run_bench<OrderBookWith<LadderLevels, DirectIdIndex>>(queue, num_events, seed, options);
+    }
 
     return 0;
 }
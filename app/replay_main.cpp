@@ -1,127 +1,29 @@
 #include "trading/order_book.hpp"
 #include "trading/types.hpp"
 
-#include <cctype>
-#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <optional>
-#include <sstream>
+#include <span>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 #include "trading/event.hpp"
+#include "trading/event_csv.hpp"
+#include "trading/event_log.hpp"
+#include "utils/line_reader.hpp"
 
 using namespace trading;
 
-// --------- parsing helpers ---------
-
-static std::string trim(const std::string& s) {
-    const char* ws = " \t\r\n";
-    auto start = s.find_first_not_of(ws);
-    if (start == std::string::npos) return {};
-    auto end = s.find_last_not_of(ws);
-    return s.substr(start, end - start + 1);
-}
-
-static std::string to_upper(std::string s) {
-    for (auto& c : s) {
-        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
-    }
-    return s;
-}
-
-static std::optional<Side> parse_side(const std::string& token) {
-    auto up = to_upper(token);
-    if (up == "BUY" || up == "B")  return Side::Buy;
-    if (up == "SELL" || up == "S") return Side::Sell;
-    return std::nullopt;
-}
-
-static bool is_comment_or_empty(const std::string& line) {
-    auto t = trim(line);
-    return t.empty() || (!t.empty() && t[0] == '#');
-}
-
-static std::optional<Event> parse_line(const std::string& line) {
-    if (is_comment_or_empty(line)) {
-        return std::nullopt;
-    }
-
-    std::stringstream ss(line);
-    std::string token;
-
-    auto next_token = [&]() -> std::optional<std::string> {
-        if (!std::getline(ss, token, ',')) {
-            return std::nullopt;
-        }
-        return trim(token);
-    };
-
-    auto type_tok_opt = next_token();
-    if (!type_tok_opt) return std::nullopt;
-    auto type_str = to_upper(*type_tok_opt);
-
-    Event ev;
-
-    try {
-        if (type_str == "ADD") {
-            // Формат: ADD,side,price,qty,id
-            auto side_tok_opt  = next_token();
-            auto price_tok_opt = next_token();
-            auto qty_tok_opt   = next_token();
-            auto id_tok_opt    = next_token();
-
-            if (!side_tok_opt || !price_tok_opt || !qty_tok_opt || !id_tok_opt) {
-                return std::nullopt;
-            }
-
-            auto side_opt = parse_side(*side_tok_opt);
-            if (!side_opt) return std::nullopt;
-
-            ev.type  = EventType::Add;
-            ev.side  = *side_opt;
-            ev.price = static_cast<Price>(std::stoll(*price_tok_opt));
-            ev.qty   = static_cast<Quantity>(std::stoll(*qty_tok_opt));
-            ev.id    = static_cast<OrderId>(std::stoull(*id_tok_opt));
-
-            return ev;
-        } else if (type_str == "MKT" || type_str == "MARKET") {
-            // Формат: MKT,side,qty
-            auto side_tok_opt = next_token();
-            auto qty_tok_opt  = next_token();
-            if (!side_tok_opt || !qty_tok_opt) {
-                return std::nullopt;
-            }
-
-            auto side_opt = parse_side(*side_tok_opt);
-            if (!side_opt) return std::nullopt;
-
-            ev.type = EventType::Market;
-            ev.side = *side_opt;
-            ev.qty  = static_cast<Quantity>(std::stoll(*qty_tok_opt));
-            // ev.id не используется для MKT
-            return ev;
-        } else if (type_str == "CANCEL" || type_str == "CXL") {
-            // Формат: CANCEL,id
-            auto id_tok_opt = next_token();
-            if (!id_tok_opt) {
-                return std::nullopt;
-            }
-
-            ev.type = EventType::Cancel;
-            ev.id   = static_cast<OrderId>(std::stoull(*id_tok_opt));
-            return ev;
-        } else {
-            // неизвестный тип события
-            return std::nullopt;
-        }
-    } catch (const std::exception&) {
-        return std::nullopt;
-    }
-}
-
 // --------- stats struct ---------
 
 struct ReplayStats {
@@ -165,11 +67,24 @@ struct ReplayStats {
     // === НОВОЕ: денежные метрики агрессивных сделок ===
     double traded_notional_buy  = 0.0; // сумма price*qty по сделкам, где агрессор BUY
     double traded_notional_sell = 0.0; // аналогично для SELL
+    Quantity traded_qty_buy     = 0;   // qty тех же сделок (market + кроссящие лимиты)
+    Quantity traded_qty_sell    = 0;
 };
 
-static void update_book_stats(const OrderBook& book, ReplayStats& stats) {
-    auto bb = book.best_bid();
-    auto ba = book.best_ask();
+// Book results of one OrderBook::apply batch.
+static void add_apply_stats(const ApplyStats& as, ReplayStats& stats) {
+    stats.total_mkt_fill_buy     += as.market_filled_buy;
+    stats.total_mkt_fill_sell    += as.market_filled_sell;
+    stats.mkt_full_fill_count    += as.markets_full;
+    stats.mkt_zero_fill_count    += as.markets_zero;
+    stats.mkt_partial_fill_count += as.markets - as.markets_full - as.markets_zero;
+    stats.cancel_success         += as.cancels_hit;
+    stats.cancel_fail            += as.cancels - as.cancels_hit;
+}
+
+static void update_book_stats(const TopOfBook& top, ReplayStats& stats) {
+    const auto& bb = top.bid;
+    const auto& ba = top.ask;
 
     if (bb.valid) {
         stats.seen_bid = true;
@@ -194,10 +109,17 @@ static void update_book_stats(const OrderBook& book, ReplayStats& stats) {
     }
 }
 
-static void print_stats(const ReplayStats& st, const OrderBook& book) {
-    auto bb = book.best_bid();
-    auto ba = book.best_ask();
+static void print_level(const LevelInfo& level) {
+    if (level.valid) {
+        std::cout << level.price << " x " << level.qty << "\n";
+    } else {
+        std::cout << "none\n";
+    }
+}
 
+// final_top: book state at the end of a single-file replay; nullptr for a
+// merged multi-file summary (final books are listed per file).
+static void print_stats(const ReplayStats& st, const TopOfBook* final_top) {
     std::cout << "=== Replay summary ===\n\n";
 
     std::cout << "Events:\n";
@@ -235,18 +157,18 @@ static void print_stats(const ReplayStats& st, const OrderBook& book) {
 
     std::cout << "\nAggressive VWAP (based on trades):\n";
 
-    if (st.total_mkt_fill_buy > 0) {
+    if (st.traded_qty_buy > 0) {
         double vwap_buy = st.traded_notional_buy
-                        / static_cast<double>(st.total_mkt_fill_buy);
+                        / static_cast<double>(st.traded_qty_buy);
         std::cout << "  Buy  VWAP: " << std::fixed << std::setprecision(2)
                   << vwap_buy << "\n";
     } else {
         std::cout << "  Buy  VWAP: n/a\n";
     }
 
-    if (st.total_mkt_fill_sell > 0) {
+    if (st.traded_qty_sell > 0) {
         double vwap_sell = st.traded_notional_sell
-                         / static_cast<double>(st.total_mkt_fill_sell);
+                         / static_cast<double>(st.traded_qty_sell);
         std::cout << "  Sell VWAP: " << std::fixed << std::setprecision(2)
                   << vwap_sell << "\n";
     } else {
@@ -294,118 +216,388 @@ static void print_stats(const ReplayStats& st, const OrderBook& book) {
         std::cout << "  not enough data (no simultaneous best bid & ask)\n";
     }
 
-    std::cout << "\nFinal best bid: ";
-    if (bb.valid) {
-        std::cout << bb.price << " x " << bb.qty << "\n";
-    } else {
-        std::cout << "none\n";
+    if (!final_top) {
+        return;
     }
-
+    std::cout << "\nFinal best bid: ";
+    print_level(final_top->bid);
     std::cout << "Final best ask: ";
-    if (ba.valid) {
-        std::cout << ba.price << " x " << ba.qty << "\n";
-    } else {
-        std::cout << "none\n";
-    }
+    print_level(final_top->ask);
 }
 
-int main(int argc, char** argv) {
-    if (argc < 2) {
-        std::cerr << "Usage: trading_replay <events_file>\n";
-        return 1;
-    }
+// Merge the stats of another (independent) replay into `into`.
+static void merge_stats(ReplayStats& into, const ReplayStats& from) {
+    into.add_count              += from.add_count;
+    into.mkt_count              += from.mkt_count;
+    into.cancel_count           += from.cancel_count;
+    into.total_added_buy        += from.total_added_buy;
+    into.total_added_sell       += from.total_added_sell;
+    into.total_mkt_req_buy      += from.total_mkt_req_buy;
+    into.total_mkt_req_sell     += from.total_mkt_req_sell;
+    into.total_mkt_fill_buy     += from.total_mkt_fill_buy;
+    into.total_mkt_fill_sell    += from.total_mkt_fill_sell;
+    into.mkt_full_fill_count    += from.mkt_full_fill_count;
+    into.mkt_partial_fill_count += from.mkt_partial_fill_count;
+    into.mkt_zero_fill_count    += from.mkt_zero_fill_count;
+    into.cancel_success         += from.cancel_success;
+    into.cancel_fail            += from.cancel_fail;
+
+    into.seen_bid         = into.seen_bid || from.seen_bid;
+    into.seen_ask         = into.seen_ask || from.seen_ask;
+    into.min_best_bid     = std::min(into.min_best_bid, from.min_best_bid);
+    into.max_best_bid     = std::max(into.max_best_bid, from.max_best_bid);
+    into.min_best_ask     = std::min(into.min_best_ask, from.min_best_ask);
+    into.max_best_ask     = std::max(into.max_best_ask, from.max_best_ask);
+    into.max_best_bid_qty = std::max(into.max_best_bid_qty, from.max_best_bid_qty);
+    into.max_best_ask_qty = std::max(into.max_best_ask_qty, from.max_best_ask_qty);
+
+    into.spread_sum   += from.spread_sum;
+    into.spread_min    = std::min(into.spread_min, from.spread_min);
+    into.spread_max    = std::max(into.spread_max, from.spread_max);
+    into.spread_count += from.spread_count;
+
+    into.traded_notional_buy  += from.traded_notional_buy;
+    into.traded_notional_sell += from.traded_notional_sell;
+    into.traded_qty_buy       += from.traded_qty_buy;
+    into.traded_qty_sell      += from.traded_qty_sell;
+}
 
-    const char* path = argv[1];
-    std::ifstream in(path);
-    if (!in) {
-        std::cerr << "Failed to open: " << path << "\n";
-        return 1;
+// Input-side counters: what the feed asked for, independent of the book.
+static void count_event(const Event& ev, ReplayStats& stats) {
+    switch (ev.type) {
+    case EventType::Add:
+        ++stats.add_count;
+        if (ev.side == Side::Buy) {
+            stats.total_added_buy += ev.qty;
+        } else {
+            stats.total_added_sell += ev.qty;
+        }
+        break;
+    case EventType::Market:
+        ++stats.mkt_count;
+        if (ev.side == Side::Buy) {
+            stats.total_mkt_req_buy += ev.qty;
+        } else {
+            stats.total_mkt_req_sell += ev.qty;
+        }
+        break;
+    case EventType::Cancel:
+        ++stats.cancel_count;
+        break;
+    default:
+        // не должно быть других типов
+        break;
     }
+}
 
-    OrderBook   book;
+// Result of replaying one file into its own OrderBook.
+struct FileReplay {
+    std::string path;
     ReplayStats stats;
+    TopOfBook   final_top;
+    double      wall_s = 0.0;
+    std::string error;  // non-empty if the file could not be replayed
+};
 
-    std::string line;
-    std::size_t line_no = 0;
+static std::size_t events_of(const ReplayStats& st) {
+    return st.add_count + st.mkt_count + st.cancel_count;
+}
 
-    while (std::getline(in, line)) {
-        ++line_no;
-        auto ev_opt = parse_line(line);
-        if (!ev_opt) {
-            // можно раскомментировать для отладки
-            // std::cerr << "Skipping line " << line_no << ": " << line << "\n";
-            continue;
+// Book image restored before / written after a replay (empty = none).
+struct SnapshotPaths {
+    std::string load;
+    std::string save;
+};
+
+// Replay one CSV or binary event file; thread-safe (everything is local).
+static void replay_file(FileReplay& job, std::size_t batch_size, const SnapshotPaths& snapshot) {
+    const auto t0 = std::chrono::steady_clock::now();
+
+    OrderBook    book;
+    ReplayStats& stats = job.stats;
+
+    if (!snapshot.load.empty()) {
+        // Recovery: restore the image, then replay only the log tail.
+        try {
+            book.load_snapshot(snapshot.load);
+        } catch (const std::exception& e) {
+            job.error = e.what();
+            return;
         }
+    }
 
-        const Event& ev = *ev_opt;
+    // Каждый fill приходит в sink — без аллокаций на ордер.
+    auto on_fill = [&](const Trade& tr) {
+        double notional = static_cast<double>(tr.price)
+                        * static_cast<double>(tr.qty);
 
-        switch (ev.type) {
-        case EventType::Add: {
-            ++stats.add_count;
-            if (ev.side == Side::Buy) {
-                stats.total_added_buy += ev.qty;
-            } else {
-                stats.total_added_sell += ev.qty;
+        if (tr.taker_side == Side::Buy) {
+            stats.traded_notional_buy += notional;
+            stats.traded_qty_buy      += tr.qty;
+        } else {
+            stats.traded_notional_sell += notional;
+            stats.traded_qty_sell      += tr.qty;
+        }
+    };
+
+    auto apply_batch = [&](std::span<const Event> batch) {
+        const ApplyStats as = book.apply(batch, on_fill);
+        add_apply_stats(as, stats);
+        update_book_stats(as.top, stats);
+    };
+
+    auto finish = [&] {
+        if (!snapshot.save.empty() && job.error.empty()) {
+            try {
+                book.save_snapshot(snapshot.save);
+            } catch (const std::exception& e) {
+                job.error = e.what();
             }
-            book.add_limit_order_with_id(ev.id, ev.side, ev.price, ev.qty);
-            break;
         }
-        case EventType::Market: {
-            ++stats.mkt_count;
+        job.final_top = book.top_of_book();
+        job.wall_s    = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    };
 
-            if (ev.side == Side::Buy) {
-                stats.total_mkt_req_buy += ev.qty;
-            } else {
-                stats.total_mkt_req_sell += ev.qty;
+    if (is_event_log(job.path)) {
+        // Binary log: records are Events already, apply slices of the mapping.
+        try {
+            const MappedEventLog log(job.path);
+            const std::span<const Event> events = log.events();
+            for (std::size_t pos = 0; pos < events.size(); pos += batch_size) {
+                const auto batch = events.subspan(pos, std::min(batch_size, events.size() - pos));
+                for (const Event& ev : batch) {
+                    count_event(ev, stats);
+                }
+                apply_batch(batch);
             }
+        } catch (const std::exception& e) {
+            job.error = e.what();
+        }
+        finish();
+        return;
+    }
 
-            MatchResult mr = book.execute_market_order(ev.side, ev.qty);
+    utils::LineReader in(job.path);
+    if (in.failed()) {
+        job.error = "Failed to open: " + job.path;
+        finish();
+        return;
+    }
 
-            if (mr.filled == 0) {
-                ++stats.mkt_zero_fill_count;
-            } else if (mr.remaining == 0) {
-                ++stats.mkt_full_fill_count;
-            } else {
-                ++stats.mkt_partial_fill_count;
-            }
+    std::vector<Event> batch;
+    batch.reserve(batch_size);
 
-            if (ev.side == Side::Buy) {
-                stats.total_mkt_fill_buy += mr.filled;
-            } else {
-                stats.total_mkt_fill_sell += mr.filled;
-            }
+    auto flush = [&]() {
+        if (batch.empty()) {
+            return;
+        }
+        apply_batch(batch);
+        batch.clear();
+    };
 
-            for (const auto& tr : mr.trades) {
-                double notional = static_cast<double>(tr.price)
-                                * static_cast<double>(tr.qty);
+    std::string_view line;
+    std::size_t      bad_lines    = 0;
+    std::size_t      first_bad_no = 0;
+    Event            ev;
 
-                if (tr.taker_side == Side::Buy) {
-                    stats.traded_notional_buy += notional;
-                } else {
-                    stats.traded_notional_sell += notional;
-                }
+    while (in.next(line)) {
+        const CsvParseStatus status = parse_csv_event(line, ev);
+        if (status != CsvParseStatus::Ok) {
+            if (status == CsvParseStatus::Error && bad_lines++ == 0) {
+                first_bad_no = in.line_number();
             }
-            break;
+            continue;
         }
-        case EventType::Cancel: {
-            ++stats.cancel_count;
-            bool ok = book.cancel(ev.id);
-            if (ok) {
-                ++stats.cancel_success;
-            } else {
-                ++stats.cancel_fail;
+
+        count_event(ev, stats);
+        batch.push_back(ev);
+        if (batch.size() == batch_size) {
+            flush();
+        }
+    }
+    flush();
+
+    if (in.failed()) {
+        job.error = "Read error: " + job.path;
+    } else if (bad_lines > 0) {
+        // Not fatal: reported, the rest of the file is replayed.
+        std::cerr << job.path << ": skipped " << bad_lines
+                  << " malformed lines (first: line " << first_bad_no << ")\n";
+    }
+    finish();
+}
+
+// Expand directories into their regular files (sorted by name).
+static bool collect_files(const std::string& arg, std::vector<std::string>& out) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    if (!fs::is_directory(arg, ec)) {
+        out.push_back(arg);
+        return true;
+    }
+    std::vector<std::string> found;
+    for (const auto& entry : fs::directory_iterator(arg, ec)) {
+        if (entry.is_regular_file(ec)) {
+            found.push_back(entry.path().string());
+        }
+    }
+    if (ec) {
+        std::cerr << "Cannot list directory: " << arg << "\n";
+        return false;
+    }
+    std::sort(found.begin(), found.end());
+    out.insert(out.end(), found.begin(), found.end());
+    return true;
+}
+
+static bool is_number(std::string_view s) {
+    return !s.empty() && std::all_of(s.begin(), s.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr << "Usage: trading_replay <events_file|dir>... [batch_size] [batch=N] [jobs=N]\n"
+                     "                      [load_snapshot=PATH] [save_snapshot=PATH]\n"
+                     "  events_file: CSV (trading_generate) or binary event log (trading_generate ... <out.bin>,\n"
+                     "               trading_csv_to_bin); binary logs are detected by their header and mmap'ed\n"
+                     "  several files / directories are replayed in parallel (jobs threads, default: all cores),\n"
+                     "  one OrderBook per file, and the statistics are merged\n"
+                     "  batch_size / batch=N: events per OrderBook::apply (default 1); book-state stats are\n"
+                     "               sampled once per batch\n"
+                     "  load_snapshot / save_snapshot (single file only): start from a book image instead of\n"
+                     "               an empty book / write the final book as an image\n";
+        return 1;
+    }
+
+    // Events per OrderBook::apply call. Book stats (best bid/ask ranges,
+    // spread) are sampled once per batch: the default 1 samples every event,
+    // larger batches are opt-in and sample coarser.
+    std::size_t batch_size = 1;
+    std::size_t jobs       = std::max(1u, std::thread::hardware_concurrency());
+
+    SnapshotPaths            snapshot;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        std::error_code  ec;
+        if (arg.rfind("batch=", 0) == 0) {
+            batch_size = std::strtoull(argv[i] + 6, nullptr, 10);
+        } else if (arg.rfind("jobs=", 0) == 0) {
+            jobs = std::strtoull(argv[i] + 5, nullptr, 10);
+        } else if (arg.rfind("load_snapshot=", 0) == 0) {
+            snapshot.load = std::string(arg.substr(14));
+        } else if (arg.rfind("save_snapshot=", 0) == 0) {
+            snapshot.save = std::string(arg.substr(14));
+        } else if (i == 2 && is_number(arg) && !std::filesystem::exists(arg, ec)) {
+            // Backwards compatible: trading_replay <file> <batch_size>
+            batch_size = std::strtoull(argv[i], nullptr, 10);
+        } else if (!collect_files(std::string(arg), files)) {
+            return 1;
+        }
+    }
+    if (batch_size == 0) {
+        std::cerr << "batch_size must be > 0\n";
+        return 1;
+    }
+    if (jobs == 0) {
+        std::cerr << "jobs must be > 0\n";
+        return 1;
+    }
+    if (files.empty()) {
+        std::cerr << "No event files given\n";
+        return 1;
+    }
+    if ((!snapshot.load.empty() || !snapshot.save.empty()) && files.size() != 1) {
+        std::cerr << "load_snapshot / save_snapshot need exactly one event file\n";
+        return 1;
+    }
+
+    std::vector<FileReplay> results(files.size());
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        results[i].path = files[i];
+    }
+
+    // Worker pool: each worker takes the next file; books never cross threads.
+    const auto t0 = std::chrono::steady_clock::now();
+    {
+        std::atomic<std::size_t> next{0};
+        auto worker = [&] {
+            for (std::size_t i = next.fetch_add(1); i < results.size(); i = next.fetch_add(1)) {
+                replay_file(results[i], batch_size, snapshot);
             }
-            break;
+        };
+        const std::size_t        threads = std::min(jobs, results.size());
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (std::size_t t = 1; t < threads; ++t) {
+            pool.emplace_back(worker);
         }
-        default:
-            // не должно быть других типов
-            break;
+        worker();
+        for (auto& th : pool) {
+            th.join();
         }
+    }
+    const double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
 
-        // обновляем статистику по книге после каждого события
-        update_book_stats(book, stats);
+    bool failed = false;
+    for (const auto& r : results) {
+        if (!r.error.empty()) {
+            std::cerr << r.error << "\n";
+            failed = true;
+        }
     }
+    if (failed && results.size() == 1) {
+        return 1;
+    }
+
+    // Merge in file order, so the summary does not depend on scheduling.
+    ReplayStats total;
+    std::size_t total_events = 0;
+    for (const auto& r : results) {
+        if (r.error.empty()) {
+            merge_stats(total, r.stats);
+            total_events += events_of(r.stats);
+        }
+    }
+
+    if (results.size() == 1) {
+        print_stats(total, &results[0].final_top);
+    } else {
+        std::cout << "=== Files ===\n\n";
+        for (const auto& r : results) {
+            std::cout << "  " << r.path << ": ";
+            if (!r.error.empty()) {
+                std::cout << "FAILED (" << r.error << ")\n";
+                continue;
+            }
+            const std::size_t n = events_of(r.stats);
+            std::cout << n << " events, " << std::fixed << std::setprecision(3)
+                      << r.wall_s * 1e3 << " ms, "
+                      << std::setprecision(0) << (r.wall_s > 0.0 ? static_cast<double>(n) / r.wall_s : 0.0)
+                      << " events/s, final bid ";
+            if (r.final_top.bid.valid) {
+                std::cout << r.final_top.bid.price << " x " << r.final_top.bid.qty;
+            } else {
+                std::cout << "none";
+            }
+            std::cout << ", ask ";
+            if (r.final_top.ask.valid) {
+                std::cout << r.final_top.ask.price << " x " << r.final_top.ask.qty;
+            } else {
+                std::cout << "none";
+            }
+            std::cout << "\n";
+        }
+        std::cout << "\n";
+        print_stats(total, nullptr);
+    }
+
+    std::cout << "\nTiming:\n";
+    std::cout << "  files  : " << results.size() << " (" << std::min(jobs, results.size()) << " threads)\n";
+    std::cout << "  wall   : " << std::fixed << std::setprecision(3) << wall_s * 1e3 << " ms\n";
+    std::cout << "  events : " << total_events << ", "
+              << std::setprecision(0) << (wall_s > 0.0 ? static_cast<double>(total_events) / wall_s : 0.0)
+              << " events/s\n";
 
-    print_stats(stats, book);
-    return 0;
+    return failed ? 1 : 0;
 }
@@ -0,0 +1,99 @@
+// app/snapshot_build_bench.hpp
+// Shared by the REST and WS snapshot tools: OrderBook build from an exchange
+// snapshot, per-level add_limit_order vs bulk load_levels.
+#pragma once
+
+#include "exchange/bybit_public_rest.hpp"
+#include "trading/order_book.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace snapshot_bench {
+
+using Clock = std::chrono::steady_clock;
+
+// Exchange levels (doubles) -> integer ticks, order preserved.
+inline std::vector<trading::PriceLevel> to_price_levels(const std::vector<exchange::OrderBookLevel>& levels,
+                                                        std::int64_t price_scale,
+                                                        std::int64_t qty_scale) {
+    std::vector<trading::PriceLevel> out;
+    out.reserve(levels.size());
+    for (const auto& lvl : levels) {
+        out.push_back(trading::PriceLevel{static_cast<trading::Price>(lvl.price * price_scale),
+                                          static_cast<trading::Quantity>(lvl.qty * qty_scale)});
+    }
+    return out;
+}
+
+// The pre-load_levels path: every level goes through matching and lookups.
+inline void build_with_adds(trading::OrderBook& book,
+                            const std::vector<trading::PriceLevel>& bids,
+                            const std::vector<trading::PriceLevel>& asks) {
+    for (const auto& lvl : bids) {
+        book.add_limit_order(trading::Side::Buy, lvl.price, lvl.qty);
+    }
+    for (const auto& lvl : asks) {
+        book.add_limit_order(trading::Side::Sell, lvl.price, lvl.qty);
+    }
+}
+
+template <typename Fn>
+double ns_per_run(int runs, Fn&& fn) {
+    const auto t0 = Clock::now();
+    for (int r = 0; r < runs; ++r) {
+        fn();
+    }
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+    return static_cast<double>(ns) / runs;
+}
+
+// Times three ways to build the book from the same levels and prints them:
+//  - add_limit_order per level into a fresh book (the old path);
+//  - load_levels into a fresh book;
+//  - load_levels into one reused book (steady state: nothing allocated).
+inline void run(const char* title,
+                const std::vector<trading::PriceLevel>& bids,
+                const std::vector<trading::PriceLevel>& asks,
+                int runs) {
+    const double levels = static_cast<double>(bids.size() + asks.size());
+
+    // Warm-up: touch code & caches once per path.
+    {
+        trading::OrderBook book;
+        build_with_adds(book, bids, asks);
+        book.load_levels(bids, asks);
+    }
+
+    const double add_ns = ns_per_run(runs, [&] {
+        trading::OrderBook book;
+        build_with_adds(book, bids, asks);
+        auto bb = book.best_bid();
+        (void)bb;
+    });
+    const double bulk_ns = ns_per_run(runs, [&] {
+        trading::OrderBook book;
+        book.load_levels(bids, asks);
+        auto bb = book.best_bid();
+        (void)bb;
+    });
+    trading::OrderBook reused;
+    const double reuse_ns = ns_per_run(runs, [&] {
+        reused.load_levels(bids, asks);
+        auto bb = reused.best_bid();
+        (void)bb;
+    });
+
+    std::cout << "\nBuild timings (" << title << ", " << runs << " runs, "
+              << bids.size() + asks.size() << " levels):\n";
+    std::cout << "  add_limit_order per level : " << add_ns << " ns/snapshot, "
+              << add_ns / levels << " ns/level\n";
+    std::cout << "  load_levels (fresh book)  : " << bulk_ns << " ns/snapshot, "
+              << bulk_ns / levels << " ns/level, x" << add_ns / bulk_ns << "\n";
+    std::cout << "  load_levels (reused book) : " << reuse_ns << " ns/snapshot, "
+              << reuse_ns / levels << " ns/level, x" << add_ns / reuse_ns << "\n";
+}
+
+} // namespace snapshot_bench
@@ -1,19 +1,21 @@
 // app/ws_orderbook_snapshot_main.cpp
 #include "exchange/bybit_public_rest.hpp"
 #include "trading/order_book.hpp"
+#include "feed_source.hpp"
+#include "snapshot_build_bench.hpp"
 
 #include <nlohmann/json.hpp>
 
-#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace {
 
-using Clock = std::chrono::high_resolution_clock;
 using nlohmann::json;
 
 // Must be consistent with other places in the project.
@@ -61,58 +63,72 @@ exchange::OrderBookSnapshot parse_ws_snapshot(const json& msg,
 int main(int argc, char** argv) {
     std::string symbol = "BTCUSDT";
     int runs           = 1000;
-
-    if (argc >= 2) {
-        symbol = argv[1];
-    }
-    if (argc >= 3) {
-        runs = std::atoi(argv[2]);
-        if (runs <= 0) runs = 1000;
+    feed_source::Options source;
+
+    // Positional: symbol, runs; then source=stdin|ws|shm:NAME (feed_source.hpp).
+    int positional = 0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg.rfind("source=", 0) == 0) {
+            if (!feed_source::parse(arg.substr(7), source)) {
+                std::cerr << "Unknown source: " << arg.substr(7) << " (expected stdin, ws or shm:NAME)\n";
+                return 1;
+            }
+        } else if (positional++ == 0) {
+            symbol = argv[i];
+        } else {
+            runs = std::atoi(argv[i]);
+            if (runs <= 0) runs = 1000;
+        }
     }
 
     const std::string expected_topic = "orderbook.50." + symbol;
 
-    std::cerr << "Reading WS messages from stdin...\n";
+    std::cerr << "Reading WS messages from " << feed_source::name(source.kind) << "...\n";
     std::cerr << "  symbol: " << symbol << "\n";
     std::cerr << "  topic:  " << expected_topic << "\n";
 
-    std::string line;
     json snapshot_msg;
     bool have_snapshot = false;
+    feed_source::E2eLatency latency;
 
-    // 1) Read lines until we find the first snapshot for the topic we want.
-    while (std::getline(std::cin, line)) {
-        if (line.empty()) continue;
+    // 1) Read messages until we find the first snapshot for the topic we want.
+    const auto on_msg = [&](std::string_view text) {
+        const std::int64_t arrival_ns = feed_source::wall_now_ns();
+        if (text.empty()) return true;
 
         json msg;
         try {
-            msg = json::parse(line);
+            msg = json::parse(text);
         } catch (const std::exception& ex) {
             std::cerr << "JSON parse error: " << ex.what() << "\n";
-            continue;
+            return true;
         }
 
         // Ignore subscription acks etc.
         if (msg.contains("success") && msg.contains("op")) {
-            continue;
+            return true;
         }
 
         const std::string topic = msg.value("topic", "");
         const std::string type  = msg.value("type", "");
 
         if (topic != expected_topic) {
-            continue;
+            return true;
         }
+        latency.record(msg.value("ts", 0LL) * 1'000'000, arrival_ns);
 
         if (type == "snapshot") {
-            snapshot_msg = msg;
+            snapshot_msg = std::move(msg);
             have_snapshot = true;
             std::cerr << "Got snapshot for topic=" << topic << "\n";
-            break;
+            return false;
         }
 
         // For now we ignore delta messages.
-    }
+        return true;
+    };
+    feed_source::run(source, {expected_topic}, on_msg);
 
     if (!have_snapshot) {
         std::cerr << "No snapshot message found for topic=" << expected_topic << "\n";
@@ -140,74 +156,29 @@ int main(int argc, char** argv) {
     std::cout << "  ts_ms    : " << snap.ts_ms << "\n";
     std::cout << "  cts_ms   : " << snap.cts_ms << "\n";
     std::cout << "  bids     : " << snap.bids.size() << "\n";
-    std::cout << "  asks     : " << snap.asks.size() << "\n";
-
-    // 3) Warm-up: one build
-    {
-        trading::OrderBook book;
-        for (const auto& lvl : snap.bids) {
-            auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-            auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-            book.add_limit_order(trading::Side::Buy, px, qty);
-        }
-        for (const auto& lvl : snap.asks) {
-            auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-            auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-            book.add_limit_order(trading::Side::Sell, px, qty);
-        }
-    }
+    std::cout << "  asks     : " << snap.asks.size() << "\n\n";
+    latency.print(source.kind);
 
-    std::cout << "\nBenchmarking OrderBook build from WS snapshot...\n";
-    std::cout << "  runs          : " << runs << "\n";
-    std::cout << "  total levels  : " << total_levels << "\n";
-
-    auto t_start = Clock::now();
-    for (int r = 0; r < runs; ++r) {
-        trading::OrderBook book;
+    const auto bids = snapshot_bench::to_price_levels(snap.bids, PRICE_SCALE, QTY_SCALE);
+    const auto asks = snapshot_bench::to_price_levels(snap.asks, PRICE_SCALE, QTY_SCALE);
 
-        for (const auto& lvl : snap.bids) {
-            auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-            auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-            book.add_limit_order(trading::Side::Buy, px, qty);
-        }
-        for (const auto& lvl : snap.asks) {
-            auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-            auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-            book.add_limit_order(trading::Side::Sell, px, qty);
-        }
-
-        auto bb = book.best_bid();
-        auto ba = book.best_ask();
-        (void)bb;
-        (void)ba;
+    // load_levels rejects unsorted / crossed input: check once up front.
+    try {
+        trading::OrderBook probe;
+        probe.load_levels(bids, asks);
+    } catch (const std::invalid_argument& ex) {
+        std::cerr << "Unusable WS snapshot: " << ex.what() << "\n";
+        return 1;
     }
-    auto t_end = Clock::now();
 
-    auto total_ns =
-        std::chrono::duration_cast<std::chrono::nanoseconds>(t_end - t_start).count();
-
-    double ns_per_run   = static_cast<double>(total_ns) / runs;
-    double ns_per_level = ns_per_run / static_cast<double>(total_levels);
-
-    std::cout << "\nBuild timings (OrderBook from WS snapshot):\n";
-    std::cout << "  total time:   " << total_ns << " ns\n";
-    std::cout << "  per run:      " << ns_per_run << " ns/snapshot\n";
-    std::cout << "  per level:    " << ns_per_level << " ns/level\n";
+    // 3) Build benchmark: per-level adds vs load_levels.
+    std::cout << "\nBenchmarking OrderBook build from WS snapshot...\n";
+    snapshot_bench::run("OrderBook from WS snapshot", bids, asks, runs);
 
     // 4) One more build + print human-readable best bid/ask.
     {
         trading::OrderBook book;
-
-        for (const auto& lvl : snap.bids) {
-            auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-            auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-            book.add_limit_order(trading::Side::Buy, px, qty);
-        }
-        for (const auto& lvl : snap.asks) {
-            auto px  = static_cast<trading::Price>(lvl.price * PRICE_SCALE);
-            auto qty = static_cast<trading::Quantity>(lvl.qty * QTY_SCALE);
-            book.add_limit_order(trading::Side::Sell, px, qty);
-        }
+        book.load_levels(bids, asks);
 
         auto bb = book.best_bid();
         auto ba = book.best_ask();
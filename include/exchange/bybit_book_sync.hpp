@@ -0,0 +1,131 @@
+// include/exchange/bybit_book_sync.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "exchange/bybit_public_rest.hpp"
+#include "exchange/bybit_ws_parser.hpp"
+#include "trading/level_book.hpp"
+
+namespace exchange {
+
+enum class BookSyncState : std::uint8_t {
+    WaitingSnapshot, // nothing applied yet (start or reset)
+    Live,
+    Resyncing,       // gap seen: book stale, deltas buffered
+};
+
+struct BookSyncStats {
+    std::uint64_t snapshots        = 0; // WS + REST snapshots applied
+    std::uint64_t deltas           = 0; // deltas applied (replayed ones included)
+    std::uint64_t stale_deltas     = 0; // u <= last applied u: dropped
+    std::uint64_t gaps             = 0; // u > last applied u + 1
+    std::uint64_t buffered         = 0; // deltas ever buffered
+    std::uint64_t replayed         = 0; // buffered deltas applied after a snapshot
+    std::uint64_t buffer_overflows = 0; // buffered deltas discarded for room
+    std::uint64_t stale_snapshots  = 0; // REST snapshot older than the buffered chain / a lost frame
+};
+
+// Sequence tracking + resync for one orderbook.N.SYMBOL stream feeding a
+// LevelBook. Pass it as the handler of parse_bybit_message:
+//
+//  - a delta is applied only if its data.u is the previous u + 1; an older
+//    u is dropped (duplicate / out of order), a newer one is a gap;
+//  - on a gap the book stops updating (state Resyncing) and every further
+//    delta is buffered — levels copied into a preallocated buffer — as one
+//    u-contiguous chain that starts at the delta that revealed the gap;
+//  - the book is live again after either
+//      * a WS snapshot (re-subscribe / reconnect / Bybit's u=1 restart):
+//        buffered deltas with u > snapshot u are replayed, or
+//      * a REST snapshot (apply_snapshot): Bybit's REST and WS books share
+//        the cross sequence data.seq, not u, so the snapshot must be at least
+//        as new as the chain front and the chain is replayed from the first
+//        delta with seq > snapshot seq.
+//
+// If the buffer fills up, the oldest buffered deltas are discarded (counted
+// in buffer_overflows) and the chain front moves forward; a resync snapshot
+// then has to be correspondingly newer. A single delta larger than the whole
+// buffer is lost too; REST snapshots older than its seq are rejected.
+//
+// A frame that fails to parse after its levels started (parse_bybit_message
+// returns Error) leaves the book half-updated: the state is Resyncing until
+// the next snapshot.
+//
+// Not thread-safe: book thread only.
+class BybitBookSync : public BybitHandlerBase {
+public:
+    // max_buffered_levels bounds the delta buffer (levels of all buffered
+    // deltas together); reserved up front.
+    explicit BybitBookSync(trading::LevelBook& book, std::size_t max_buffered_levels = 64 * 1024);
+
+    // ---- parse_bybit_message callbacks ---------------------------------------
+    void on_book_begin(const BybitMessageHeader& h);
+    void on_level(const BybitLevel& lvl);
+    void on_book_end(const BybitMessageHeader& h);
+
+    // REST resync. Levels are converted to ticks with the stream's scale.
+    // Returns true if the book is live afterwards; false if the snapshot was
+    // not needed (already live) or too old for the buffered chain.
+    bool apply_snapshot(const OrderBookSnapshot& snap, const BybitScale& scale);
+
+    // Forget the stream position and the buffer (new connection: u restarts
+    // with the snapshot sent on subscribe). The book is left as is.
+    void reset() noexcept;
+
+    BookSyncState state() const noexcept { return state_; }
+    bool          live() const noexcept { return state_ == BookSyncState::Live; }
+    std::uint64_t last_update_id() const noexcept { return last_u_; }
+    std::size_t   buffered_deltas() const noexcept { return chain_.size(); }
+
+    // Whether the last parsed frame changed the book (itself or by replaying
+    // buffered deltas), and the header of the last delta / snapshot applied;
+    // its topic / symbol views are only valid while the frame is.
+    bool                      applied() const noexcept { return applied_; }
+    const BybitMessageHeader& last() const noexcept { return last_; }
+
+    const BookSyncStats& stats() const noexcept { return stats_; }
+
+private:
+    enum class Action : std::uint8_t { Drop, Apply, Buffer };
+
+    struct Delta {
+        std::uint64_t u     = 0;
+        std::uint64_t seq   = 0;
+        std::size_t   begin = 0; // [begin, end) in levels_
+        std::size_t   end   = 0;
+        std::int64_t  ts_ms  = 0;
+        std::int64_t  cts_ms = 0;
+    };
+
+    Action classify_delta(const BybitMessageHeader& h);
+    void   start_buffering();
+    void   apply_delta(const Delta& d);
+    // After a snapshot: replay the chain from last_u_ + 1 (WS) or from the
+    // first delta with seq > snapshot_seq (REST).
+    void   replay(bool by_seq, std::uint64_t snapshot_seq);
+    void   drop_front(std::size_t count);
+    void   clear_buffer() noexcept;
+
+    trading::LevelBook& book_;
+    std::size_t         max_levels_;
+
+    BookSyncState state_            = BookSyncState::WaitingSnapshot;
+    Action        action_           = Action::Drop; // for the frame being parsed
+    bool          applied_          = false;
+    bool          u_known_          = false; // last_u_ valid (false right after a REST snapshot)
+    std::uint64_t last_u_           = 0;
+    std::uint64_t anchor_seq_       = 0;     // REST snapshot seq, while !u_known_
+    std::uint64_t min_snapshot_seq_ = 0;     // REST snapshot floor: seq of a lost delta
+    BybitMessageHeader last_{};
+
+    std::vector<BybitLevel> levels_; // buffered levels, chain order
+    std::vector<Delta>      chain_;  // u-contiguous buffered deltas
+    std::size_t             frame_begin_    = 0;     // levels_ offset of the frame being buffered
+    bool                    frame_overflow_ = false; // current frame does not fit
+
+    BookSyncStats stats_;
+};
+
+} // namespace exchange
@@ -1,10 +1,13 @@
 // include/exchange/bybit_public_rest.hpp
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
 
+#include "utils/http_client.hpp"
+
 namespace exchange {
 
 struct Ticker {
@@ -21,29 +24,40 @@ struct OrderBookLevel {
 
 struct OrderBookSnapshot {
     std::string symbol;
-    std::int64_t seq    = 0;    // cross sequence
-    std::int64_t ts_ms  = 0;    // system ts
-    std::int64_t cts_ms = 0;    // engine ts
+    std::int64_t update_id = 0; // u
+    std::int64_t seq       = 0; // cross sequence (comparable with the WS data.seq)
+    std::int64_t ts_ms     = 0; // system ts
+    std::int64_t cts_ms    = 0; // engine ts
 
     std::vector<OrderBookLevel> bids; // sorted desc
     std::vector<OrderBookLevel> asks; // sorted asc
 };
 
+// All calls go through one keep-alive HttpClient: after the first request
+// the TCP / TLS connection is reused. Not thread-safe: every request uses
+// the client's curl handle and buffers, hence the non-const methods (one
+// BybitPublicRest per thread, or one thread at a time).
 class BybitPublicRest {
 public:
     explicit BybitPublicRest(std::string base_url = "https://api.bybit.com");
 
-    std::string   get_server_time_raw() const;
-    std::int64_t  get_server_time_ms() const;
+    std::string   get_server_time_raw();
+    std::int64_t  get_server_time_ms();
 
-    Ticker        get_spot_ticker(const std::string& symbol) const;
+    Ticker        get_spot_ticker(const std::string& symbol);
 
     // New: full depth snapshot for spot order book
     OrderBookSnapshot get_spot_orderbook_snapshot(const std::string& symbol,
-                                                  int                 limit = 50) const;
+                                                  int                 limit = 50);
+
+    // Snapshots of many symbols fetched concurrently (startup / resync);
+    // results in symbols order. Throws if any of them fails.
+    std::vector<OrderBookSnapshot> get_spot_orderbook_snapshots(const std::vector<std::string>& symbols,
+                                                                int limit = 50,
+                                                                std::size_t max_parallel = 8);
 
 private:
-    std::string base_url_;
+    utils::HttpClient http_;
 };
 
 } // namespace exchange
@@ -1,21 +1,71 @@
 // include/exchange/bybit_public_ws.hpp
 #pragma once
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 
 namespace exchange {
 
+class BybitTopicRouter;
+
+// Receive-side metadata of a frame handed out by BybitPublicWs::poll.
+struct WsFrameInfo {
+    std::uint64_t seq                 = 0; // frame number since start() (gaps = drops)
+    std::int64_t  recv_ns             = 0; // steady_clock ns when the read completed
+    std::int64_t  dispatch_latency_ns = 0; // recv -> handler call (queueing delay)
+    std::uint32_t connection          = 0; // reconnect generation, 0 = first connection
+};
+
+struct WsSessionOptions {
+    std::size_t               queue_frames  = 1024;      // preallocated frame slots
+    std::size_t               frame_reserve = 64 * 1024; // bytes reserved per slot
+    std::chrono::milliseconds backoff_initial{100};      // first reconnect delay
+    std::chrono::milliseconds backoff_max{5000};         // doubled up to this
+    std::chrono::seconds      heartbeat{20};             // {"op":"ping"} period, 0 = off
+};
+
+// Bybit spot accepts at most 10 topics in the args of one subscribe request.
+inline constexpr std::size_t kBybitMaxSubscribeArgs = 10;
+
+// {"op":"subscribe","args":[...]} requests covering topics in order, at most
+// max_args topics each; none for no topics. Sent one after another.
+std::vector<std::string> bybit_subscribe_messages(const std::vector<std::string>& topics,
+                                                  std::size_t max_args = kBybitMaxSubscribeArgs);
+
+// Counters of a session; readable from any thread.
+struct WsSessionStats {
+    std::uint64_t frames_received  = 0;
+    std::uint64_t frames_dropped   = 0; // no free slot: the book thread fell behind
+    std::uint64_t connects         = 0; // successful connect + subscribe
+    std::uint64_t connect_failures = 0;
+};
+
 class BybitPublicWs {
 public:
-    using MessageHandler = std::function<void(const nlohmann::json&)>;
+    using MessageHandler    = std::function<void(const nlohmann::json&)>;
+    // Text frame as received, viewed in place in the read buffer: valid only
+    // during the call. Pair with parse_bybit_message (bybit_ws_parser.hpp).
+    using RawMessageHandler = std::function<void(std::string_view)>;
+    // Session frame: the view points into a preallocated slot and is valid
+    // only during the call.
+    using FrameHandler      = std::function<void(std::string_view, const WsFrameInfo&)>;
 
     BybitPublicWs(std::string host = "stream.bybit.com",
                   std::string port = "443",
                   std::string path = "/v5/public/spot");
+    ~BybitPublicWs();
+
+    BybitPublicWs(const BybitPublicWs&)            = delete;
+    BybitPublicWs& operator=(const BybitPublicWs&) = delete;
 
     // Блокирующий запуск: подключиться, подписаться, читать сообщения,
     // вызывать handler для каждого JSON.
@@ -26,10 +76,59 @@ public:
              const MessageHandler& handler,
              int max_messages = -1);
 
+    // То же, но без DOM: handler получает сырой фрейм без копирования.
+    void run_raw(const std::vector<std::string>& channels,
+                 const RawMessageHandler& handler,
+                 int max_messages = -1);
+
+    // ---- persistent session ------------------------------------------------
+    //
+    // start() spawns an I/O thread with Asio async reads: connect, TLS, WS
+    // handshake, subscribe, then every text frame is copied into a free
+    // preallocated slot and queued (SPSC) for the book thread, which drains
+    // it with poll(). Parsing and book updates therefore never run on the
+    // socket read path.
+    //
+    // Topics are subscribed in requests of kBybitMaxSubscribeArgs, written
+    // back to back before the first read.
+    //
+    // On any error the I/O thread reconnects with exponential backoff,
+    // reusing the resolved endpoints and the TLS session (resumption), and
+    // re-subscribes (every request again). If all slots are in use the frame is dropped and
+    // counted (frames_dropped, WsFrameInfo::seq gap).
+
+    void start(const std::vector<std::string>& channels, WsSessionOptions options = {});
+    // Subscribe to every topic registered in the router (one socket for all
+    // symbols); pair with poll(router).
+    void start(const BybitTopicRouter& router, WsSessionOptions options = {});
+
+    // Stop the I/O thread and close the connection. Frames still queued can
+    // be drained with poll(). Called by the destructor.
+    void stop();
+
+    bool running() const noexcept;
+
+    // Book thread only: dispatch up to max_frames queued frames in order,
+    // returning how many were handled (0 = queue empty).
+    std::size_t poll(const FrameHandler& handler,
+                     std::size_t max_frames = std::numeric_limits<std::size_t>::max());
+    // Same, each frame routed by topic to its handler (bybit_topic_router.hpp).
+    std::size_t poll(BybitTopicRouter& router,
+                     std::size_t max_frames = std::numeric_limits<std::size_t>::max());
+
+    WsSessionStats stats() const noexcept;
+
 private:
+    struct Session;
+
+    template <typename Fn>
+    std::size_t drain(Fn&& fn, std::size_t max_frames);
+
     std::string host_;
     std::string port_;
     std::string path_;
+
+    std::unique_ptr<Session> session_;
 };
 
 } // namespace exchange
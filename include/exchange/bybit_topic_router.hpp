@@ -0,0 +1,82 @@
+// include/exchange/bybit_topic_router.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "exchange/bybit_public_ws.hpp"
+
+namespace exchange {
+
+// Dense id of a registered topic: index into BybitTopicRouter::topics().
+using TopicId = std::uint32_t;
+inline constexpr TopicId kNoTopic = std::numeric_limits<TopicId>::max();
+
+// "topic" value of a Bybit frame, viewed in place; empty if the frame has
+// none (subscribe ack, pong) or is malformed. Only top-level keys in front of
+// "topic" are skipped — Bybit sends it first, so this is a few bytes of scan.
+std::string_view find_bybit_topic(std::string_view frame) noexcept;
+
+// Counters of a router; book thread only.
+struct TopicRouterStats {
+    std::uint64_t routed   = 0; // handed to a topic handler
+    std::uint64_t control  = 0; // no topic: fallback handler
+    std::uint64_t unrouted = 0; // topic not registered: fallback handler
+};
+
+// Subscription registry + demux for one BybitPublicWs session.
+//
+// Topics are registered once (add() -> TopicId); topics() is the subscribe
+// list, so many symbols / channels share one socket. dispatch() extracts the
+// frame's topic, looks it up in a hash table (cost independent of the number
+// of topics) and calls that topic's handler with the frame as received — the
+// view is not copied and is valid only during the call. A handler is free to
+// parse in place or to push the frame into a shard queue of its own.
+// Frames without a topic or with an unknown one go to the fallback handler.
+//
+// Not thread-safe: register before start(), dispatch on the book thread.
+class BybitTopicRouter {
+public:
+    using Handler         = std::function<void(TopicId, std::string_view, const WsFrameInfo&)>;
+    using FallbackHandler = std::function<void(std::string_view, const WsFrameInfo&)>;
+
+    // Register a topic ("orderbook.50.BTCUSDT"); a topic registered twice
+    // keeps its id and gets the new handler.
+    TopicId add(std::string topic, Handler handler);
+
+    // Control / unknown-topic frames (no-op by default).
+    void set_fallback(FallbackHandler handler) { fallback_ = std::move(handler); }
+
+    TopicId find(std::string_view topic) const noexcept;
+
+    const std::vector<std::string>& topics() const noexcept { return topics_; }
+    std::size_t                     size() const noexcept { return topics_.size(); }
+
+    // Route one frame; returns the topic id it went to, kNoTopic for the
+    // fallback.
+    TopicId dispatch(std::string_view frame, const WsFrameInfo& info);
+
+    const TopicRouterStats& stats() const noexcept { return stats_; }
+
+private:
+    // Heterogeneous lookup: find() with a string_view into the frame, no
+    // std::string built per frame.
+    struct TopicHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+    };
+
+    std::unordered_map<std::string, TopicId, TopicHash, std::equal_to<>> ids_;
+    std::vector<std::string>                                             topics_;   // by id
+    std::vector<Handler>                                                 handlers_; // by id
+    FallbackHandler                                                      fallback_;
+    TopicRouterStats                                                     stats_;
+};
+
+} // namespace exchange
@@ -0,0 +1,413 @@
+// include/exchange/bybit_ws_parser.hpp
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "trading/types.hpp"
+#include "utils/decimal.hpp"
+#include "utils/simd_kernels.hpp"
+
+namespace exchange {
+
+// Fast path for Bybit v5 public market-data frames (orderbook.N.SYMBOL and
+// publicTrade.SYMBOL). The frame is scanned in place — no DOM, no
+// std::string, no std::stod — and every level / trade is handed to the
+// handler as fixed-point ticks (price / qty strings go through
+// utils::simd::parse_decimal: the AVX2 kernel where the CPU has it). Anything
+// else (subscribe acks, pong, other topics) is reported as Control /
+// Unsupported so the caller can fall back to nlohmann::json.
+
+// Tick scale of one instrument: price tick = 10^-price_decimals,
+// qty tick = 10^-qty_decimals (e.g. {1, 6}: price 0.1, qty 1e-6).
+struct BybitScale {
+    unsigned price_decimals = 2;
+    unsigned qty_decimals   = 6;
+};
+
+enum class BybitMessageKind : std::uint8_t {
+    OrderbookSnapshot,
+    OrderbookDelta,
+    PublicTrade,
+};
+
+enum class BybitParseStatus : std::uint8_t {
+    Ok,          // market data, handler called
+    Control,     // no "topic" (subscribe ack, pong, ...): use the DOM path
+    Unsupported, // topic the fast path does not handle
+    Error,       // malformed frame or number
+};
+
+// Views into the frame: valid only inside the handler call.
+struct BybitMessageHeader {
+    BybitMessageKind kind      = BybitMessageKind::OrderbookDelta;
+    std::string_view topic;
+    std::string_view symbol;        // topic suffix ("BTCUSDT")
+    std::int64_t     ts_ms     = 0; // exchange send time
+    std::int64_t     cts_ms    = 0; // matching engine time (orderbook only)
+    std::uint64_t    update_id = 0; // data.u (orderbook only)
+    std::uint64_t    seq       = 0; // data.seq (orderbook only)
+};
+
+struct BybitLevel {
+    trading::Side     side  = trading::Side::Buy;
+    trading::Price    price = 0;
+    trading::Quantity qty   = 0; // 0 = remove the level (delta)
+};
+
+struct BybitTrade {
+    trading::Side     taker_side = trading::Side::Buy;
+    trading::Price    price      = 0;
+    trading::Quantity qty        = 0;
+    std::int64_t      ts_ms      = 0;
+    std::string_view  trade_id;
+};
+
+// Handler with no-op callbacks; derive and hide the ones you need.
+//  - on_book_begin / on_level* / on_book_end for orderbook frames
+//    (b levels first, then a);
+//  - on_trade once per element of a publicTrade frame.
+// On Error the handler may already have seen part of the frame
+// (on_book_end is not called).
+struct BybitHandlerBase {
+    void on_book_begin(const BybitMessageHeader&) {}
+    void on_level(const BybitLevel&) {}
+    void on_book_end(const BybitMessageHeader&) {}
+    void on_trade(const BybitMessageHeader&, const BybitTrade&) {}
+};
+
+namespace detail {
+
+// Minimal forward-only JSON scanner over a frame. Strings are returned as raw
+// views (escape sequences are not decoded: keys and numeric strings in Bybit
+// frames never contain any).
+class JsonCursor {
+public:
+    JsonCursor(const char* begin, const char* end) noexcept : p_(begin), end_(end) {}
+
+    const char* pos() const noexcept { return p_; }
+
+    bool consume(char c) noexcept {
+        skip_ws();
+        if (p_ == end_ || *p_ != c) {
+            return false;
+        }
+        ++p_;
+        return true;
+    }
+
+    bool string(std::string_view& out) noexcept {
+        skip_ws();
+        if (p_ == end_ || *p_ != '"') {
+            return false;
+        }
+        const char* begin = ++p_;
+        while (p_ != end_ && *p_ != '"') {
+            if (*p_ == '\\' && ++p_ == end_) {
+                return false;
+            }
+            ++p_;
+        }
+        if (p_ == end_) {
+            return false;
+        }
+        out = std::string_view(begin, static_cast<std::size_t>(p_ - begin));
+        ++p_;
+        return true;
+    }
+
+    bool integer(std::int64_t& out) noexcept {
+        skip_ws();
+        const char* begin = p_;
+        while (p_ != end_ && (*p_ == '-' || (*p_ >= '0' && *p_ <= '9'))) {
+            ++p_;
+        }
+        return utils::parse_fixed_point(std::string_view(begin, static_cast<std::size_t>(p_ - begin)),
+                                        0, out);
+    }
+
+    // Skip any value; nested containers are skipped by bracket depth.
+    bool skip_value() noexcept {
+        skip_ws();
+        if (p_ == end_) {
+            return false;
+        }
+        if (*p_ == '"') {
+            std::string_view ignored;
+            return string(ignored);
+        }
+        if (*p_ == '{' || *p_ == '[') {
+            int depth = 0;
+            while (p_ != end_) {
+                const char c = *p_;
+                if (c == '"') {
+                    std::string_view ignored;
+                    if (!string(ignored)) {
+                        return false;
+                    }
+                    continue;
+                }
+                ++p_;
+                if (c == '{' || c == '[') {
+                    ++depth;
+                } else if ((c == '}' || c == ']') && --depth == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        // number / true / false / null
+        const char* begin = p_;
+        while (p_ != end_ && *p_ != ',' && *p_ != '}' && *p_ != ']' &&
+               *p_ != ' ' && *p_ != '\t' && *p_ != '\r' && *p_ != '\n') {
+            ++p_;
+        }
+        return p_ != begin;
+    }
+
+    // Iterate "key": value pairs of an object; on_member(key, cursor) must
+    // consume the value. Returns false on malformed input.
+    template <typename OnMember>
+    bool object(OnMember&& on_member) {
+        if (!consume('{')) {
+            return false;
+        }
+        if (consume('}')) {
+            return true;
+        }
+        do {
+            std::string_view key;
+            if (!string(key) || !consume(':') || !on_member(key)) {
+                return false;
+            }
+        } while (consume(','));
+        return consume('}');
+    }
+
+    // Iterate elements of an array; on_element() must consume the element.
+    template <typename OnElement>
+    bool array(OnElement&& on_element) {
+        if (!consume('[')) {
+            return false;
+        }
+        if (consume(']')) {
+            return true;
+        }
+        do {
+            if (!on_element()) {
+                return false;
+            }
+        } while (consume(','));
+        return consume(']');
+    }
+
+private:
+    void skip_ws() noexcept {
+        while (p_ != end_ && (*p_ == ' ' || *p_ == '\t' || *p_ == '\r' || *p_ == '\n')) {
+            ++p_;
+        }
+    }
+
+    const char* p_;
+    const char* end_;
+};
+
+// Raw [begin, end) of a value inside the frame, to revisit after the keys
+// it depends on (Bybit does not guarantee key order).
+struct JsonSpan {
+    const char* begin = nullptr;
+    const char* end   = nullptr;
+
+    bool empty() const noexcept { return begin == nullptr; }
+};
+
+inline bool capture(JsonCursor& c, JsonSpan& span) noexcept {
+    // pos() may point at whitespace before the value; JsonCursor skips it.
+    span.begin = c.pos();
+    if (!c.skip_value()) {
+        return false;
+    }
+    span.end = c.pos();
+    return true;
+}
+
+template <typename Handler>
+bool parse_levels(const JsonSpan& span, trading::Side side, const BybitScale& scale, Handler& handler) {
+    if (span.empty()) {
+        return true; // side absent in this delta
+    }
+    JsonCursor c(span.begin, span.end);
+    return c.array([&] {
+        std::string_view price_str;
+        std::string_view qty_str;
+        if (!c.consume('[') || !c.string(price_str) || !c.consume(',') ||
+            !c.string(qty_str) || !c.consume(']')) {
+            return false;
+        }
+        BybitLevel level;
+        level.side = side;
+        if (!utils::simd::parse_decimal(price_str, scale.price_decimals, level.price) ||
+            !utils::simd::parse_decimal(qty_str, scale.qty_decimals, level.qty)) {
+            return false;
+        }
+        handler.on_level(level);
+        return true;
+    });
+}
+
+template <typename Handler>
+bool parse_orderbook_data(const JsonSpan& data, BybitMessageHeader& header,
+                          const BybitScale& scale, Handler& handler) {
+    JsonSpan bids;
+    JsonSpan asks;
+
+    JsonCursor c(data.begin, data.end);
+    const bool ok = c.object([&](std::string_view key) {
+        std::int64_t v = 0;
+        if (key == "b") {
+            return capture(c, bids);
+        }
+        if (key == "a") {
+            return capture(c, asks);
+        }
+        if (key == "u") {
+            if (!c.integer(v)) {
+                return false;
+            }
+            header.update_id = static_cast<std::uint64_t>(v);
+            return true;
+        }
+        if (key == "seq") {
+            if (!c.integer(v)) {
+                return false;
+            }
+            header.seq = static_cast<std::uint64_t>(v);
+            return true;
+        }
+        return c.skip_value();
+    });
+    if (!ok) {
+        return false;
+    }
+
+    handler.on_book_begin(header);
+    if (!parse_levels(bids, trading::Side::Buy, scale, handler) ||
+        !parse_levels(asks, trading::Side::Sell, scale, handler)) {
+        return false;
+    }
+    handler.on_book_end(header);
+    return true;
+}
+
+template <typename Handler>
+bool parse_trade_data(const JsonSpan& data, const BybitMessageHeader& header,
+                      const BybitScale& scale, Handler& handler) {
+    JsonCursor c(data.begin, data.end);
+    return c.array([&] {
+        BybitTrade       trade;
+        std::string_view price_str;
+        std::string_view qty_str;
+        std::string_view side_str;
+
+        const bool ok = c.object([&](std::string_view key) {
+            if (key == "p") {
+                return c.string(price_str);
+            }
+            if (key == "v") {
+                return c.string(qty_str);
+            }
+            if (key == "S") {
+                return c.string(side_str);
+            }
+            if (key == "T") {
+                return c.integer(trade.ts_ms);
+            }
+            if (key == "i") {
+                return c.string(trade.trade_id);
+            }
+            return c.skip_value();
+        });
+        if (!ok ||
+            !utils::simd::parse_decimal(price_str, scale.price_decimals, trade.price) ||
+            !utils::simd::parse_decimal(qty_str, scale.qty_decimals, trade.qty)) {
+            return false;
+        }
+        // "S" is the taker side.
+        trade.taker_side = side_str == "Sell" ? trading::Side::Sell : trading::Side::Buy;
+        handler.on_trade(header, trade);
+        return true;
+    });
+}
+
+} // namespace detail
+
+// Parse one WS text frame. See BybitHandlerBase for the callbacks.
+template <typename Handler>
+BybitParseStatus parse_bybit_message(std::string_view frame, const BybitScale& scale, Handler& handler) {
+    using detail::JsonCursor;
+    using detail::JsonSpan;
+
+    BybitMessageHeader header;
+    std::string_view   type;
+    JsonSpan           data;
+
+    JsonCursor c(frame.data(), frame.data() + frame.size());
+    const bool ok = c.object([&](std::string_view key) {
+        if (key == "topic") {
+            return c.string(header.topic);
+        }
+        if (key == "type") {
+            return c.string(type);
+        }
+        if (key == "ts") {
+            return c.integer(header.ts_ms);
+        }
+        if (key == "cts") {
+            return c.integer(header.cts_ms);
+        }
+        if (key == "data") {
+            return detail::capture(c, data);
+        }
+        return c.skip_value();
+    });
+    if (!ok) {
+        return BybitParseStatus::Error;
+    }
+    if (header.topic.empty()) {
+        return BybitParseStatus::Control;
+    }
+
+    const auto dot = header.topic.rfind('.');
+    header.symbol  = header.topic.substr(dot == std::string_view::npos ? 0 : dot + 1);
+
+    if (header.topic.starts_with("orderbook.")) {
+        if (type == "snapshot") {
+            header.kind = BybitMessageKind::OrderbookSnapshot;
+        } else if (type == "delta") {
+            header.kind = BybitMessageKind::OrderbookDelta;
+        } else {
+            return BybitParseStatus::Unsupported;
+        }
+        if (data.empty()) {
+            return BybitParseStatus::Error;
+        }
+        return detail::parse_orderbook_data(data, header, scale, handler)
+                   ? BybitParseStatus::Ok
+                   : BybitParseStatus::Error;
+    }
+
+    if (header.topic.starts_with("publicTrade.")) {
+        header.kind = BybitMessageKind::PublicTrade;
+        if (data.empty()) {
+            return BybitParseStatus::Error;
+        }
+        return detail::parse_trade_data(data, header, scale, handler)
+                   ? BybitParseStatus::Ok
+                   : BybitParseStatus::Error;
+    }
+
+    return BybitParseStatus::Unsupported;
+}
+
+} // namespace exchange
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "trading/types.hpp"
+
+namespace trading {
+
+/**
+ * Book snapshot image: the full state of a BasicOrderBook in one flat file,
+ * written by save_snapshot() and restored by load_snapshot().
+ *
+ *   offset 0   BookSnapshotHeader               (magic "TRDBKIMG", version, sizes, counts)
+ *   offset 64  SnapshotOrder[order_count]       order slots, inactive ones included
+ *              std::uint32_t[free_count]        free slot list, padded to 8 bytes
+ *              SnapshotIndexEntry[index_count]  id index: id -> slot
+ *              SnapshotLevel[bid_levels]        best bid first
+ *              SnapshotLevel[ask_levels]        best ask first
+ *
+ * Order records are laid out exactly like the book's order slots (checked by
+ * static_asserts in order_book_impl.hpp) and keep their FIFO links, so a
+ * restore copies the slot array in one memcpy and never re-links orders; the
+ * levels are re-created from their records. The id index is stored as its
+ * (id, slot) entries and re-inserted, since its table layout depends on the
+ * IdIndex type and capacity.
+ * An image written by any level policy / id index loads into any other.
+ *
+ * Little-endian, native layout: the image is a fast restart file for the same
+ * build, not an interchange format.
+ */
+struct BookSnapshotHeader
+{
+    static constexpr char          kMagic[8]   = {'T', 'R', 'D', 'B', 'K', 'I', 'M', 'G'};
+    static constexpr std::uint16_t kVersion    = 1;
+    static constexpr std::uint16_t kEndianMark = 0x0102;
+
+    char          magic[8]{};
+    std::uint16_t version{kVersion};
+    std::uint16_t header_size{64};
+    std::uint16_t order_size{48};
+    std::uint16_t level_size{32};
+    std::uint16_t endian{kEndianMark};
+    std::uint16_t reserved0{0};
+    std::uint32_t reserved1{0};
+    std::uint64_t next_id{1};     // next id generated by add_limit_order
+    std::uint64_t order_count{0}; // order slots (= orders_.size())
+    std::uint64_t free_count{0};
+    std::uint32_t bid_levels{0};
+    std::uint32_t ask_levels{0};
+    std::uint64_t index_count{0};
+};
+
+/// On-disk order slot; field for field the book's Order, padding made explicit.
+struct SnapshotOrder
+{
+    std::uint64_t id{0};
+    std::int32_t  side{0}; // Side
+    std::uint32_t reserved0{0};
+    std::int64_t  price{0};
+    std::int64_t  qty{0};
+    std::uint8_t  active{0};
+    std::uint8_t  reserved1[3]{};
+    std::uint32_t prev{0};  // neighbours in the level FIFO (slot indices)
+    std::uint32_t next{0};
+    std::uint32_t reserved2{0};
+};
+
+/// On-disk id index entry.
+struct SnapshotIndexEntry
+{
+    std::uint64_t id{0};
+    std::uint32_t slot{0};
+    std::uint32_t reserved{0};
+};
+
+/// On-disk price level: FIFO ends and running aggregates.
+struct SnapshotLevel
+{
+    std::int64_t  price{0};
+    std::uint32_t head{0};
+    std::uint32_t tail{0};
+    std::int64_t  total_qty{0};
+    std::uint32_t order_count{0};
+    std::uint32_t reserved{0};
+};
+
+/// Sections of an image, in file order.
+struct BookSnapshotView
+{
+    std::uint64_t                       next_id{1};
+    std::span<const SnapshotOrder>      orders;
+    std::span<const std::uint32_t>      free_slots;
+    std::span<const SnapshotIndexEntry> index;
+    std::span<const SnapshotLevel>      bids;
+    std::span<const SnapshotLevel>      asks;
+};
+
+/// Write an image (to path + ".tmp", then rename, so a crash never leaves a
+/// half-written image under path). Throws std::runtime_error on I/O errors.
+void write_book_snapshot(const std::string& path, const BookSnapshotView& image);
+
+/**
+ * Read-only memory mapping of a book snapshot (POSIX mmap). The header and
+ * section sizes are validated on open, slot references (links, level ends,
+ * free list, index) when the book loads it. view() points into the mapping,
+ * valid for the lifetime of the object. Throws std::runtime_error on open /
+ * format errors.
+ */
+class MappedBookSnapshot
+{
+public:
+    explicit MappedBookSnapshot(const std::string& path);
+    ~MappedBookSnapshot();
+
+    MappedBookSnapshot(const MappedBookSnapshot&)            = delete;
+    MappedBookSnapshot& operator=(const MappedBookSnapshot&) = delete;
+
+    const BookSnapshotHeader& header() const noexcept { return header_; }
+    const BookSnapshotView&   view() const noexcept { return view_; }
+
+private:
+    void*              data_{nullptr};
+    std::size_t        length_{0};
+    BookSnapshotHeader header_{};
+    BookSnapshotView   view_{};
+};
+
+} // namespace trading
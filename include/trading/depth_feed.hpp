@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "trading/types.hpp"
+
+namespace trading {
+
+/// One level of an incremental L2 update.
+struct DepthChange
+{
+    Side          side{Side::Buy};
+    Price         price{0};
+    Quantity      qty{0};    // new total at price; 0 = level left the top N
+    std::uint32_t orders{0}; // resting orders (0 for aggregated books)
+};
+
+/**
+ * Incremental top-N depth publisher.
+ *
+ * Every update(book) reads the book's top N levels per side with
+ * book.depth() (BasicOrderBook or BasicLevelBook) and returns only what
+ * changed since the previous update:
+ *  - a level that is new in the top N or whose qty / order count changed,
+ *    with its new totals;
+ *  - a level that was in the top N and is not any more (removed, or pushed
+ *    below N), with qty 0.
+ * Changes are ordered bids first, then asks, best price first.
+ *
+ * Cost is O(N) per update whatever the book size or the number of events
+ * in between, and nothing is allocated after construction. The first update
+ * (and the first after reset()) reports the whole top N, i.e. a snapshot.
+ *
+ * NOT thread-safe; read it on the thread that owns the book.
+ */
+class DepthFeed
+{
+public:
+    explicit DepthFeed(std::size_t levels);
+
+    std::size_t levels() const noexcept { return levels_; }
+
+    /// Diff the book against the last update. The span is valid until the
+    /// next update() / reset().
+    template <typename Book>
+    std::span<const DepthChange> update(const Book& book)
+    {
+        for (std::size_t s = 0; s < 2; ++s)
+            cur_count_[s] = book.depth(kSides[s], levels_, std::span<LevelInfo>(cur_[s]));
+        return commit();
+    }
+
+    /// Top N of a side as of the last update, best first.
+    std::span<const LevelInfo> snapshot(Side side) const noexcept;
+
+    /// Forget the published state: the next update is a full snapshot.
+    void reset() noexcept;
+
+private:
+    static constexpr std::array<Side, 2> kSides{Side::Buy, Side::Sell};
+
+    std::span<const DepthChange> commit() noexcept;
+
+    std::size_t                           levels_;
+    std::array<std::vector<LevelInfo>, 2> prev_;
+    std::array<std::vector<LevelInfo>, 2> cur_;
+    std::array<std::size_t, 2>            prev_count_{};
+    std::array<std::size_t, 2>            cur_count_{};
+    std::vector<DepthChange>              changes_; // capacity 4 * levels
+};
+
+} // namespace trading
@@ -2,6 +2,7 @@
 
 #include "trading/types.hpp"
 
+#include <cstddef>
 #include <cstdint>
 
 namespace trading {
@@ -16,6 +17,7 @@ enum class EventType : std::uint8_t {
 // Simple event type for feeding the OrderBook from any source
 struct Event {
     EventType type      = EventType::Market;
+    InstrumentId instrument = 0; // book to route to (ShardedEngine); single-book code ignores it
     Side      side      = Side::Buy;
     Price     price     = 0;   // valid for Add
     Quantity  qty       = 0;   // valid for Add/Market
@@ -23,4 +25,41 @@ struct Event {
     std::int64_t ts_ns  = 0;   // feed timestamp in ns (optional)
 };
 
+// Aggregate result of OrderBook::apply over a batch of events.
+struct ApplyStats {
+    std::size_t adds         = 0;
+    std::size_t markets      = 0;
+    std::size_t cancels      = 0;
+    std::size_t cancels_hit  = 0;   // cancels that removed a resting order
+
+    std::size_t markets_full = 0;   // market orders filled completely
+    std::size_t markets_zero = 0;   // market orders that found no liquidity
+
+    Quantity market_filled_buy  = 0; // filled qty of aggressive market BUYs
+    Quantity market_filled_sell = 0; // filled qty of aggressive market SELLs
+    Quantity limit_filled       = 0; // taker qty of crossing limit orders
+
+    TopOfBook top;                   // top of book after the last event
+
+    std::size_t events() const noexcept { return adds + markets + cancels; }
+    Quantity    filled() const noexcept {
+        return market_filled_buy + market_filled_sell + limit_filled;
+    }
+
+    // Accumulate stats of a later batch (top is taken from `other`).
+    ApplyStats& operator+=(const ApplyStats& other) noexcept {
+        adds               += other.adds;
+        markets            += other.markets;
+        cancels            += other.cancels;
+        cancels_hit        += other.cancels_hit;
+        markets_full       += other.markets_full;
+        markets_zero       += other.markets_zero;
+        market_filled_buy  += other.market_filled_buy;
+        market_filled_sell += other.market_filled_sell;
+        limit_filled       += other.limit_filled;
+        top                 = other.top;
+        return *this;
+    }
+};
+
 } // namespace trading
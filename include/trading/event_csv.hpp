@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "trading/event.hpp"
+
+namespace trading {
+
+/**
+ * Text event formats, parsed in place over std::string_view with
+ * std::from_chars: no allocation, no exceptions, no locale. Fields are
+ * separated by ',' and may be padded with spaces / tabs; a trailing '\r' is
+ * ignored. Numbers are plain integers (ticks); a field with anything else
+ * ("1.5", "12abc", "+3") makes the line an Error. Extra trailing fields are
+ * ignored.
+ *
+ * Use utils::LineReader (utils/line_reader.hpp) to feed lines from a file
+ * or stdin in large blocks.
+ */
+enum class CsvParseStatus : std::uint8_t {
+    Ok,    // `out` holds the event
+    Skip,  // blank line or '#' comment
+    Error, // malformed line; `out` is unspecified
+};
+
+/**
+ * Replay format (trading_generate output):
+ *
+ *   ADD,side,price,qty,id      side: BUY / SELL / B / S (any case)
+ *   MKT,side,qty               (or MARKET)
+ *   CANCEL,id                  (or CXL)
+ */
+CsvParseStatus parse_csv_event(std::string_view line, Event& out) noexcept;
+
+/**
+ * Live feed format (trading_live_feed stdin):
+ *
+ *   ts_ns,type,side,price,qty  type: A (add) / T (trade -> market) / C (cancel)
+ *
+ * side starting with 'B' / 'b' is Buy, anything else Sell. The format has
+ * no order ids: id is 0 (an Add gets a book-generated id, a Cancel misses).
+ */
+CsvParseStatus parse_feed_event(std::string_view line, Event& out) noexcept;
+
+} // namespace trading
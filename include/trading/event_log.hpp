@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "trading/event.hpp"
+#include "trading/types.hpp"
+
+namespace trading {
+
+/**
+ * Binary event log: a 64-byte header followed by fixed 40-byte records.
+ *
+ *   offset 0   EventLogHeader  (magic "TRDEVLOG", version, sizes, scale, count)
+ *   offset 64  EventRecord[record_count]
+ *
+ * Records are little-endian and laid out exactly like trading::Event (checked
+ * by static_asserts in event_log.cpp), so a mapped file is replayed as a
+ * std::span<const Event> straight from the page cache: no parsing, no copy,
+ * no allocation. Prices / quantities are integer ticks; the header records
+ * the decimal scale they were produced with (informational for the book).
+ */
+struct EventLogHeader
+{
+    static constexpr char          kMagic[8]   = {'T', 'R', 'D', 'E', 'V', 'L', 'O', 'G'};
+    static constexpr std::uint16_t kVersion    = 1;
+    static constexpr std::uint16_t kEndianMark = 0x0102;
+
+    char          magic[8]{};
+    std::uint16_t version{kVersion};
+    std::uint16_t header_size{64};
+    std::uint16_t record_size{40};
+    std::uint16_t endian{kEndianMark};
+    std::uint32_t price_decimals{0}; // price tick = 10^-price_decimals
+    std::uint32_t qty_decimals{0};   // qty tick   = 10^-qty_decimals
+    std::uint64_t record_count{0};
+    std::uint8_t  reserved[32]{};
+};
+
+/// On-disk record; field for field the layout of Event, padding made explicit.
+struct EventRecord
+{
+    std::uint8_t  type{0};       // EventType
+    std::uint8_t  reserved0{0};
+    std::uint16_t instrument{0}; // InstrumentId
+    std::int32_t  side{0};       // Side
+    std::int64_t  price{0};
+    std::int64_t  qty{0};
+    std::uint64_t id{0};
+    std::int64_t  ts_ns{0};
+};
+
+EventRecord to_record(const Event& ev) noexcept;
+
+/// Decimal scale stored in the header.
+struct EventLogScale
+{
+    std::uint32_t price_decimals{0};
+    std::uint32_t qty_decimals{0};
+};
+
+/**
+ * Buffered writer. The record count in the header is patched by close()
+ * (also called by the destructor). Throws std::runtime_error on I/O errors.
+ */
+class EventLogWriter
+{
+public:
+    EventLogWriter(const std::string& path, const EventLogScale& scale = {});
+    ~EventLogWriter();
+
+    EventLogWriter(const EventLogWriter&)            = delete;
+    EventLogWriter& operator=(const EventLogWriter&) = delete;
+
+    void write(const Event& ev);
+    void write(std::span<const Event> events);
+
+    /// Flush, write the final header and close the file. Idempotent.
+    void close();
+
+    std::uint64_t count() const noexcept { return count_; }
+
+private:
+    void flush();
+
+    std::FILE*               file_{nullptr};
+    std::string              path_;
+    EventLogHeader           header_{};
+    std::vector<EventRecord> buffer_;
+    std::uint64_t            count_{0};
+};
+
+/**
+ * Read-only memory mapping of an event log (POSIX mmap). The header is
+ * validated on open; events() is a view into the mapping, valid for the
+ * lifetime of the object. Throws std::runtime_error on open / format errors.
+ */
+class MappedEventLog
+{
+public:
+    explicit MappedEventLog(const std::string& path);
+    ~MappedEventLog();
+
+    MappedEventLog(const MappedEventLog&)            = delete;
+    MappedEventLog& operator=(const MappedEventLog&) = delete;
+
+    const EventLogHeader& header() const noexcept { return header_; }
+
+    std::span<const Event> events() const noexcept { return events_; }
+    std::size_t            size() const noexcept { return events_.size(); }
+
+private:
+    void*                  data_{nullptr};
+    std::size_t            length_{0};
+    EventLogHeader         header_{};
+    std::span<const Event> events_;
+};
+
+/// True if the file exists and starts with the event log magic.
+bool is_event_log(const std::string& path);
+
+} // namespace trading
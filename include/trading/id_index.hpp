@@ -0,0 +1,275 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "trading/types.hpp"
+#include "utils/prefetch.hpp"
+
+namespace trading {
+
+/**
+ * OrderId -> order slot indices used by BasicOrderBook (id_to_index_).
+ *
+ * Interface shared by all indices:
+ *  - std::uint32_t find(OrderId id) const noexcept;  // kNoSlot if absent
+ *  - void insert(OrderId id, std::uint32_t slot);    // insert or overwrite
+ *  - bool erase(OrderId id) noexcept;                // true if id was present
+ *  - void reserve(std::size_t n);
+ *  - void clear() noexcept;
+ *  - std::size_t size() const noexcept;
+ *  - void prefetch(OrderId id) const noexcept;       // cache hint for find/insert
+ *  - void for_each(Fn&& fn) const;                   // fn(OrderId, slot) per entry, any order
+ *
+ * After reserve() for the expected number of live ids neither index
+ * allocates on insert/erase.
+ */
+inline constexpr std::uint32_t kNoSlot = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * Flat open-addressing hash table (linear probing, backward-shift deletion,
+ * no tombstones). Keys and values live in two preallocated arrays; the table
+ * doubles when the load factor would exceed 1/2. Works for arbitrary ids.
+ */
+class FlatIdIndex
+{
+public:
+    FlatIdIndex() { rehash(kMinCapacity); }
+
+    std::uint32_t find(OrderId id) const noexcept
+    {
+        if (id == kEmptyKey)
+            return has_empty_key_ ? empty_key_slot_ : kNoSlot;
+
+        for (std::size_t pos = home(id);; pos = (pos + 1) & mask_)
+        {
+            if (keys_[pos] == id)
+                return slots_[pos];
+            if (keys_[pos] == kEmptyKey)
+                return kNoSlot;
+        }
+    }
+
+    void insert(OrderId id, std::uint32_t slot)
+    {
+        if (id == kEmptyKey)
+        {
+            size_ += has_empty_key_ ? 0 : 1;
+            has_empty_key_  = true;
+            empty_key_slot_ = slot;
+            return;
+        }
+
+        if (2 * (size_ + 1) > keys_.size())
+            rehash(2 * keys_.size());
+
+        std::size_t pos = home(id);
+        while (keys_[pos] != kEmptyKey && keys_[pos] != id)
+            pos = (pos + 1) & mask_;
+
+        if (keys_[pos] == kEmptyKey)
+        {
+            keys_[pos] = id;
+            ++size_;
+        }
+        slots_[pos] = slot;
+    }
+
+    bool erase(OrderId id) noexcept
+    {
+        if (id == kEmptyKey)
+        {
+            if (!has_empty_key_)
+                return false;
+            has_empty_key_ = false;
+            --size_;
+            return true;
+        }
+
+        std::size_t pos = home(id);
+        while (keys_[pos] != id)
+        {
+            if (keys_[pos] == kEmptyKey)
+                return false;
+            pos = (pos + 1) & mask_;
+        }
+
+        // Backward shift: pull following entries of the cluster into the hole
+        // unless that would move them before their home position.
+        std::size_t hole = pos;
+        for (std::size_t next = (hole + 1) & mask_; keys_[next] != kEmptyKey; next = (next + 1) & mask_)
+        {
+            const std::size_t h = home(keys_[next]);
+            if (((next - h) & mask_) >= ((next - hole) & mask_))
+            {
+                keys_[hole]  = keys_[next];
+                slots_[hole] = slots_[next];
+                hole         = next;
+            }
+        }
+        keys_[hole] = kEmptyKey;
+        --size_;
+        return true;
+    }
+
+    void reserve(std::size_t n)
+    {
+        const std::size_t want = std::bit_ceil(2 * n);
+        if (want > keys_.size())
+            rehash(want);
+    }
+
+    void clear() noexcept
+    {
+        std::fill(keys_.begin(), keys_.end(), kEmptyKey);
+        has_empty_key_ = false;
+        size_          = 0;
+    }
+
+    std::size_t size() const noexcept { return size_; }
+
+    void prefetch(OrderId id) const noexcept
+    {
+        const std::size_t pos = home(id);
+        utils::prefetch(&keys_[pos]);
+        utils::prefetch(&slots_[pos]);
+    }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const
+    {
+        if (has_empty_key_)
+            fn(kEmptyKey, empty_key_slot_);
+        for (std::size_t pos = 0; pos < keys_.size(); ++pos)
+        {
+            if (keys_[pos] != kEmptyKey)
+                fn(keys_[pos], slots_[pos]);
+        }
+    }
+
+private:
+    static constexpr OrderId     kEmptyKey    = 0; // id 0 is stored out of line
+    static constexpr std::size_t kMinCapacity = 1024;
+
+    std::size_t home(OrderId id) const noexcept
+    {
+        // Fibonacci hashing: top bits of id * 2^64/phi.
+        return static_cast<std::size_t>((id * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    void rehash(std::size_t capacity)
+    {
+        std::vector<OrderId>       old_keys(capacity, kEmptyKey);
+        std::vector<std::uint32_t> old_slots(capacity, kNoSlot);
+        old_keys.swap(keys_);   // old_* now hold the previous table
+        old_slots.swap(slots_);
+
+        mask_  = capacity - 1;
+        shift_ = static_cast<unsigned>(64 - std::countr_zero(capacity));
+
+        for (std::size_t i = 0; i < old_keys.size(); ++i)
+        {
+            if (old_keys[i] == kEmptyKey)
+                continue;
+            std::size_t pos = home(old_keys[i]);
+            while (keys_[pos] != kEmptyKey)
+                pos = (pos + 1) & mask_;
+            keys_[pos]  = old_keys[i];
+            slots_[pos] = old_slots[i];
+        }
+    }
+
+    std::vector<OrderId>       keys_;
+    std::vector<std::uint32_t> slots_;
+    std::size_t                mask_{0};
+    unsigned                   shift_{64};
+    std::size_t                size_{0};
+    bool                       has_empty_key_{false};
+    std::uint32_t              empty_key_slot_{kNoSlot};
+};
+
+/**
+ * Direct-mapped index: slots_[id]. For feeds whose ids are dense and
+ * increasing (trading_generate, mt_bench EventGenerator, ids generated by
+ * add_limit_order). Memory is proportional to the largest id seen, so ids
+ * above kMaxId throw std::length_error.
+ */
+class DirectIdIndex
+{
+public:
+    static constexpr OrderId kMaxId = (OrderId{1} << 28) - 1;
+
+    DirectIdIndex() { reserve(1024); }
+
+    std::uint32_t find(OrderId id) const noexcept
+    {
+        return id < slots_.size() ? slots_[static_cast<std::size_t>(id)] : kNoSlot;
+    }
+
+    void insert(OrderId id, std::uint32_t slot)
+    {
+        if (id >= slots_.size())
+            grow(id);
+        std::uint32_t& cell = slots_[static_cast<std::size_t>(id)];
+        size_ += (cell == kNoSlot) ? 1 : 0;
+        cell = slot;
+    }
+
+    bool erase(OrderId id) noexcept
+    {
+        if (id >= slots_.size() || slots_[static_cast<std::size_t>(id)] == kNoSlot)
+            return false;
+        slots_[static_cast<std::size_t>(id)] = kNoSlot;
+        --size_;
+        return true;
+    }
+
+    /// Reserve ids [0, n).
+    void reserve(std::size_t n)
+    {
+        if (n > slots_.size())
+            slots_.resize(n, kNoSlot);
+    }
+
+    void clear() noexcept
+    {
+        std::fill(slots_.begin(), slots_.end(), kNoSlot);
+        size_ = 0;
+    }
+
+    std::size_t size() const noexcept { return size_; }
+
+    void prefetch(OrderId id) const noexcept
+    {
+        if (id < slots_.size())
+            utils::prefetch(&slots_[static_cast<std::size_t>(id)]);
+    }
+
+    template <typename Fn>
+    void for_each(Fn&& fn) const
+    {
+        for (std::size_t id = 0; id < slots_.size(); ++id)
+        {
+            if (slots_[id] != kNoSlot)
+                fn(static_cast<OrderId>(id), slots_[id]);
+        }
+    }
+
+private:
+    void grow(OrderId id)
+    {
+        if (id > kMaxId)
+            throw std::length_error("DirectIdIndex: order id exceeds kMaxId");
+        slots_.resize(std::bit_ceil(static_cast<std::size_t>(id) + 1), kNoSlot);
+    }
+
+    std::vector<std::uint32_t> slots_;
+    std::size_t                size_{0};
+};
+
+} // namespace trading
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <span>
+
+#include "trading/price_levels.hpp"
+#include "trading/types.hpp"
+
+namespace trading {
+
+/**
+ * Level-aggregated (L2) book: price -> total quantity per side, without
+ * individual orders or matching.
+ *
+ * Intended for exchange market-data feeds that publish aggregated levels
+ * (Bybit orderbook.N `b` / `a` arrays): a snapshot is clear() followed by
+ * set_level() per level, a delta is set_level() per changed level, applied
+ * in place. Prices and quantities are integer ticks.
+ *
+ * LevelPolicy selects the level container as in BasicOrderBook
+ * (price_levels.hpp). After reserve(n) neither container allocates while
+ * at most n levels per side are live.
+ *
+ * NOT thread-safe.
+ */
+template <typename LevelPolicy>
+class BasicLevelBook
+{
+public:
+    BasicLevelBook() { reserve(kDefaultLevels); }
+
+    explicit BasicLevelBook(std::size_t max_levels) { reserve(max_levels); }
+
+    /// Preallocate for max_levels price levels per side.
+    void reserve(std::size_t max_levels)
+    {
+        bids_.reserve(max_levels);
+        asks_.reserve(max_levels);
+    }
+
+    bool empty() const noexcept { return bids_.empty() && asks_.empty(); }
+
+    /// Remove all levels, keeping reserved memory.
+    void clear() noexcept
+    {
+        bids_.clear();
+        asks_.clear();
+        bid_levels_ = 0;
+        ask_levels_ = 0;
+    }
+
+    /// Set the total quantity at price; qty <= 0 removes the level
+    /// (removing an absent level is a no-op).
+    void set_level(Side side, Price price, Quantity qty)
+    {
+        if (side == Side::Buy)
+            set_level(bids_, bid_levels_, price, qty);
+        else
+            set_level(asks_, ask_levels_, price, qty);
+    }
+
+    /// Quantity at price, 0 if there is no such level.
+    Quantity level_qty(Side side, Price price) const noexcept
+    {
+        const Level* level = side == Side::Buy ? bids_.find(price) : asks_.find(price);
+        return level ? level->qty : 0;
+    }
+
+    /// Number of price levels on a side.
+    std::size_t level_count(Side side) const noexcept
+    {
+        return side == Side::Buy ? bid_levels_ : ask_levels_;
+    }
+
+    LevelInfo best_bid() const noexcept { return best_level_info(bids_); }
+    LevelInfo best_ask() const noexcept { return best_level_info(asks_); }
+
+    TopOfBook top_of_book() const noexcept
+    {
+        return TopOfBook{best_level_info(bids_), best_level_info(asks_)};
+    }
+
+    /// Top-N depth of one side, best first (same contract as
+    /// BasicOrderBook::depth; orders is 0, levels are aggregated).
+    std::size_t depth(Side side, std::size_t n, std::span<LevelInfo> out) const noexcept
+    {
+        n = std::min(n, out.size());
+        std::size_t k    = 0;
+        const auto  emit = [&](Price price, const Level& level) {
+            out[k++] = LevelInfo{true, price, level.qty, 0};
+        };
+        return side == Side::Buy ? bids_.visit_best(n, emit) : asks_.visit_best(n, emit);
+    }
+
+private:
+    static constexpr std::size_t kDefaultLevels = 256;
+
+    struct Level
+    {
+        Quantity qty{0};
+    };
+
+    using BidBook = typename LevelPolicy::template container<Level, std::greater<Price>>;
+    using AskBook = typename LevelPolicy::template container<Level, std::less<Price>>;
+
+    template <typename Book>
+    static void set_level(Book& book, std::size_t& count, Price price, Quantity qty)
+    {
+        if (qty > 0)
+        {
+            Level* level = book.find(price);
+            if (!level)
+            {
+                level = &book.get_or_create(price);
+                ++count;
+            }
+            level->qty = qty;
+        }
+        else if (book.find(price))
+        {
+            book.erase(price);
+            --count;
+        }
+    }
+
+    template <typename Book>
+    static LevelInfo best_level_info(const Book& book) noexcept
+    {
+        LevelInfo info;
+        if (book.empty())
+            return info;
+
+        info.valid  = true;
+        info.price  = book.best_price();
+        info.qty    = book.best_level().qty;
+        info.orders = 0; // levels are aggregated, order count is unknown
+        return info;
+    }
+
+    BidBook bids_;
+    AskBook asks_;
+
+    std::size_t bid_levels_{0};
+    std::size_t ask_levels_{0};
+};
+
+/// Default level book: std::map levels (pooled nodes).
+using LevelBook = BasicLevelBook<MapLevels>;
+
+/// Tick-indexed ladder levels, for instruments in a bounded tick band.
+using LadderLevelBook = BasicLevelBook<LadderLevels>;
+
+// Instantiated once in src/level_book.cpp.
+extern template class BasicLevelBook<MapLevels>;
+extern template class BasicLevelBook<LadderLevels>;
+
+} // namespace trading
@@ -1,32 +1,119 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <map>
-#include <unordered_map>
+#include <functional>
+#include <span>
+#include <string>
 #include <vector>
 
+#include "trading/book_snapshot.hpp"
+#include "trading/event.hpp"
+#include "trading/id_index.hpp"
+#include "trading/order_book_traits.hpp"
+#include "trading/price_levels.hpp"
 #include "trading/types.hpp"
 
 namespace trading {
 
+/**
+ * Capacity plan for BasicOrderBook, applied by the constructor or reserve().
+ *
+ * While the book stays within it, add / cancel / match never call the
+ * allocator: orders and the free list live in preallocated arrays, the id
+ * index is sized for max_orders ids, and each side keeps max_levels level
+ * slots (pooled map nodes or ladder ticks). Levels are intrusive FIFOs over
+ * the order array, so per-level depth needs no storage of its own.
+ *
+ * Exceeding the plan is not an error: the book grows as usual.
+ * DirectIdIndex reserves ids [0, max_orders); larger ids grow it.
+ */
+struct OrderBookConfig
+{
+    std::size_t max_orders{1024}; // peak number of resting orders
+    std::size_t max_levels{64};   // peak number of price levels per side
+};
+
 /**
  * In-memory limit order book for a single instrument.
  *
  * Design
- *  - Two price books:
- *      * bids_ : Price -> Level, ordered by std::greater (best bid at begin()).
- *      * asks_ : Price -> Level, ordered by std::less   (best ask at begin()).
- *  - Each Level stores indices into a flat vector<Order> orders_.
- *  - id_to_index_ maps external OrderId to the index in orders_.
+ *  - Two price books, one per side, stored in a LevelPolicy container
+ *    (see price_levels.hpp):
+ *      * bids_ : Price -> Level, ordered by std::greater (best bid first).
+ *      * asks_ : Price -> Level, ordered by std::less   (best ask first).
+ *  - Orders live in a flat vector<Order> orders_; each Level is an intrusive
+ *    doubly-linked FIFO over orders_ (Order::prev / Order::next), so cancel
+ *    and fill unlink an order in O(1) without touching its neighbours.
+ *  - id_to_index_ (an IdIndex, see id_index.hpp) maps external OrderId
+ *    to the index in orders_.
  *  - free_indices_ stores reusable indices in orders_.
  *
+ * Traits (order_book_traits.hpp) fix the variant at compile time:
+ *  - level_policy selects the level container:
+ *      * MapLevels    : std::map per side (OrderBook).
+ *      * LadderLevels : tick-indexed array with a best-level cursor
+ *                       (LadderOrderBook).
+ *  - id_index selects the OrderId index:
+ *      * FlatIdIndex   : open-addressing hash table, any ids (default).
+ *      * DirectIdIndex : array indexed by id, for dense increasing ids.
+ *  - tick_scale is the instrument's price / qty scale (Book::tick_scale).
+ *  - max_orders / max_levels are the default constructor's capacity plan.
+ *  OrderBookWith<LevelPolicy, IdIndex> is the book with default scale and
+ *  capacity.
+ *
+ * Sides
+ *  - Side-dependent code (which book to rest on or match against, the
+ *    crossing test) is instantiated per Side from templates: the public
+ *    methods take a runtime Side and branch on it once, on entry.
+ *
+ * Memory
+ *  - OrderBookConfig / reserve() preallocate orders, index and levels; after
+ *    that the book makes no steady-state allocations (see OrderBookConfig).
+ *    clear() keeps the reserved memory.
+ *
+ * Fills
+ *  - add_limit_order(_with_id) and execute_market_order have overloads that
+ *    take a fill sink: any callable invoked as on_fill(const Trade&) once per
+ *    maker fill (maker id, price, qty), in matching order. Nothing is
+ *    allocated; the overloads without a sink use NullFillSink.
+ *
+ * Batches
+ *  - apply(span<const Event>) is the shared hot loop of the drivers (replay,
+ *    live feed, mt_bench): it dispatches each event, prefetches the index
+ *    entries / order slots / levels of events a few positions ahead and
+ *    reads the top of book once at the end of the batch (ApplyStats). An
+ *    overload calls a per-event hook after each event, for callers that
+ *    need per-event timing without giving up the batch.
+ *
+ * Bulk build
+ *  - load_levels(bids, asks) replaces the book with one order per level of
+ *    a sorted, uncrossed exchange snapshot in one linear pass: no matching,
+ *    no level search (append_worst), storage reserved up front.
+ *
+ * Snapshots
+ *  - save_snapshot() writes the whole state (order slots with their FIFO
+ *    links, free list, levels, next generated id) to a flat image, and
+ *    load_snapshot() restores it with one memcpy of the slot array, so a
+ *    restart replays only the event-log tail (see book_snapshot.hpp).
+ *
  * All methods are NOT thread-safe; external synchronisation is required
  * if the book is shared between threads.
  */
-class OrderBook
+template <typename Traits>
+class BasicOrderBook
 {
 public:
-    OrderBook();
+    using traits     = Traits;
+    using tick_scale = typename Traits::tick_scale;
+
+    /// Reserves OrderBookConfig{Traits::max_orders, Traits::max_levels}.
+    BasicOrderBook();
+
+    explicit BasicOrderBook(const OrderBookConfig& config);
+
+    /// Preallocate for config; never shrinks. May be called on a live book.
+    void reserve(const OrderBookConfig& config);
 
     /// True if there are no active bids and asks.
     bool empty() const noexcept;
@@ -35,11 +122,21 @@ public:
     void clear() noexcept;
 
     /// Aggregate best bid (highest price) with total quantity at that level.
+    /// O(1): levels keep running totals.
     LevelInfo best_bid() const noexcept;
 
     /// Aggregate best ask (lowest price) with total quantity at that level.
+    /// O(1): levels keep running totals.
     LevelInfo best_ask() const noexcept;
 
+    /// Best bid and best ask in one call, without any scan.
+    TopOfBook top_of_book() const noexcept;
+
+    /// Top-N depth of one side, best first: fills out[0, k) with
+    /// k = min(n, out.size(), levels on the side) and returns k. Aggregates
+    /// are the running level totals, so this is O(k) with no allocation.
+    std::size_t depth(Side side, std::size_t n, std::span<LevelInfo> out) const noexcept;
+
     /// Create a new limit order, id is generated inside the book.
     /// If qty <= 0, returns 0 and does nothing.
     ///
@@ -47,6 +144,10 @@ public:
     /// returns 0 and the order is not inserted into the book.
     OrderId add_limit_order(Side side, Price price, Quantity qty);
 
+    /// Same as above, reporting every fill of the taker part to on_fill.
+    template <typename FillSink>
+    OrderId add_limit_order(Side side, Price price, Quantity qty, FillSink&& on_fill);
+
     /// Create a new limit order with a pre-defined id (for replay/benchmarks).
     /// If qty <= 0, simply returns id and does nothing.
     ///
@@ -54,6 +155,11 @@ public:
     /// the order is not inserted into the book.
     OrderId add_limit_order_with_id(OrderId id, Side side, Price price, Quantity qty);
 
+    /// Same as above, reporting every fill of the taker part to on_fill.
+    template <typename FillSink>
+    OrderId add_limit_order_with_id(OrderId id, Side side, Price price, Quantity qty,
+                                    FillSink&& on_fill);
+
     /// Cancel order by id. Returns true if an active order was cancelled.
     bool cancel(OrderId id);
 
@@ -61,46 +167,173 @@ public:
     /// For side == Buy it hits the best asks, for Sell — the best bids.
     MatchResult execute_market_order(Side side, Quantity qty);
 
+    /// Same as above, reporting every maker fill to on_fill.
+    template <typename FillSink>
+    MatchResult execute_market_order(Side side, Quantity qty, FillSink&& on_fill);
+
+    /// Apply events in order and return aggregate stats.
+    ///  - Add    : add_limit_order_with_id(ev.id, ...); ev.id == 0 lets the
+    ///             book generate the id (feeds without order ids).
+    ///  - Market : execute_market_order(ev.side, ev.qty).
+    ///  - Cancel : cancel(ev.id).
+    ///  - End    : ignored.
+    ApplyStats apply(std::span<const Event> events);
+
+    /// Same as above, reporting every fill (market and crossing limit) to on_fill.
+    template <typename FillSink>
+    ApplyStats apply(std::span<const Event> events, FillSink&& on_fill);
+
+    /// Same as above, also calling after_event(i) once events[i] is fully
+    /// applied (e.g. to stamp per-event latency inside one batch).
+    template <typename FillSink, typename EventHook>
+    ApplyStats apply(std::span<const Event> events, FillSink&& on_fill, EventHook&& after_event);
+
+    /// Replace the book content with one resting order per level, as
+    /// clear() followed by add_limit_order for every bid, then every ask
+    /// (same generated ids), without the matching and level lookups.
+    /// Levels must be best first and strictly sorted (bids descending, asks
+    /// ascending) and best bid < best ask; levels with qty <= 0 are skipped.
+    /// Throws std::invalid_argument otherwise, leaving the book unchanged.
+    void load_levels(std::span<const PriceLevel> bids, std::span<const PriceLevel> asks);
+
+    /// Write the book state to an image file (atomically replaced).
+    /// Throws std::runtime_error on I/O errors.
+    void save_snapshot(const std::string& path) const;
+
+    /// Replace the book state with an image written by save_snapshot() of any
+    /// BasicOrderBook. The book then behaves exactly like the saved one (same
+    /// slots, FIFO order and generated ids). Throws std::runtime_error on I/O
+    /// or format errors (links, FIFO chains, free list and index are all
+    /// checked), std::length_error if the image does not fit the level
+    /// container / id index; the book is unchanged in either case.
+    void load_snapshot(const std::string& path);
+
+    /// Same as above from an already mapped image.
+    void load_snapshot(const MappedBookSnapshot& image);
+
 private:
+    using OrderIndex = std::uint32_t;
+
+    static constexpr OrderIndex kNoIndex = kNoSlot;
+
     struct Order
     {
-        OrderId  id{0};
-        Side     side{Side::Buy};
-        Price    price{0};
-        Quantity qty{0};
-        bool     active{false};
+        OrderId    id{0};
+        Side       side{Side::Buy};
+        Price      price{0};
+        Quantity   qty{0};
+        bool       active{false};
+        OrderIndex prev{kNoIndex}; // neighbours in the level FIFO
+        OrderIndex next{kNoIndex};
     };
 
-    using OrderIndex = std::uint32_t;
-
     struct Level
     {
-        // Indices into orders_.
-        std::vector<OrderIndex> indices;
+        // FIFO of orders at this price: head is the oldest (first to fill).
+        OrderIndex    head{kNoIndex};
+        OrderIndex    tail{kNoIndex};
+        // Running aggregates, maintained by link_back / unlink / fills.
+        Quantity      total_qty{0};
+        std::uint32_t order_count{0};
     };
 
-    using BidBook = std::map<Price, Level, std::greater<Price>>;
-    using AskBook = std::map<Price, Level, std::less<Price>>;
+    using LevelPolicy = typename Traits::level_policy;
+    using IdIndex     = typename Traits::id_index;
+
+    using BidBook = typename LevelPolicy::template container<Level, std::greater<Price>>;
+    using AskBook = typename LevelPolicy::template container<Level, std::less<Price>>;
+
+    /// Levels orders of side S rest on, and the ones they match against.
+    template <Side S>
+    auto& own_book() noexcept;
+    template <Side S>
+    auto& opposite_book() noexcept;
+
+    /// Whether a taker of side S at limit crosses a resting level_price.
+    template <Side S>
+    static bool crosses(Price level_price, Price limit) noexcept;
 
     OrderIndex allocate_slot();
 
-    /// Core matching routine: matches qty against book until either qty == 0
-    /// or should_cross(level_price) returns false.
-    template <typename Book, typename PricePredicate>
-    Quantity match_on_book(Book& book, Quantity qty, PricePredicate&& should_cross);
+    /// Append orders_[idx] to the back of the level FIFO.
+    void link_back(Level& level, OrderIndex idx) noexcept;
+
+    /// Remove orders_[idx] from the level FIFO in O(1).
+    void unlink(Level& level, OrderIndex idx) noexcept;
+
+    /// load_levels(): append validated levels, worst last, one order each.
+    template <Side S>
+    void append_levels(std::span<const PriceLevel> levels);
+
+    /// The add_limit_order(_with_id) bodies for one side.
+    template <Side S, typename FillSink>
+    OrderId add_limit(Price price, Quantity qty, FillSink& on_fill);
+    template <Side S, typename FillSink>
+    OrderId add_limit_with_id(OrderId id, Price price, Quantity qty, FillSink& on_fill);
+
+    /// Insert a resting order (after the taker part has been matched).
+    template <Side S>
+    void insert_resting(OrderIndex idx, OrderId id, Price price, Quantity qty);
+
+    /// Unlink a resting order from its level (erasing an empty level),
+    /// mark it inactive and return its slot to the pool.
+    void remove_resting(OrderIndex idx);
+    template <Side S>
+    void remove_resting_from(OrderIndex idx);
+
+    /// Aggregate info of the best level of a side.
+    template <typename Book>
+    LevelInfo best_level_info(const Book& book) const noexcept;
+
+    /// Core matching routine: matches qty of a taker of side S against the
+    /// opposite book until either qty == 0 or should_cross(level_price)
+    /// returns false. Every maker fill is reported to on_fill.
+    template <Side S, typename PricePredicate, typename FillSink>
+    Quantity match_on_book(Quantity qty, PricePredicate&& should_cross, FillSink& on_fill);
 
     /// Match an incoming LIMIT order (taker part) against the opposite side.
     /// Returns remaining quantity that should rest as maker (0 if fully filled).
-    Quantity match_incoming_limit(Side side, Price price, Quantity qty);
+    template <Side S, typename FillSink>
+    Quantity match_incoming_limit(Price price, Quantity qty, FillSink& on_fill);
+
+    template <Side S, typename FillSink>
+    Quantity match_market(Quantity qty, FillSink& on_fill);
+
+    /// apply(): how far ahead the id index entry, and then the order slot /
+    /// level, of an upcoming event are prefetched.
+    static constexpr std::size_t kPrefetchIndexDistance = 8;
+    static constexpr std::size_t kPrefetchSlotDistance  = 2;
+
+    void prefetch_index(const Event& ev) const noexcept;
+    void prefetch_slot(const Event& ev) const noexcept;
 
     BidBook bids_;
     AskBook asks_;
 
     std::vector<Order>      orders_;        // indexed by OrderIndex (0-based)
     std::vector<OrderIndex> free_indices_;  // free slots for reuse
-    std::unordered_map<OrderId, OrderIndex> id_to_index_;
+    IdIndex                 id_to_index_;
 
     OrderId next_id_{1};
 };
 
+/// Book with the given level container and id index, default scale and capacity.
+template <typename LevelPolicy, typename IdIndex = FlatIdIndex>
+using OrderBookWith = BasicOrderBook<OrderBookTraits<LevelPolicy, IdIndex>>;
+
+/// Default book: std::map price levels.
+using OrderBook = OrderBookWith<MapLevels>;
+
+/// Tick-indexed ladder price levels, for instruments in a bounded tick band.
+using LadderOrderBook = OrderBookWith<LadderLevels>;
+
+// All level/index combinations with default traits are instantiated once in
+// src/order_book.cpp; other traits are instantiated where they are used.
+extern template class BasicOrderBook<OrderBookTraits<MapLevels, FlatIdIndex>>;
+extern template class BasicOrderBook<OrderBookTraits<MapLevels, DirectIdIndex>>;
+extern template class BasicOrderBook<OrderBookTraits<LadderLevels, FlatIdIndex>>;
+extern template class BasicOrderBook<OrderBookTraits<LadderLevels, DirectIdIndex>>;
+
 } // namespace trading
+
+#include "trading/order_book_impl.hpp"
@@ -0,0 +1,762 @@
+#pragma once
+
+// Member definitions of BasicOrderBook; included from order_book.hpp.
+
+#include <algorithm> // std::min
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "utils/prefetch.hpp"
+
+namespace trading {
+
+template <typename Traits>
+BasicOrderBook<Traits>::BasicOrderBook()
+    : BasicOrderBook(OrderBookConfig{Traits::max_orders, Traits::max_levels})
+{}
+
+template <typename Traits>
+BasicOrderBook<Traits>::BasicOrderBook(const OrderBookConfig& config)
+{
+    reserve(config);
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::reserve(const OrderBookConfig& config)
+{
+    orders_.reserve(config.max_orders);
+    free_indices_.reserve(config.max_orders);
+    id_to_index_.reserve(config.max_orders);
+    bids_.reserve(config.max_levels);
+    asks_.reserve(config.max_levels);
+}
+
+template <typename Traits>
+bool BasicOrderBook<Traits>::empty() const noexcept
+{
+    return bids_.empty() && asks_.empty();
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::clear() noexcept
+{
+    bids_.clear();
+    asks_.clear();
+    orders_.clear();
+    free_indices_.clear();
+    id_to_index_.clear();
+    next_id_ = 1;
+}
+
+template <typename Traits>
+template <Side S>
+auto& BasicOrderBook<Traits>::own_book() noexcept
+{
+    if constexpr (S == Side::Buy)
+        return bids_;
+    else
+        return asks_;
+}
+
+template <typename Traits>
+template <Side S>
+auto& BasicOrderBook<Traits>::opposite_book() noexcept
+{
+    if constexpr (S == Side::Buy)
+        return asks_;
+    else
+        return bids_;
+}
+
+template <typename Traits>
+template <Side S>
+bool BasicOrderBook<Traits>::crosses(Price level_price, Price limit) noexcept
+{
+    // Buy-лимит бьёт ask по ценам <= своей, sell-лимит — bid по ценам >= своей.
+    if constexpr (S == Side::Buy)
+        return level_price <= limit;
+    else
+        return level_price >= limit;
+}
+
+template <typename Traits>
+typename BasicOrderBook<Traits>::OrderIndex BasicOrderBook<Traits>::allocate_slot()
+{
+    if (!free_indices_.empty())
+    {
+        OrderIndex idx = free_indices_.back();
+        free_indices_.pop_back();
+        return idx;
+    }
+
+    OrderIndex idx = static_cast<OrderIndex>(orders_.size());
+    orders_.push_back(Order{});
+    return idx;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::link_back(Level& level, OrderIndex idx) noexcept
+{
+    Order& ord = orders_[idx];
+    ord.prev   = level.tail;
+    ord.next   = kNoIndex;
+
+    if (level.tail != kNoIndex)
+        orders_[level.tail].next = idx;
+    else
+        level.head = idx;
+    level.tail = idx;
+
+    level.total_qty += ord.qty;
+    ++level.order_count;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::unlink(Level& level, OrderIndex idx) noexcept
+{
+    Order& ord = orders_[idx];
+
+    if (ord.prev != kNoIndex)
+        orders_[ord.prev].next = ord.next;
+    else
+        level.head = ord.next;
+
+    if (ord.next != kNoIndex)
+        orders_[ord.next].prev = ord.prev;
+    else
+        level.tail = ord.prev;
+
+    ord.prev = kNoIndex;
+    ord.next = kNoIndex;
+
+    level.total_qty -= ord.qty;
+    --level.order_count;
+}
+
+template <typename Traits>
+template <Side S>
+void BasicOrderBook<Traits>::insert_resting(OrderIndex idx, OrderId id, Price price, Quantity qty)
+{
+    Order& ord = orders_[idx];
+    ord.id     = id;
+    ord.side   = S;
+    ord.price  = price;
+    ord.qty    = qty;
+    ord.active = true;
+
+    id_to_index_.insert(id, idx);
+    link_back(own_book<S>().get_or_create(price), idx);
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::remove_resting(OrderIndex idx)
+{
+    if (orders_[idx].side == Side::Buy)
+        remove_resting_from<Side::Buy>(idx);
+    else
+        remove_resting_from<Side::Sell>(idx);
+}
+
+template <typename Traits>
+template <Side S>
+void BasicOrderBook<Traits>::remove_resting_from(OrderIndex idx)
+{
+    Order& ord  = orders_[idx];
+    auto&  book = own_book<S>();
+
+    if (Level* level = book.find(ord.price))
+    {
+        unlink(*level, idx);
+        if (level->head == kNoIndex)
+            book.erase(ord.price);
+    }
+
+    ord.active = false;
+    ord.qty    = 0;
+    free_indices_.push_back(idx);
+}
+
+template <typename Traits>
+template <typename Book>
+LevelInfo BasicOrderBook<Traits>::best_level_info(const Book& book) const noexcept
+{
+    LevelInfo info;
+    if (book.empty())
+        return info;
+
+    const Level& level = book.best_level();
+
+    info.valid  = true;
+    info.price  = book.best_price();
+    info.qty    = level.total_qty;
+    info.orders = level.order_count;
+    return info;
+}
+
+template <typename Traits>
+LevelInfo BasicOrderBook<Traits>::best_bid() const noexcept
+{
+    return best_level_info(bids_);
+}
+
+template <typename Traits>
+LevelInfo BasicOrderBook<Traits>::best_ask() const noexcept
+{
+    return best_level_info(asks_);
+}
+
+template <typename Traits>
+TopOfBook BasicOrderBook<Traits>::top_of_book() const noexcept
+{
+    return TopOfBook{best_level_info(bids_), best_level_info(asks_)};
+}
+
+template <typename Traits>
+std::size_t BasicOrderBook<Traits>::depth(Side side, std::size_t n,
+                                                        std::span<LevelInfo> out) const noexcept
+{
+    n = std::min(n, out.size());
+    std::size_t k    = 0;
+    const auto  emit = [&](Price price, const Level& level) {
+        out[k++] = LevelInfo{true, price, level.total_qty, level.order_count};
+    };
+    return side == Side::Buy ? bids_.visit_best(n, emit) : asks_.visit_best(n, emit);
+}
+
+template <typename Traits>
+OrderId BasicOrderBook<Traits>::add_limit_order(Side side, Price price, Quantity qty)
+{
+    return add_limit_order(side, price, qty, NullFillSink{});
+}
+
+template <typename Traits>
+template <typename FillSink>
+OrderId BasicOrderBook<Traits>::add_limit_order(Side side, Price price, Quantity qty,
+                                                FillSink&& on_fill)
+{
+    return side == Side::Buy ? add_limit<Side::Buy>(price, qty, on_fill)
+                             : add_limit<Side::Sell>(price, qty, on_fill);
+}
+
+template <typename Traits>
+template <Side S, typename FillSink>
+OrderId BasicOrderBook<Traits>::add_limit(Price price, Quantity qty, FillSink& on_fill)
+{
+    if (qty <= 0)
+        return 0;
+
+    // Сначала агрессивная часть — матчим с противоположной стороной.
+    qty = match_incoming_limit<S>(price, qty, on_fill);
+    if (qty <= 0)
+    {
+        // Всё исполнилось как такер, в книгу ничего не кладём.
+        return 0;
+    }
+
+    OrderId id = next_id_++;
+    insert_resting<S>(allocate_slot(), id, price, qty);
+    return id;
+}
+
+template <typename Traits>
+OrderId BasicOrderBook<Traits>::add_limit_order_with_id(OrderId id, Side side, Price price, Quantity qty)
+{
+    return add_limit_order_with_id(id, side, price, qty, NullFillSink{});
+}
+
+template <typename Traits>
+template <typename FillSink>
+OrderId BasicOrderBook<Traits>::add_limit_order_with_id(OrderId id, Side side, Price price, Quantity qty,
+                                                        FillSink&& on_fill)
+{
+    return side == Side::Buy ? add_limit_with_id<Side::Buy>(id, price, qty, on_fill)
+                             : add_limit_with_id<Side::Sell>(id, price, qty, on_fill);
+}
+
+template <typename Traits>
+template <Side S, typename FillSink>
+OrderId BasicOrderBook<Traits>::add_limit_with_id(OrderId id, Price price, Quantity qty, FillSink& on_fill)
+{
+    if (qty <= 0)
+        return id;
+
+    // Агрессивная часть.
+    qty = match_incoming_limit<S>(price, qty, on_fill);
+    if (qty <= 0)
+    {
+        // Ордер полностью исполнился сразу.
+        return id;
+    }
+
+    // На всякий случай: если такой id уже есть, снимаем старый ордер с уровня
+    // и возвращаем его слот в пул — новый ордер его заменяет.
+    OrderIndex old_idx = id_to_index_.find(id);
+    if (old_idx != kNoIndex)
+    {
+        id_to_index_.erase(id);
+        if (orders_[old_idx].active)
+            remove_resting(old_idx);
+    }
+
+    insert_resting<S>(allocate_slot(), id, price, qty);
+    return id;
+}
+
+template <typename Traits>
+bool BasicOrderBook<Traits>::cancel(OrderId id)
+{
+    OrderIndex idx = id_to_index_.find(id);
+    if (idx == kNoIndex)
+        return false;
+
+    Order& ord = orders_[idx];
+
+    if (!ord.active || ord.qty <= 0)
+    {
+        id_to_index_.erase(id);
+        return false;
+    }
+
+    // O(1): вынимаем ордер из FIFO уровня, соседей не трогаем.
+    remove_resting(idx);
+
+    id_to_index_.erase(id);
+    return true;
+}
+
+template <typename Traits>
+MatchResult BasicOrderBook<Traits>::execute_market_order(Side side, Quantity qty)
+{
+    return execute_market_order(side, qty, NullFillSink{});
+}
+
+template <typename Traits>
+template <typename FillSink>
+MatchResult BasicOrderBook<Traits>::execute_market_order(Side side, Quantity qty,
+                                                                       FillSink&& on_fill)
+{
+    MatchResult res;
+    res.requested = qty;
+    res.filled    = 0;
+    res.remaining = qty;
+
+    if (qty <= 0)
+        return res;
+
+    // Buy-market бьёт по книге ask, sell-market — по книге bid.
+    const Quantity remaining = side == Side::Buy ? match_market<Side::Buy>(qty, on_fill)
+                                                 : match_market<Side::Sell>(qty, on_fill);
+
+    res.filled    = qty - remaining;
+    res.remaining = remaining;
+    return res;
+}
+
+template <typename Traits>
+ApplyStats BasicOrderBook<Traits>::apply(std::span<const Event> events)
+{
+    return apply(events, NullFillSink{});
+}
+
+template <typename Traits>
+template <typename FillSink>
+ApplyStats BasicOrderBook<Traits>::apply(std::span<const Event> events, FillSink&& on_fill)
+{
+    return apply(events, on_fill, NullEventHook{});
+}
+
+template <typename Traits>
+template <typename FillSink, typename EventHook>
+ApplyStats BasicOrderBook<Traits>::apply(std::span<const Event> events, FillSink&& on_fill,
+                                         EventHook&& after_event)
+{
+    ApplyStats st;
+    Quantity   limit_filled = 0;
+
+    // Taker fills of crossing limits are counted on the way to the caller's sink.
+    auto limit_sink = [&](const Trade& tr) {
+        limit_filled += tr.qty;
+        on_fill(tr);
+    };
+
+    const std::size_t n = events.size();
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        // Два этапа: сначала ячейка индекса, потом (когда она уже в кэше) слот/уровень.
+        if (i + kPrefetchIndexDistance < n)
+            prefetch_index(events[i + kPrefetchIndexDistance]);
+        if (i + kPrefetchSlotDistance < n)
+            prefetch_slot(events[i + kPrefetchSlotDistance]);
+
+        const Event& ev = events[i];
+        switch (ev.type)
+        {
+        case EventType::Add:
+            ++st.adds;
+            if (ev.id == 0)
+                add_limit_order(ev.side, ev.price, ev.qty, limit_sink);
+            else
+                add_limit_order_with_id(ev.id, ev.side, ev.price, ev.qty, limit_sink);
+            break;
+
+        case EventType::Market:
+        {
+            ++st.markets;
+            const MatchResult mr = execute_market_order(ev.side, ev.qty, on_fill);
+            if (mr.filled == 0)
+                ++st.markets_zero;
+            else if (mr.remaining == 0)
+                ++st.markets_full;
+            (ev.side == Side::Buy ? st.market_filled_buy : st.market_filled_sell) += mr.filled;
+            break;
+        }
+
+        case EventType::Cancel:
+            ++st.cancels;
+            st.cancels_hit += cancel(ev.id) ? 1 : 0;
+            break;
+
+        case EventType::End:
+            break;
+        }
+        after_event(i);
+    }
+
+    st.limit_filled = limit_filled;
+    st.top          = top_of_book();
+    return st;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::load_levels(std::span<const PriceLevel> bids,
+                                                       std::span<const PriceLevel> asks)
+{
+    const auto sorted = [](std::span<const PriceLevel> levels, auto better) {
+        for (std::size_t i = 1; i < levels.size(); ++i)
+        {
+            if (!better(levels[i - 1].price, levels[i].price))
+                return false;
+        }
+        return true;
+    };
+    if (!sorted(bids, std::greater<Price>{}) || !sorted(asks, std::less<Price>{}))
+        throw std::invalid_argument("load_levels: levels must be strictly sorted, best first");
+    // Сортировка проверена, так что кросс возможен только на лучших уровнях.
+    if (!bids.empty() && !asks.empty() && bids.front().price >= asks.front().price)
+        throw std::invalid_argument("load_levels: best bid crosses best ask");
+
+    clear();
+    reserve(OrderBookConfig{bids.size() + asks.size(), std::max(bids.size(), asks.size())});
+    append_levels<Side::Buy>(bids);
+    append_levels<Side::Sell>(asks);
+}
+
+template <typename Traits>
+template <Side S>
+void BasicOrderBook<Traits>::append_levels(std::span<const PriceLevel> levels)
+{
+    auto& book = own_book<S>();
+    for (const PriceLevel& lvl : levels)
+    {
+        if (lvl.qty <= 0)
+            continue;
+
+        const OrderIndex idx = static_cast<OrderIndex>(orders_.size());
+        const OrderId    id  = next_id_++;
+        orders_.push_back(Order{id, S, lvl.price, lvl.qty, true, kNoIndex, kNoIndex});
+        id_to_index_.insert(id, idx);
+        link_back(book.append_worst(lvl.price), idx);
+    }
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::save_snapshot(const std::string& path) const
+{
+    std::vector<SnapshotOrder> orders(orders_.size());
+    for (std::size_t i = 0; i < orders_.size(); ++i)
+    {
+        const Order&   ord = orders_[i];
+        SnapshotOrder& rec = orders[i];
+        rec.id     = ord.id;
+        rec.side   = static_cast<std::int32_t>(ord.side);
+        rec.price  = ord.price;
+        rec.qty    = ord.qty;
+        rec.active = ord.active ? 1 : 0;
+        rec.prev   = ord.prev;
+        rec.next   = ord.next;
+    }
+
+    std::vector<SnapshotIndexEntry> index;
+    index.reserve(id_to_index_.size());
+    id_to_index_.for_each([&index](OrderId id, OrderIndex slot) {
+        SnapshotIndexEntry rec;
+        rec.id   = id;
+        rec.slot = slot;
+        index.push_back(rec);
+    });
+
+    std::vector<SnapshotLevel> bids;
+    std::vector<SnapshotLevel> asks;
+    const auto collect = [](std::vector<SnapshotLevel>& out) {
+        return [&out](Price price, const Level& level) {
+            SnapshotLevel rec;
+            rec.price       = price;
+            rec.head        = level.head;
+            rec.tail        = level.tail;
+            rec.total_qty   = level.total_qty;
+            rec.order_count = level.order_count;
+            out.push_back(rec);
+        };
+    };
+    bids_.visit_best(std::numeric_limits<std::size_t>::max(), collect(bids));
+    asks_.visit_best(std::numeric_limits<std::size_t>::max(), collect(asks));
+
+    write_book_snapshot(path, BookSnapshotView{next_id_, orders, free_indices_, index, bids, asks});
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::load_snapshot(const std::string& path)
+{
+    const MappedBookSnapshot image(path);
+    load_snapshot(image);
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::load_snapshot(const MappedBookSnapshot& image)
+{
+    // The slot array is copied as is: SnapshotOrder must stay Order's layout.
+    static_assert(std::is_trivially_copyable_v<Order> && std::is_standard_layout_v<Order>);
+    static_assert(sizeof(Order) == sizeof(SnapshotOrder));
+    static_assert(sizeof(Side) == sizeof(SnapshotOrder::side));
+    static_assert(sizeof(bool) == sizeof(SnapshotOrder::active));
+    static_assert(offsetof(Order, id) == offsetof(SnapshotOrder, id));
+    static_assert(offsetof(Order, side) == offsetof(SnapshotOrder, side));
+    static_assert(offsetof(Order, price) == offsetof(SnapshotOrder, price));
+    static_assert(offsetof(Order, qty) == offsetof(SnapshotOrder, qty));
+    static_assert(offsetof(Order, active) == offsetof(SnapshotOrder, active));
+    static_assert(offsetof(Order, prev) == offsetof(SnapshotOrder, prev));
+    static_assert(offsetof(Order, next) == offsetof(SnapshotOrder, next));
+
+    const BookSnapshotView& view = image.view();
+    const std::size_t       n    = view.orders.size();
+
+    // Validate everything the book would dereference before touching it:
+    // every level FIFO is a well-formed chain matching its record, every
+    // active slot sits on exactly one level, free and indexed slots are
+    // listed once (an index entry names an active slot with that id).
+    const auto slot_ok = [n](std::uint32_t idx) { return idx < n; };
+    const auto link_ok = [n](std::uint32_t idx) { return idx < n || idx == kNoIndex; };
+
+    const char* error = nullptr;
+    if (n >= kNoIndex)
+        error = "too many order slots";
+    for (std::size_t i = 0; !error && i < n; ++i)
+    {
+        const SnapshotOrder& rec = view.orders[i];
+        if (rec.active > 1 || (rec.side != static_cast<std::int32_t>(Side::Buy) &&
+                               rec.side != static_cast<std::int32_t>(Side::Sell)))
+            error = "bad order record";
+        else if (!link_ok(rec.prev) || !link_ok(rec.next))
+            error = "bad order link";
+    }
+
+    // Per slot: on a level FIFO, in the free list, in the index.
+    enum : std::uint8_t { kOnLevel = 1, kFree = 2, kIndexed = 4 };
+    std::vector<std::uint8_t> seen(error ? 0 : n, 0);
+
+    for (std::size_t i = 0; !error && i < view.free_slots.size(); ++i)
+    {
+        const std::uint32_t slot = view.free_slots[i];
+        if (!slot_ok(slot) || view.orders[slot].active || (seen[slot] & kFree))
+            error = "bad free slot";
+        else
+            seen[slot] |= kFree;
+    }
+    for (std::size_t i = 0; !error && i < view.index.size(); ++i)
+    {
+        const SnapshotIndexEntry& rec = view.index[i];
+        if (!slot_ok(rec.slot) || !view.orders[rec.slot].active || view.orders[rec.slot].id != rec.id ||
+            (seen[rec.slot] & kIndexed))
+            error = "bad index entry";
+        else
+            seen[rec.slot] |= kIndexed;
+    }
+
+    const auto levels_ok = [&](std::span<const SnapshotLevel> levels, Side side, auto better) {
+        for (std::size_t i = 0; i < levels.size(); ++i)
+        {
+            const SnapshotLevel& rec = levels[i];
+            if (rec.order_count == 0 || !slot_ok(rec.head) || !slot_ok(rec.tail) ||
+                view.orders[rec.head].prev != kNoIndex || view.orders[rec.tail].next != kNoIndex ||
+                (i > 0 && !better(levels[i - 1].price, rec.price)))
+                return false;
+
+            // Walk the FIFO: order_count steps at most, so a cycle cannot
+            // loop, and a slot on two chains is caught by its mark.
+            std::uint32_t prev = kNoIndex;
+            std::uint32_t idx  = rec.head;
+            Quantity      qty  = 0;
+            for (std::uint32_t k = 0; k < rec.order_count; ++k)
+            {
+                if (idx == kNoIndex)
+                    return false;
+                const SnapshotOrder& ord = view.orders[idx];
+                if (!ord.active || (seen[idx] & kOnLevel) || ord.prev != prev ||
+                    ord.side != static_cast<std::int32_t>(side) || ord.price != rec.price || ord.qty <= 0)
+                    return false;
+                seen[idx] |= kOnLevel;
+                qty += ord.qty;
+                prev = idx;
+                idx  = ord.next;
+            }
+            if (prev != rec.tail || idx != kNoIndex || qty != rec.total_qty)
+                return false;
+        }
+        return true;
+    };
+    if (!error && (!levels_ok(view.bids, Side::Buy, std::greater<Price>{}) ||
+                   !levels_ok(view.asks, Side::Sell, std::less<Price>{})))
+        error = "bad level record";
+    for (std::size_t i = 0; !error && i < n; ++i)
+    {
+        if (view.orders[i].active && !(seen[i] & kOnLevel))
+            error = "active order on no level";
+    }
+
+    if (error)
+        throw std::runtime_error(std::string("load_snapshot: ") + error);
+
+    // Build into temporaries (the level containers and the id index may
+    // still throw, e.g. a ladder span or an id out of range), then swap:
+    // the book is unchanged unless everything succeeded.
+    BidBook                 bids;
+    AskBook                 asks;
+    std::vector<Order>      orders(n);
+    std::vector<OrderIndex> free_indices;
+    IdIndex                 id_to_index;
+
+    bids.reserve(view.bids.size());
+    asks.reserve(view.asks.size());
+    if (n != 0)
+        std::memcpy(static_cast<void*>(orders.data()), view.orders.data(), n * sizeof(Order));
+    free_indices.reserve(n);
+    free_indices.assign(view.free_slots.begin(), view.free_slots.end());
+
+    for (const SnapshotLevel& rec : view.bids)
+        bids.get_or_create(rec.price) = Level{rec.head, rec.tail, rec.total_qty, rec.order_count};
+    for (const SnapshotLevel& rec : view.asks)
+        asks.get_or_create(rec.price) = Level{rec.head, rec.tail, rec.total_qty, rec.order_count};
+
+    id_to_index.reserve(view.index.size());
+    for (const SnapshotIndexEntry& rec : view.index)
+        id_to_index.insert(rec.id, rec.slot);
+
+    std::swap(bids_, bids);
+    std::swap(asks_, asks);
+    orders_.swap(orders);
+    free_indices_.swap(free_indices);
+    std::swap(id_to_index_, id_to_index);
+    next_id_ = view.next_id;
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::prefetch_index(const Event& ev) const noexcept
+{
+    if (ev.type == EventType::Cancel || (ev.type == EventType::Add && ev.id != 0))
+        id_to_index_.prefetch(ev.id);
+}
+
+template <typename Traits>
+void BasicOrderBook<Traits>::prefetch_slot(const Event& ev) const noexcept
+{
+    if (ev.type == EventType::Cancel)
+    {
+        const OrderIndex idx = id_to_index_.find(ev.id);
+        if (idx != kNoIndex)
+            utils::prefetch(&orders_[idx]);
+    }
+    else if (ev.type == EventType::Add)
+    {
+        if (ev.side == Side::Buy)
+            bids_.prefetch(ev.price);
+        else
+            asks_.prefetch(ev.price);
+    }
+}
+
+template <typename Traits>
+template <Side S, typename PricePredicate, typename FillSink>
+Quantity BasicOrderBook<Traits>::match_on_book(Quantity qty, PricePredicate&& should_cross, FillSink& on_fill)
+{
+    if (qty <= 0)
+        return 0;
+
+    auto& book = opposite_book<S>();
+    while (qty > 0 && !book.empty())
+    {
+        // Для обеих книг best — лучший уровень (зависит от компаратора).
+        Price level_price = book.best_price();
+
+        if (!should_cross(level_price))
+            break;
+
+        // Исполняем уровень с головы FIFO (price-time priority).
+        Level& level = book.best_level();
+        while (qty > 0 && level.head != kNoIndex)
+        {
+            OrderIndex idx = level.head;
+            Order&     ord = orders_[idx];
+
+            Quantity traded = std::min(qty, ord.qty);
+            qty             -= traded;
+            ord.qty         -= traded;
+            level.total_qty -= traded;
+
+            on_fill(Trade{ord.id, S, level_price, traded});
+
+            if (ord.qty == 0)
+            {
+                unlink(level, idx);
+                ord.active = false;
+                free_indices_.push_back(idx);
+                id_to_index_.erase(ord.id);
+            }
+        }
+
+        if (level.head == kNoIndex)
+        {
+            book.erase_best();
+        }
+    }
+
+    return qty;
+}
+
+template <typename Traits>
+template <Side S, typename FillSink>
+Quantity BasicOrderBook<Traits>::match_incoming_limit(Price price, Quantity qty, FillSink& on_fill)
+{
+    return match_on_book<S>(
+        qty,
+        [price](Price top_price) { return crosses<S>(top_price, price); },
+        on_fill
+    );
+}
+
+template <typename Traits>
+template <Side S, typename FillSink>
+Quantity BasicOrderBook<Traits>::match_market(Quantity qty, FillSink& on_fill)
+{
+    return match_on_book<S>(
+        qty,
+        [](Price) { return true; }, // всегда кроссим
+        on_fill
+    );
+}
+
+} // namespace trading
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <string_view>
+
+#include "trading/id_index.hpp"
+#include "trading/price_levels.hpp"
+#include "trading/types.hpp"
+#include "utils/decimal.hpp"
+
+namespace trading {
+
+/**
+ * Fixed-point scale of an instrument, known at compile time:
+ * 1 price tick = 10^-PriceDecimals, 1 qty tick = 10^-QtyDecimals
+ * (TickScale<1, 6>: price 0.1, qty 1e-6).
+ *
+ * Conversions for the edges of the system (exchange strings, printing);
+ * the book itself only sees ticks.
+ */
+template <unsigned PriceDecimals, unsigned QtyDecimals>
+struct TickScale
+{
+    static_assert(PriceDecimals <= utils::kMaxDecimals && QtyDecimals <= utils::kMaxDecimals,
+                  "TickScale: at most 18 decimals");
+
+    static constexpr unsigned     price_decimals = PriceDecimals;
+    static constexpr unsigned     qty_decimals   = QtyDecimals;
+    static constexpr std::int64_t price_mult     = utils::kPow10[PriceDecimals];
+    static constexpr std::int64_t qty_mult       = utils::kPow10[QtyDecimals];
+
+    /// Nearest tick.
+    static Price to_price_ticks(double price) noexcept
+    {
+        return static_cast<Price>(std::llround(price * static_cast<double>(price_mult)));
+    }
+    static Quantity to_qty_ticks(double qty) noexcept
+    {
+        return static_cast<Quantity>(std::llround(qty * static_cast<double>(qty_mult)));
+    }
+
+    static constexpr double from_price_ticks(Price p) noexcept
+    {
+        return static_cast<double>(p) / static_cast<double>(price_mult);
+    }
+    static constexpr double from_qty_ticks(Quantity q) noexcept
+    {
+        return static_cast<double>(q) / static_cast<double>(qty_mult);
+    }
+
+    /// Decimal strings straight to ticks, without a double (parse_fixed_point).
+    static bool parse_price(std::string_view s, Price& out) noexcept
+    {
+        return utils::parse_fixed_point(s, PriceDecimals, out);
+    }
+    static bool parse_qty(std::string_view s, Quantity& out) noexcept
+    {
+        return utils::parse_fixed_point(s, QtyDecimals, out);
+    }
+};
+
+/**
+ * Compile-time configuration of BasicOrderBook (order_book.hpp).
+ *
+ * A traits type provides:
+ *  - level_policy : level container, MapLevels or LadderLevels (price_levels.hpp);
+ *  - id_index     : OrderId index, FlatIdIndex or DirectIdIndex (id_index.hpp);
+ *  - tick_scale   : TickScale of the instrument, exposed as Book::tick_scale;
+ *  - max_orders, max_levels : the capacity plan of the default constructor
+ *                   (peak resting orders, peak price levels per side). An
+ *                   instrument-tuned book reserves its depth bound up front;
+ *                   exceeding it still only grows the book (OrderBookConfig).
+ *
+ * Any struct with these members works; OrderBookTraits builds one.
+ */
+template <typename LevelPolicy, typename IdIndex = FlatIdIndex, typename Scale = TickScale<2, 0>,
+          std::size_t MaxOrders = 1024, std::size_t MaxLevels = 64>
+struct OrderBookTraits
+{
+    using level_policy = LevelPolicy;
+    using id_index     = IdIndex;
+    using tick_scale   = Scale;
+
+    static constexpr std::size_t max_orders = MaxOrders;
+    static constexpr std::size_t max_levels = MaxLevels;
+};
+
+} // namespace trading
@@ -0,0 +1,431 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "trading/types.hpp"
+#include "utils/prefetch.hpp"
+
+namespace trading {
+
+/**
+ * Price level containers for one side of BasicOrderBook.
+ *
+ * A container stores Level objects keyed by price and ordered by Compare
+ * (std::greater<Price> for bids, std::less<Price> for asks), so the "best"
+ * level is always the first one in Compare order.
+ *
+ * Interface shared by all containers:
+ *  - bool   empty() const noexcept;
+ *  - Price  best_price() const noexcept;   // precondition: !empty()
+ *  - Level& best_level() noexcept;         // precondition: !empty(); const overload too
+ *  - Level& get_or_create(Price price);    // may invalidate Level references
+ *  - Level& append_worst(Price price);     // new level worse than all live ones
+ *                                          // (bulk build); may invalidate too
+ *  - Level* find(Price price) noexcept;    // nullptr if there is no such level; const overload too
+ *  - void   erase(Price price) noexcept;   // the level must exist
+ *  - void   erase_best() noexcept;         // precondition: !empty()
+ *  - void   clear() noexcept;
+ *  - void   reserve(std::size_t levels);   // no allocation while <= levels are live
+ *  - void   prefetch(Price price) const noexcept; // cache hint, may be a no-op
+ *  - std::size_t visit_best(std::size_t n, Fn&& fn) const;
+ *        // fn(Price, const Level&) for the first min(n, size) levels in
+ *        // Compare order, best first; returns the number visited
+ */
+
+/**
+ * Node-based container: std::map<Price, Level>. Unbounded price range,
+ * O(log N) lookup.
+ *
+ * Erased nodes are kept in a spare pool (std::map node handles) and reused
+ * by get_or_create, so once reserve(n) has preallocated n nodes, creating and
+ * erasing levels does not touch the heap while at most n levels are live.
+ * Without reserve() every new level allocates a node, as plain std::map.
+ */
+template <typename Level, typename Compare>
+class MapPriceLevels
+{
+public:
+    MapPriceLevels() = default;
+
+    /// Copies the levels only: node handles are move-only, so the copy starts
+    /// with an empty spare pool (of the same capacity, refilled by erasures).
+    MapPriceLevels(const MapPriceLevels& other)
+        : levels_(other.levels_)
+    {
+        spare_.reserve(other.spare_.capacity());
+    }
+
+    /// Keeps this side's spare pool.
+    MapPriceLevels& operator=(const MapPriceLevels& other)
+    {
+        if (this != &other)
+            levels_ = other.levels_;
+        return *this;
+    }
+
+    MapPriceLevels(MapPriceLevels&&) noexcept            = default;
+    MapPriceLevels& operator=(MapPriceLevels&&) noexcept = default;
+
+    bool empty() const noexcept { return levels_.empty(); }
+
+    Price  best_price() const noexcept { return levels_.begin()->first; }
+    Level& best_level() noexcept { return levels_.begin()->second; }
+    const Level& best_level() const noexcept { return levels_.begin()->second; }
+
+    Level& get_or_create(Price price)
+    {
+        auto it = levels_.lower_bound(price);
+        if (it != levels_.end() && !Compare{}(price, it->first))
+            return it->second;
+
+        if (spare_.empty())
+            return levels_.emplace_hint(it, price, Level{})->second;
+
+        Node node = std::move(spare_.back());
+        spare_.pop_back();
+        node.key()    = price;
+        node.mapped() = Level{};
+        return levels_.insert(it, std::move(node))->second;
+    }
+
+    /// Amortized O(1): the new node goes right before end(), no tree search.
+    Level& append_worst(Price price)
+    {
+        if (spare_.empty())
+            return levels_.emplace_hint(levels_.end(), price, Level{})->second;
+
+        Node node = std::move(spare_.back());
+        spare_.pop_back();
+        node.key()    = price;
+        node.mapped() = Level{};
+        return levels_.insert(levels_.end(), std::move(node))->second;
+    }
+
+    Level* find(Price price) noexcept
+    {
+        auto it = levels_.find(price);
+        return it != levels_.end() ? &it->second : nullptr;
+    }
+
+    const Level* find(Price price) const noexcept
+    {
+        auto it = levels_.find(price);
+        return it != levels_.end() ? &it->second : nullptr;
+    }
+
+    /// Tree nodes are not addressable without a lookup: nothing to hint.
+    void prefetch(Price) const noexcept {}
+
+    template <typename Fn>
+    std::size_t visit_best(std::size_t n, Fn&& fn) const
+    {
+        std::size_t k = 0;
+        for (auto it = levels_.begin(); k < n && it != levels_.end(); ++it, ++k)
+            fn(it->first, it->second);
+        return k;
+    }
+
+    void erase(Price price) noexcept { recycle(levels_.find(price)); }
+    void erase_best() noexcept { recycle(levels_.begin()); }
+
+    void clear() noexcept
+    {
+        while (!levels_.empty())
+            recycle(levels_.begin());
+    }
+
+    void reserve(std::size_t levels)
+    {
+        if (levels <= levels_.size() + spare_.size())
+            return;
+        spare_.reserve(levels);
+
+        // Node handles can only be obtained by extracting from a map.
+        std::map<Price, Level, Compare> fresh;
+        for (std::size_t i = levels_.size() + spare_.size(); i < levels; ++i)
+            fresh.emplace_hint(fresh.end(), static_cast<Price>(i), Level{});
+        while (!fresh.empty())
+            spare_.push_back(fresh.extract(fresh.begin()));
+    }
+
+private:
+    using Map  = std::map<Price, Level, Compare>;
+    using Node = typename Map::node_type;
+
+    /// Erase *it, keeping the node for reuse while the pool has room
+    /// (push_back then never reallocates, which keeps erase noexcept).
+    void recycle(typename Map::iterator it) noexcept
+    {
+        Node node = levels_.extract(it);
+        if (spare_.size() < spare_.capacity())
+            spare_.push_back(std::move(node));
+    }
+
+    Map               levels_;
+    std::vector<Node> spare_;  // preallocated / recycled level nodes
+};
+
+/**
+ * Tick-indexed ladder: a contiguous array of levels covering
+ * [base_, base_ + size) ticks plus an occupancy bitmap.
+ *
+ *  - get_or_create / find / erase are O(1) array accesses.
+ *  - The best level is cached; when it is erased the cursor moves to the next
+ *    occupied level using the bitmap (64 ticks per word).
+ *  - A price outside the window re-centers the ladder around all occupied
+ *    levels (growing it to a power of two if needed). This is the only place
+ *    that allocates after the first insert.
+ *
+ * Intended for instruments that trade in a bounded tick band; a span wider
+ * than kMaxSpanTicks throws std::length_error.
+ */
+template <typename Level, typename Compare>
+class LadderPriceLevels
+{
+public:
+    static constexpr std::size_t kDefaultSpanTicks = 4096;
+    static constexpr std::size_t kMaxSpanTicks     = std::size_t{1} << 26;
+
+    explicit LadderPriceLevels(std::size_t span_ticks = kDefaultSpanTicks)
+        : levels_(std::bit_ceil(span_ticks < 64 ? std::size_t{64} : span_ticks)),
+          bits_(levels_.size() / 64, 0)
+    {}
+
+    bool empty() const noexcept { return count_ == 0; }
+
+    Price  best_price() const noexcept { return best_; }
+    Level& best_level() noexcept { return levels_[slot(best_)]; }
+    const Level& best_level() const noexcept { return levels_[slot(best_)]; }
+
+    Level& get_or_create(Price price)
+    {
+        if (!has_base_)
+        {
+            base_     = price - static_cast<Price>(levels_.size() / 2);
+            has_base_ = true;
+        }
+        else if (!in_range(price))
+        {
+            recenter(price);
+        }
+
+        const std::size_t i = slot(price);
+        if (!test(i))
+        {
+            set(i);
+            if (count_ == 0 || better(price, best_))
+                best_ = price;
+            ++count_;
+        }
+        return levels_[i];
+    }
+
+    /// Already O(1); the best-level cursor stays where it is.
+    Level& append_worst(Price price) { return get_or_create(price); }
+
+    Level* find(Price price) noexcept
+    {
+        if (!has_base_ || !in_range(price))
+            return nullptr;
+        const std::size_t i = slot(price);
+        return test(i) ? &levels_[i] : nullptr;
+    }
+
+    const Level* find(Price price) const noexcept
+    {
+        if (!has_base_ || !in_range(price))
+            return nullptr;
+        const std::size_t i = slot(price);
+        return test(i) ? &levels_[i] : nullptr;
+    }
+
+    void prefetch(Price price) const noexcept
+    {
+        if (has_base_ && in_range(price))
+            utils::prefetch(&levels_[slot(price)]);
+    }
+
+    /// Walks the occupancy bitmap from the best-level cursor.
+    template <typename Fn>
+    std::size_t visit_best(std::size_t n, Fn&& fn) const
+    {
+        if (n > count_)
+            n = count_;
+        if (n == 0)
+            return 0;
+
+        std::size_t i = slot(best_);
+        for (std::size_t k = 1;; ++k)
+        {
+            fn(base_ + static_cast<Price>(i), levels_[i]);
+            if (k == n)
+                return n;
+            i = next_worse(i);
+        }
+    }
+
+    void erase(Price price) noexcept
+    {
+        const std::size_t i = slot(price);
+        reset(i);
+        levels_[i] = Level{};
+        --count_;
+
+        if (count_ > 0 && price == best_)
+            best_ = base_ + static_cast<Price>(next_worse(i));
+    }
+
+    void erase_best() noexcept { erase(best_); }
+
+    /// Make the window at least `levels` ticks wide (levels are stored per
+    /// tick, so n live levels need at least n ticks). Prices outside the
+    /// window still re-center and may allocate.
+    void reserve(std::size_t levels)
+    {
+        const std::size_t want = std::bit_ceil(levels < 64 ? std::size_t{64} : levels);
+        if (want <= levels_.size())
+            return;
+        if (want > kMaxSpanTicks)
+            throw std::length_error("LadderPriceLevels: reserve exceeds kMaxSpanTicks");
+
+        // Grow symmetrically so every occupied level stays inside the window.
+        relayout(want, base_ - static_cast<Price>((want - levels_.size()) / 2));
+    }
+
+    void clear() noexcept
+    {
+        for (std::size_t w = 0; w < bits_.size(); ++w)
+        {
+            for (std::uint64_t word = bits_[w]; word != 0; word &= word - 1)
+                levels_[w * 64 + static_cast<std::size_t>(std::countr_zero(word))] = Level{};
+            bits_[w] = 0;
+        }
+        count_    = 0;
+        has_base_ = false;
+    }
+
+private:
+    static constexpr bool kBestIsHigh = std::is_same_v<Compare, std::greater<Price>>;
+
+    static bool better(Price a, Price b) noexcept { return Compare{}(a, b); }
+
+    bool in_range(Price price) const noexcept
+    {
+        return price >= base_ && price - base_ < static_cast<Price>(levels_.size());
+    }
+
+    std::size_t slot(Price price) const noexcept
+    {
+        return static_cast<std::size_t>(price - base_);
+    }
+
+    bool test(std::size_t i) const noexcept { return (bits_[i / 64] >> (i % 64)) & 1u; }
+    void set(std::size_t i) noexcept { bits_[i / 64] |= std::uint64_t{1} << (i % 64); }
+    void reset(std::size_t i) noexcept { bits_[i / 64] &= ~(std::uint64_t{1} << (i % 64)); }
+
+    /// Next occupied slot behind i in priority order (lower slot for bids,
+    /// higher slot for asks). Precondition: such a slot exists.
+    std::size_t next_worse(std::size_t i) const noexcept
+    {
+        if constexpr (kBestIsHigh)
+        {
+            std::size_t   w    = i / 64;
+            std::uint64_t word = bits_[w] & ((std::uint64_t{1} << (i % 64)) - 1);
+            while (word == 0)
+                word = bits_[--w];
+            return w * 64 + 63 - static_cast<std::size_t>(std::countl_zero(word));
+        }
+        else
+        {
+            std::size_t   w    = i / 64;
+            std::uint64_t word = (i % 64 == 63) ? 0 : bits_[w] & (~std::uint64_t{0} << (i % 64 + 1));
+            while (word == 0)
+                word = bits_[++w];
+            return w * 64 + static_cast<std::size_t>(std::countr_zero(word));
+        }
+    }
+
+    /// Move the window so that price and all occupied levels fit into it.
+    void recenter(Price price)
+    {
+        if (count_ == 0)
+        {
+            base_ = price - static_cast<Price>(levels_.size() / 2);
+            return;
+        }
+
+        Price lo = price;
+        Price hi = price;
+        for (std::size_t w = 0; w < bits_.size(); ++w)
+        {
+            if (bits_[w] == 0)
+                continue;
+            const std::uint64_t word  = bits_[w];
+            const Price         first = base_ + static_cast<Price>(w * 64 + std::countr_zero(word));
+            const Price         last  = base_ + static_cast<Price>(w * 64 + 63 - std::countl_zero(word));
+            if (first < lo) lo = first;
+            if (last  > hi) hi = last;
+        }
+
+        const auto span = static_cast<std::size_t>(hi - lo) + 1;
+        if (span > kMaxSpanTicks)
+            throw std::length_error("LadderPriceLevels: price span exceeds kMaxSpanTicks");
+
+        std::size_t new_size = levels_.size();
+        while (new_size < 2 * span && new_size < kMaxSpanTicks)
+            new_size *= 2;
+
+        relayout(new_size, lo - static_cast<Price>((new_size - span) / 2));
+    }
+
+    /// Move all occupied levels into a window of new_size ticks at new_base.
+    void relayout(std::size_t new_size, Price new_base)
+    {
+        std::vector<Level>         new_levels(new_size);
+        std::vector<std::uint64_t> new_bits(new_size / 64, 0);
+
+        for (std::size_t w = 0; w < bits_.size(); ++w)
+        {
+            for (std::uint64_t word = bits_[w]; word != 0; word &= word - 1)
+            {
+                const std::size_t old_i = w * 64 + static_cast<std::size_t>(std::countr_zero(word));
+                const auto        new_i = static_cast<std::size_t>(base_ + static_cast<Price>(old_i) - new_base);
+                new_levels[new_i] = std::move(levels_[old_i]);
+                new_bits[new_i / 64] |= std::uint64_t{1} << (new_i % 64);
+            }
+        }
+
+        levels_.swap(new_levels);
+        bits_.swap(new_bits);
+        base_ = new_base;
+    }
+
+    std::vector<Level>         levels_;
+    std::vector<std::uint64_t> bits_;   // occupancy, bit i <-> levels_[i]
+    Price                      base_{0};
+    Price                      best_{0};
+    std::size_t                count_{0};
+    bool                       has_base_{false};
+};
+
+/// Level container policies for BasicOrderBook.
+struct MapLevels
+{
+    template <typename Level, typename Compare>
+    using container = MapPriceLevels<Level, Compare>;
+};
+
+struct LadderLevels
+{
+    template <typename Level, typename Compare>
+    using container = LadderPriceLevels<Level, Compare>;
+};
+
+} // namespace trading
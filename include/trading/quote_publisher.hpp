@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "trading/types.hpp"
+#include "utils/seqlock.hpp"
+
+namespace trading {
+
+/// Top of book plus the top Depth levels per side, as published.
+template <std::size_t Depth>
+struct PublishedQuote
+{
+    std::uint64_t                update{0}; // publish count, 1 = first publish
+    std::int64_t                 ts_ns{0};  // caller's timestamp of the state
+    TopOfBook                    top;
+    std::uint32_t                bid_levels{0}; // valid entries in bids / asks
+    std::uint32_t                ask_levels{0};
+    std::array<LevelInfo, Depth> bids{};
+    std::array<LevelInfo, Depth> asks{};
+};
+
+/**
+ * Cross-thread top-of-book publisher.
+ *
+ * The book stays single-threaded: its owning (matching) thread calls
+ * publish(book) after an event or a batch, which copies the top of book
+ * and, with Depth > 0, the top Depth levels per side (book.depth()) into a
+ * seqlock slot (utils::Seqlock). Strategy / risk / publisher threads call
+ * read() and get a consistent quote without taking a lock; the writer never
+ * waits for them.
+ *
+ *   QuotePublisher<5> quotes;
+ *   // matching thread
+ *   book.apply(batch);
+ *   quotes.publish(book, now_ns);
+ *   // any other thread
+ *   const auto q = quotes.read();      // q.top.bid, q.bids[0, q.bid_levels)
+ *   if (quotes.update() != seen) ...   // cheap "anything new?" check
+ *
+ * Publishing costs one depth read and sizeof(PublishedQuote) / 8 relaxed
+ * stores; keep Depth small (the whole quote is copied on every read too).
+ * Works with BasicOrderBook and BasicLevelBook.
+ */
+template <std::size_t Depth = 0>
+class QuotePublisher
+{
+public:
+    using Quote = PublishedQuote<Depth>;
+
+    /// Matching thread only.
+    template <typename Book>
+    void publish(const Book& book, std::int64_t ts_ns = 0) noexcept
+    {
+        Quote q;
+        q.update = ++updates_;
+        q.ts_ns  = ts_ns;
+        if constexpr (Depth == 0)
+        {
+            q.top = book.top_of_book();
+        }
+        else
+        {
+            q.bid_levels = static_cast<std::uint32_t>(book.depth(Side::Buy, Depth, std::span<LevelInfo>(q.bids)));
+            q.ask_levels = static_cast<std::uint32_t>(book.depth(Side::Sell, Depth, std::span<LevelInfo>(q.asks)));
+            q.top.bid    = q.bid_levels ? q.bids[0] : LevelInfo{};
+            q.top.ask    = q.ask_levels ? q.asks[0] : LevelInfo{};
+        }
+        slot_.store(q);
+    }
+
+    /// Top of book only, e.g. ApplyStats::top of the batch just applied
+    /// (no book read at all).
+    void publish(const TopOfBook& top, std::int64_t ts_ns = 0) noexcept
+        requires(Depth == 0)
+    {
+        Quote q;
+        q.update = ++updates_;
+        q.ts_ns  = ts_ns;
+        q.top    = top;
+        slot_.store(q);
+    }
+
+    /// Any thread: latest consistent quote (update 0 = nothing published).
+    Quote read() const noexcept { return slot_.load(); }
+
+    /// Any thread: one attempt, false if a publish raced with it.
+    bool try_read(Quote& out) const noexcept { return slot_.try_load(out); }
+
+    /// Any thread: publishes so far, without copying the quote.
+    std::uint64_t update() const noexcept { return slot_.version(); }
+
+private:
+    utils::Seqlock<Quote> slot_;
+    std::uint64_t         updates_{0}; // writer's copy of the publish count
+};
+
+} // namespace trading
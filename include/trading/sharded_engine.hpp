@@ -0,0 +1,282 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "trading/event.hpp"
+#include "trading/order_book.hpp"
+#include "trading/types.hpp"
+#include "utils/cpu_affinity.hpp"
+#include "utils/latency_histogram.hpp"
+#include "utils/spsc_queue_v2.hpp"
+#include "utils/wait_strategy.hpp"
+
+namespace trading {
+
+/**
+ * Layout of a BasicShardedEngine.
+ *
+ * Instrument i lives on shard i % shards; each shard owns its books, one
+ * SPSC queue and one thread (optionally pinned to shard_cpus[shard]).
+ */
+struct ShardedEngineConfig
+{
+    std::size_t      shards{1};
+    std::size_t      instruments{1};       // valid ids: [0, instruments)
+    std::size_t      queue_capacity{4096}; // per shard, rounded up to 2^k
+    std::size_t      batch_size{64};       // max events per pop_bulk / apply round
+    OrderBookConfig  book{};               // capacity plan of every book
+    utils::WaitMode  wait{utils::WaitMode::Yield}; // idle shard / full queue
+    std::vector<int> shard_cpus{};         // cpu of shard i; missing or -1 = unpinned
+};
+
+/// Per-shard counters, written by the shard thread; read them after stop().
+struct ShardStats
+{
+    std::size_t             instruments{0}; // books owned by the shard
+    bool                    pinned{false};  // shard thread runs on its configured cpu
+    std::uint64_t           batches{0};     // pop_bulk rounds that returned events
+    std::uint64_t           busy_ns{0};     // time spent inside OrderBook::apply
+    ApplyStats              apply{};        // summed over all books (top: last book applied)
+    utils::LatencyHistogram latency{};      // submit() -> batch applied, per event
+
+    ShardStats& operator+=(const ShardStats& other) noexcept
+    {
+        instruments += other.instruments;
+        pinned       = pinned && other.pinned;
+        batches     += other.batches;
+        busy_ns     += other.busy_ns;
+        apply       += other.apply;
+        latency.merge(other.latency);
+        return *this;
+    }
+};
+
+/**
+ * Multi-instrument matching engine: one Book per instrument, books sharded
+ * over worker threads (one core each when pinned).
+ *
+ * Threads
+ *  - submit() is called from ONE router thread (the feed handler); it
+ *    routes the event by Event::instrument to the owning shard's
+ *    SpscQueueV2. Several feeds should share a router or get an engine
+ *    each: the shard queues are single-producer.
+ *  - Each shard thread drains up to batch_size events with pop_bulk and
+ *    applies runs of consecutive events of one instrument with
+ *    Book::apply(span).
+ *  - Books and ShardStats belong to the shard thread while the engine runs;
+ *    book() / shard_stats() / total_stats() are valid after stop().
+ *
+ * Cancel ids are per book; an Add with id 0 gets an id generated by its
+ * book, as in OrderBook::apply.
+ */
+template <typename Book>
+class BasicShardedEngine
+{
+public:
+    explicit BasicShardedEngine(const ShardedEngineConfig& config)
+        : config_(config)
+    {
+        if (config_.shards == 0 || config_.instruments == 0)
+            throw std::invalid_argument("ShardedEngine: shards and instruments must be > 0");
+        if (config_.instruments > std::size_t{1} << (8 * sizeof(InstrumentId)))
+            throw std::invalid_argument("ShardedEngine: too many instruments for InstrumentId");
+        if (config_.batch_size == 0)
+            config_.batch_size = 1;
+
+        shards_.reserve(config_.shards);
+        for (std::size_t i = 0; i < config_.shards; ++i)
+            shards_.push_back(std::make_unique<Shard>(config_.queue_capacity));
+
+        for (std::size_t id = 0; id < config_.instruments; ++id)
+        {
+            Shard& shard = *shards_[id % config_.shards];
+            shard.books.push_back(std::make_unique<Book>(config_.book));
+            ++shard.stats.instruments;
+        }
+    }
+
+    ~BasicShardedEngine() { stop(); }
+
+    BasicShardedEngine(const BasicShardedEngine&)            = delete;
+    BasicShardedEngine& operator=(const BasicShardedEngine&) = delete;
+
+    /// Launch the shard threads. No-op if already running.
+    void start()
+    {
+        if (running_)
+            return;
+        running_ = true;
+        for (std::size_t i = 0; i < shards_.size(); ++i)
+        {
+            const int cpu = i < config_.shard_cpus.size() ? config_.shard_cpus[i] : -1;
+            shards_[i]->thread = std::thread([this, i, cpu] { run_shard(*shards_[i], cpu); });
+        }
+    }
+
+    /// Route one event to its shard, waiting (per config.wait) while the
+    /// shard queue is full. Returns false for an unknown instrument or if
+    /// the engine is not running. Router thread only.
+    bool submit(const Event& ev)
+    {
+        if (!running_ || ev.instrument >= config_.instruments || ev.type == EventType::End)
+            return false;
+        push(*shards_[shard_of(ev.instrument)], Item{ev, now_ns()});
+        return true;
+    }
+
+    /// Drain every queue, then join the shard threads. No-op if not running.
+    void stop()
+    {
+        if (!running_)
+            return;
+        Event end;
+        end.type = EventType::End;
+        for (auto& shard : shards_)
+            push(*shard, Item{end, now_ns()});
+        for (auto& shard : shards_)
+            shard->thread.join();
+        running_ = false;
+    }
+
+    bool running() const noexcept { return running_; }
+
+    std::size_t shard_count() const noexcept { return shards_.size(); }
+    std::size_t instrument_count() const noexcept { return config_.instruments; }
+
+    std::size_t shard_of(InstrumentId id) const noexcept { return id % shards_.size(); }
+
+    /// Book of an instrument (id < instrument_count()); after stop().
+    const Book& book(InstrumentId id) const
+    {
+        return *shards_[shard_of(id)]->books[id / shards_.size()];
+    }
+
+    /// Counters of one shard; after stop().
+    const ShardStats& shard_stats(std::size_t shard) const { return shards_[shard]->stats; }
+
+    /// Sum over all shards; after stop().
+    ShardStats total_stats() const
+    {
+        ShardStats total;
+        total.pinned = true;
+        for (const auto& shard : shards_)
+            total += shard->stats;
+        return total;
+    }
+
+private:
+    struct Item
+    {
+        Event        ev;
+        std::int64_t submit_ns{0};
+    };
+
+    struct Shard
+    {
+        explicit Shard(std::size_t capacity) : queue(capacity) {}
+
+        utils::SpscQueueV2<Item>           queue;
+        utils::WakeSignal                  items_ready; // router -> shard (Park)
+        utils::WakeSignal                  space_ready; // shard -> router (Park)
+        std::vector<std::unique_ptr<Book>> books;       // instrument = local * shards + shard
+        ShardStats                         stats;
+        std::thread                        thread;
+    };
+
+    static std::int64_t now_ns() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    bool parking() const noexcept { return config_.wait == utils::WaitMode::Park; }
+
+    void push(Shard& shard, const Item& item)
+    {
+        if (!shard.queue.push(item))
+        {
+            utils::Waiter waiter(config_.wait, &shard.space_ready);
+            while (!shard.queue.push(item))
+                waiter.idle([&] { return !shard.queue.full(); });
+        }
+        if (parking())
+            shard.items_ready.notify();
+    }
+
+    void run_shard(Shard& shard, int cpu)
+    {
+        shard.stats.pinned = cpu >= 0 && utils::pin_current_thread(cpu);
+
+        const std::size_t  batch_size = config_.batch_size;
+        const std::size_t  shards     = shards_.size();
+        std::vector<Item>  items(batch_size);
+        std::vector<Event> events(batch_size);
+        utils::Waiter      waiter(config_.wait, &shard.items_ready);
+
+        for (;;)
+        {
+            std::size_t n = shard.queue.pop_bulk(items.data(), batch_size);
+            if (n == 0)
+            {
+                waiter.idle([&] { return !shard.queue.empty(); });
+                continue;
+            }
+            waiter.reset();
+            if (parking())
+                shard.space_ready.notify();
+
+            // stop() pushes End last, so it can only close a batch.
+            const bool end = items[n - 1].ev.type == EventType::End;
+            if (end)
+                --n;
+
+            const std::int64_t t0 = now_ns();
+            for (std::size_t i = 0; i < n;)
+            {
+                const InstrumentId id = items[i].ev.instrument;
+                std::size_t        j  = i;
+                for (; j < n && items[j].ev.instrument == id; ++j)
+                    events[j] = items[j].ev;
+                shard.stats.apply +=
+                    shard.books[id / shards]->apply(std::span<const Event>(events.data() + i, j - i));
+                i = j;
+            }
+            const std::int64_t t1 = now_ns();
+
+            for (std::size_t i = 0; i < n; ++i)
+                shard.stats.latency.record(static_cast<std::uint64_t>(t1 - items[i].submit_ns));
+            if (n != 0)
+            {
+                ++shard.stats.batches;
+                shard.stats.busy_ns += static_cast<std::uint64_t>(t1 - t0);
+            }
+
+            if (end)
+                break;
+        }
+    }
+
+    ShardedEngineConfig                 config_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    bool                                running_{false};
+};
+
+/// Sharded engine over the default book.
+using ShardedEngine = BasicShardedEngine<OrderBook>;
+
+// Instantiated once in src/sharded_engine.cpp.
+extern template class BasicShardedEngine<OrderBookWith<MapLevels, FlatIdIndex>>;
+extern template class BasicShardedEngine<OrderBookWith<MapLevels, DirectIdIndex>>;
+extern template class BasicShardedEngine<OrderBookWith<LadderLevels, FlatIdIndex>>;
+extern template class BasicShardedEngine<OrderBookWith<LadderLevels, DirectIdIndex>>;
+
+} // namespace trading
@@ -1,13 +1,14 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
-#include <vector>
 
 namespace trading {
 
 using Price    = std::int64_t;   // e.g. price in ticks (1 = 0.01)
 using Quantity = std::int64_t;
 using OrderId  = std::uint64_t;
+using InstrumentId = std::uint16_t; // index of the symbol in a multi-instrument engine
 
 enum class Side {
     Buy,
@@ -27,17 +28,41 @@ struct Trade {
     Quantity qty;
 };
 
+// Fill sink that drops every fill: the default for counts-only callers,
+// inlined away together with the per-fill Trade construction.
+struct NullFillSink {
+    constexpr void operator()(const Trade&) const noexcept {}
+};
+
+// Per-event hook of OrderBook::apply that does nothing (the default).
+struct NullEventHook {
+    constexpr void operator()(std::size_t) const noexcept {}
+};
+
 struct MatchResult {
     Quantity requested{0};
     Quantity filled{0};
     Quantity remaining{0};
-    std::vector<Trade> trades; // новый компонент
+    // Per-fill data is reported through a fill sink, see OrderBook.
 };
 
 struct LevelInfo {
-    bool     valid{false};
+    bool          valid{false};
+    Price         price{0};
+    Quantity      qty{0};
+    std::uint32_t orders{0}; // number of resting orders at the level
+};
+
+// One aggregated level of an exchange snapshot (see OrderBook::load_levels).
+struct PriceLevel {
     Price    price{0};
     Quantity qty{0};
 };
 
+// Best bid and best ask in one read.
+struct TopOfBook {
+    LevelInfo bid;
+    LevelInfo ask;
+};
+
 } // namespace trading
@@ -2,14 +2,15 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <numeric>
 #include <string>
 #include <string_view>
-#include <vector>
 #include <iostream>
 
+#include "utils/latency_histogram.hpp"
+
 namespace bench {
 
 // Result for a single benchmark (and aggregated multi-run)
@@ -19,6 +20,8 @@ struct Result {
     double       p50_ns         = 0.0;
     double       p95_ns         = 0.0;
     double       p99_ns         = 0.0;
+    double       p999_ns        = 0.0;
+    double       p9999_ns       = 0.0;
     std::size_t  iterations     = 0;
     std::size_t  runs           = 1;
     std::size_t  batch_size     = 1;
@@ -38,6 +41,43 @@ struct ChronoTimer {
     }
 };
 
+// Per-batch ns/op samples: exact mean, percentiles from a LatencyHistogram
+// at picosecond resolution (within 1.6%). Fixed memory and no sort, however
+// many batches are recorded.
+class OpSamples {
+public:
+    void add(double ns_per_op) noexcept {
+        sum_ns_ += ns_per_op;
+        ps_.record(static_cast<std::uint64_t>(std::llround(std::max(ns_per_op, 0.0) * 1e3)));
+    }
+
+    std::size_t count() const noexcept { return static_cast<std::size_t>(ps_.count()); }
+
+    double mean_ns() const noexcept {
+        return ps_.empty() ? 0.0 : sum_ns_ / static_cast<double>(ps_.count());
+    }
+
+    // q in [0, 1]
+    double percentile_ns(double q) const noexcept {
+        return static_cast<double>(ps_.percentile(q)) * 1e-3;
+    }
+
+    // mean / p50 / p95 / p99 / p99.9 / p99.99 into a Result-like struct.
+    template<typename Stats>
+    void fill(Stats& stats) const noexcept {
+        stats.mean_ns_per_op = mean_ns();
+        stats.p50_ns         = percentile_ns(0.50);
+        stats.p95_ns         = percentile_ns(0.95);
+        stats.p99_ns         = percentile_ns(0.99);
+        stats.p999_ns        = percentile_ns(0.999);
+        stats.p9999_ns       = percentile_ns(0.9999);
+    }
+
+private:
+    utils::LatencyHistogram ps_;
+    double                  sum_ns_ = 0.0;
+};
+
 namespace detail {
 
 template<typename F>
@@ -69,10 +109,7 @@ Result run_benchmark_with_percentiles_batched_impl(
         fn(i);
     }
 
-    std::vector<double> samples_ns_per_op;
-    samples_ns_per_op.reserve(
-        (iterations - warmup_iters + batch_size - 1) / batch_size
-    );
+    OpSamples samples;
 
     std::size_t i = warmup_iters;
     while (i < iterations) {
@@ -88,36 +125,12 @@ Result run_benchmark_with_percentiles_batched_impl(
 
         double ns        = ChronoTimer::to_ns(t0, t1);
         double ns_per_op = ns / static_cast<double>(ops_in_batch);
-        samples_ns_per_op.push_back(ns_per_op);
+        samples.add(ns_per_op);
 
         i = batch_end;
     }
 
-    if (samples_ns_per_op.empty()) {
-        return stats;
-    }
-
-    // mean(ns/op)
-    double sum = std::accumulate(samples_ns_per_op.begin(),
-                                 samples_ns_per_op.end(), 0.0);
-    stats.mean_ns_per_op = sum / static_cast<double>(samples_ns_per_op.size());
-
-    // percentiles
-    std::sort(samples_ns_per_op.begin(), samples_ns_per_op.end());
-    const std::size_t n = samples_ns_per_op.size();
-
-    auto pick = [&](double p) -> double {
-        if (n == 0) return 0.0;
-        double pos      = p * static_cast<double>(n - 1);
-        std::size_t idx = static_cast<std::size_t>(pos + 0.5);
-        if (idx >= n) idx = n - 1;
-        return samples_ns_per_op[idx];
-    };
-
-    stats.p50_ns = pick(0.50);
-    stats.p95_ns = pick(0.95);
-    stats.p99_ns = pick(0.99);
-
+    samples.fill(stats);
     return stats;
 }
 
@@ -152,10 +165,12 @@ Result run_multi_benchmark(
         return agg;
     }
 
-    double sum_mean = 0.0;
-    double sum_p50  = 0.0;
-    double sum_p95  = 0.0;
-    double sum_p99  = 0.0;
+    double sum_mean  = 0.0;
+    double sum_p50   = 0.0;
+    double sum_p95   = 0.0;
+    double sum_p99   = 0.0;
+    double sum_p999  = 0.0;
+    double sum_p9999 = 0.0;
 
     for (std::size_t r = 0; r < runs; ++r) {
         Result s = make_single(r);
@@ -165,17 +180,21 @@ Result run_multi_benchmark(
             agg.batch_size = s.batch_size;
         }
 
-        sum_mean += s.mean_ns_per_op;
-        sum_p50  += s.p50_ns;
-        sum_p95  += s.p95_ns;
-        sum_p99  += s.p99_ns;
+        sum_mean  += s.mean_ns_per_op;
+        sum_p50   += s.p50_ns;
+        sum_p95   += s.p95_ns;
+        sum_p99   += s.p99_ns;
+        sum_p999  += s.p999_ns;
+        sum_p9999 += s.p9999_ns;
     }
 
     const double inv_runs = 1.0 / static_cast<double>(runs);
-    agg.mean_ns_per_op = sum_mean * inv_runs;
-    agg.p50_ns         = sum_p50  * inv_runs;
-    agg.p95_ns         = sum_p95  * inv_runs;
-    agg.p99_ns         = sum_p99  * inv_runs;
+    agg.mean_ns_per_op = sum_mean  * inv_runs;
+    agg.p50_ns         = sum_p50   * inv_runs;
+    agg.p95_ns         = sum_p95   * inv_runs;
+    agg.p99_ns         = sum_p99   * inv_runs;
+    agg.p999_ns        = sum_p999  * inv_runs;
+    agg.p9999_ns       = sum_p9999 * inv_runs;
 
     return agg;
 }
@@ -204,6 +223,8 @@ inline void print_multi(const Result& s)
     std::cout << "  p50 ns:     " << s.p50_ns << "\n";
     std::cout << "  p95 ns:     " << s.p95_ns << "\n";
     std::cout << "  p99 ns:     " << s.p99_ns << "\n";
+    std::cout << "  p99.9 ns:   " << s.p999_ns << "\n";
+    std::cout << "  p99.99 ns:  " << s.p9999_ns << "\n";
 }
 
 } // namespace bench
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace utils {
+
+// Pin the calling thread to one logical CPU. Returns false if the CPU does
+// not exist / is not allowed, or on platforms without affinity support.
+// cpu < 0 means "do not pin" and returns true.
+inline bool pin_current_thread(int cpu) noexcept {
+    if (cpu < 0) {
+        return true;
+    }
+#if defined(__linux__)
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+// Parse a "cpu=N" style value: a non-negative CPU index, or -1 for "any".
+inline bool parse_cpu(std::string_view s, int& out) {
+    try {
+        std::size_t pos = 0;
+        const int   cpu = std::stoi(std::string(s), &pos);
+        if (pos != s.size() || cpu < -1) {
+            return false;
+        }
+        out = cpu;
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+} // namespace utils
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace utils {
+
+// 10^n for n in [0, 18].
+inline constexpr std::int64_t kPow10[] = {
+    1LL,
+    10LL,
+    100LL,
+    1'000LL,
+    10'000LL,
+    100'000LL,
+    1'000'000LL,
+    10'000'000LL,
+    100'000'000LL,
+    1'000'000'000LL,
+    10'000'000'000LL,
+    100'000'000'000LL,
+    1'000'000'000'000LL,
+    10'000'000'000'000LL,
+    100'000'000'000'000LL,
+    1'000'000'000'000'000LL,
+    10'000'000'000'000'000LL,
+    100'000'000'000'000'000LL,
+    1'000'000'000'000'000'000LL,
+};
+
+inline constexpr unsigned kMaxDecimals = 18;
+
+// Parse a plain decimal string ("123", "-0.25", "16493.50") straight into
+// fixed-point ticks of 10^-decimals: "16493.50" with decimals = 1 -> 164935.
+//
+// Digits beyond `decimals` are rounded half away from zero (same as llround
+// of the scaled double, without the binary rounding error). No exponents, no
+// leading '+', no whitespace. Returns false on malformed input or overflow;
+// `out` is only written on success. No allocation, no locale.
+inline bool parse_fixed_point(std::string_view s, unsigned decimals, std::int64_t& out) noexcept {
+    if (s.empty() || decimals > kMaxDecimals) {
+        return false;
+    }
+
+    std::size_t i   = 0;
+    const bool  neg = s[0] == '-';
+    if (neg) {
+        ++i;
+    }
+
+    constexpr std::uint64_t kLimit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+
+    std::uint64_t value      = 0;
+    unsigned      frac_seen  = 0;
+    bool          any_digit  = false;
+    bool          in_frac    = false;
+    bool          round_up   = false;
+    bool          rounded    = false; // first dropped digit already looked at
+
+    for (; i < s.size(); ++i) {
+        const char c = s[i];
+        if (c == '.') {
+            if (in_frac) {
+                return false;
+            }
+            in_frac = true;
+            continue;
+        }
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        any_digit = true;
+
+        if (in_frac && frac_seen == decimals) {
+            // Beyond the tick precision: only the first dropped digit rounds.
+            if (!rounded) {
+                round_up = c >= '5';
+                rounded  = true;
+            }
+            continue;
+        }
+
+        const auto d = static_cast<std::uint64_t>(c - '0');
+        if (value > (kLimit - d) / 10) {
+            return false;
+        }
+        value = value * 10 + d;
+        if (in_frac) {
+            ++frac_seen;
+        }
+    }
+
+    if (!any_digit) {
+        return false;
+    }
+
+    // Pad missing fractional digits: "1.5" with 3 decimals -> 1500.
+    const auto scale = static_cast<std::uint64_t>(kPow10[decimals - frac_seen]);
+    if (value > kLimit / scale) {
+        return false;
+    }
+    value *= scale;
+
+    if (round_up) {
+        if (value == kLimit) {
+            return false;
+        }
+        ++value;
+    }
+
+    out = neg ? -static_cast<std::int64_t>(value) : static_cast<std::int64_t>(value);
+    return true;
+}
+
+} // namespace utils
@@ -1,21 +1,64 @@
 // include/utils/http_client.hpp
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 namespace utils {
 
+// One GET of a batch: path like "/v5/market/orderbook", query optional.
+struct HttpRequest {
+    std::string path;
+    std::string query;
+};
+
+// Outcome of one batched GET; batches never throw per request.
+struct HttpResult {
+    long        status = 0; // HTTP status, 0 if no response
+    std::string body;
+    std::string error;      // empty on HTTP 200
+
+    bool ok() const noexcept { return error.empty(); }
+};
+
+// Keep-alive HTTP client for one base URL.
+//
+//  - get() reuses one curl easy handle, so consecutive requests go over the
+//    same kept-alive connection (no TCP / TLS handshake after the first);
+//    the response buffer and URL string are reused as well.
+//  - get_many() runs a batch concurrently on a curl_multi handle with a
+//    pool of easy handles that is kept between batches, each with its own
+//    response buffer (grown once, then reused; results get a copy). HTTP/2
+//    servers get the requests multiplexed over one connection.
+//  - All handles of a client share DNS cache, TLS session cache and
+//    connection pool (curl_share), so even a new pool handle resumes the
+//    TLS session instead of doing a full handshake.
+//
+// Not thread-safe: use one client per thread.
 class HttpClient {
 public:
     // base_url like "https://api.bybit.com"
     explicit HttpClient(std::string base_url);
+    ~HttpClient();
+
+    HttpClient(HttpClient&&) noexcept;
+    HttpClient& operator=(HttpClient&&) noexcept;
 
     // Simple GET: path like "/v5/market/time",
     // query like "category=spot&symbol=BTCUSDT" (optional).
-    std::string get(const std::string& path, const std::string& query = "");
+    // The returned body is valid until the next get() on this client.
+    // Throws std::runtime_error on transport errors and non-200 statuses.
+    const std::string& get(const std::string& path, const std::string& query = "");
+
+    // Concurrent GETs, at most max_parallel in flight; results in request order.
+    std::vector<HttpResult> get_many(std::span<const HttpRequest> requests, std::size_t max_parallel = 8);
 
 private:
-    std::string base_url_;
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
 };
 
 } // namespace utils
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace utils {
+
+// Fixed-memory log-linear latency histogram (HdrHistogram layout).
+//
+// Values are split into power-of-two ranges, each cut into kSubBuckets
+// linear sub-buckets, so every bucket is at most 1/kSubBuckets = 1.6% wide
+// relative to its value:
+//  - values < 2 * kSubBuckets are counted exactly (one bucket per value);
+//  - above that, a value v with bit_width(v) = w lands in a bucket of width
+//    2^(w - kSubBucketBits - 1).
+// Values >= 2^kMaxValueBits (~18 minutes in ns) share the last bucket; min
+// and max are tracked exactly.
+//
+//   LatencyHistogram h;
+//   h.record(dt_ns);                  // O(1), no allocation
+//   total.merge(per_thread);          // O(kBucketCount), e.g. after join()
+//   h.percentile(0.999);              // p99.9, q in [0, 1]
+//
+// Not thread-safe: keep one histogram per thread and merge them.
+class LatencyHistogram {
+public:
+    static constexpr unsigned    kSubBucketBits = 6;
+    static constexpr std::size_t kSubBuckets    = std::size_t{1} << kSubBucketBits;
+    static constexpr unsigned    kMaxValueBits  = 40;
+    static constexpr std::size_t kBucketCount   = (kMaxValueBits - kSubBucketBits + 1) * kSubBuckets;
+
+    static constexpr std::uint64_t kMaxTrackable = (std::uint64_t{1} << kMaxValueBits) - 1;
+
+    // Bucket of value v (values above kMaxTrackable go to the last bucket).
+    static constexpr std::size_t bucket_index(std::uint64_t v) noexcept {
+        v = std::min(v, kMaxTrackable);
+        const unsigned width = static_cast<unsigned>(std::bit_width(v));
+        const unsigned shift = width > kSubBucketBits + 1 ? width - kSubBucketBits - 1 : 0;
+        return (static_cast<std::size_t>(shift) << kSubBucketBits) + static_cast<std::size_t>(v >> shift);
+    }
+
+    // Smallest / largest value counted in bucket `index`.
+    static constexpr std::uint64_t lowest_in_bucket(std::size_t index) noexcept {
+        if (index < 2 * kSubBuckets) {
+            return index;
+        }
+        const std::size_t shift = (index >> kSubBucketBits) - 1;
+        return static_cast<std::uint64_t>(index - (shift << kSubBucketBits)) << shift;
+    }
+
+    static constexpr std::uint64_t highest_in_bucket(std::size_t index) noexcept {
+        return index + 1 < kBucketCount ? lowest_in_bucket(index + 1) - 1
+                                        : std::numeric_limits<std::uint64_t>::max();
+    }
+
+    void record(std::uint64_t v) noexcept { record_n(v, 1); }
+
+    void record_n(std::uint64_t v, std::uint64_t n) noexcept {
+        if (n == 0) {
+            return;
+        }
+        counts_[bucket_index(v)] += n;
+        count_ += n;
+        sum_   += v * n;
+        min_    = std::min(min_, v);
+        max_    = std::max(max_, v);
+    }
+
+    void merge(const LatencyHistogram& other) noexcept {
+        if (other.count_ == 0) {
+            return;
+        }
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        count_ += other.count_;
+        sum_   += other.sum_;
+        min_    = std::min(min_, other.min_);
+        max_    = std::max(max_, other.max_);
+    }
+
+    void reset() noexcept { *this = LatencyHistogram{}; }
+
+    std::uint64_t count() const noexcept { return count_; }
+    bool          empty() const noexcept { return count_ == 0; }
+    std::uint64_t sum() const noexcept { return sum_; }
+    std::uint64_t min() const noexcept { return count_ ? min_ : 0; }
+    std::uint64_t max() const noexcept { return max_; }
+
+    double mean() const noexcept {
+        return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0;
+    }
+
+    // Value at quantile q in [0, 1]: the upper bound of the bucket holding
+    // the ceil(q * count)-th smallest sample, clamped to [min, max]; so the
+    // result is >= the exact percentile and within one bucket width of it.
+    // 0 if empty.
+    std::uint64_t percentile(double q) const noexcept {
+        if (count_ == 0) {
+            return 0;
+        }
+        q = std::clamp(q, 0.0, 1.0);
+        auto rank = static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(count_)));
+        rank      = std::clamp<std::uint64_t>(rank, 1, count_);
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < kBucketCount; ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return std::clamp(highest_in_bucket(i), min(), max_);
+            }
+        }
+        return max_;
+    }
+
+    // Number of samples in bucket `index`.
+    std::uint64_t count_at(std::size_t index) const noexcept { return counts_[index]; }
+
+private:
+    std::array<std::uint64_t, kBucketCount> counts_{};
+    std::uint64_t                           count_ = 0;
+    std::uint64_t                           sum_   = 0;
+    std::uint64_t                           min_   = std::numeric_limits<std::uint64_t>::max();
+    std::uint64_t                           max_   = 0;
+};
+
+} // namespace utils
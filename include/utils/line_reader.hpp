@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace utils {
+
+// Line-by-line reader over a file descriptor that pulls large blocks with
+// read(2) and hands out views into its buffer, instead of one getline +
+// std::string per line.
+//
+//   LineReader in("events.csv");          // or LineReader in(STDIN_FILENO);
+//   std::string_view line;
+//   while (in.next(line)) { ... }         // line is valid until the next call
+//   if (in.failed()) { ... }              // open / read error
+//
+// '\n' terminates a line and is not included ('\r' is left to the parser).
+// A last line without '\n' is returned as well. read(2) returns what is
+// available, so on a pipe lines are delivered as soon as they arrive. The
+// buffer only grows for a line longer than block_size.
+class LineReader {
+public:
+    static constexpr std::size_t kDefaultBlockSize = 1 << 20;
+
+    // Open path for reading (the reader owns the descriptor).
+    explicit LineReader(const std::string& path, std::size_t block_size = kDefaultBlockSize);
+
+    // Read from an already open descriptor (not closed by the reader).
+    explicit LineReader(int fd, std::size_t block_size = kDefaultBlockSize);
+
+    ~LineReader();
+
+    LineReader(const LineReader&)            = delete;
+    LineReader& operator=(const LineReader&) = delete;
+
+    bool next(std::string_view& line);
+
+    // 1-based number of the line last returned by next().
+    std::size_t line_number() const noexcept { return line_no_; }
+
+    // Total bytes read so far.
+    std::size_t bytes_read() const noexcept { return bytes_read_; }
+
+    // True if the file could not be opened or read(2) failed.
+    bool failed() const noexcept { return failed_; }
+
+private:
+    bool fill();
+
+    int               fd_         = -1;
+    bool              owns_fd_    = false;
+    bool              eof_        = false;
+    bool              failed_     = false;
+    std::size_t       block_size_ = kDefaultBlockSize;
+    std::vector<char> buffer_;
+    std::size_t       begin_      = 0; // first unread byte
+    std::size_t       end_        = 0; // one past the last valid byte
+    std::size_t       line_no_    = 0;
+    std::size_t       bytes_read_ = 0;
+};
+
+} // namespace utils
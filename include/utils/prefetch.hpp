@@ -0,0 +1,21 @@
+#pragma once
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace utils {
+
+// Hint the CPU to pull the cache line holding p into L1 ahead of a read.
+// Never faults, so p may point anywhere (including past the end of a buffer).
+inline void prefetch(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p, 0, 3);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+    (void)p;
+#endif
+}
+
+} // namespace utils
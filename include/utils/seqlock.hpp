@@ -0,0 +1,93 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "utils/spsc_queue_v2.hpp" // kCacheLineSize
+#include "utils/wait_strategy.hpp" // cpu_relax
+
+namespace utils {
+
+// Single-writer / many-reader seqlock around a trivially copyable value.
+//
+//  - store() never waits: it bumps the sequence to odd, writes the value,
+//    bumps it to even. Readers write nothing shared, so any number of them
+//    never slow the writer down (beyond sharing the cache line).
+//  - try_load() copies the value and checks the sequence did not move and
+//    was even; on a concurrent store it fails and the reader retries.
+//
+// The value is kept as relaxed atomic 64-bit words, so a torn read is a
+// detected retry, not a data race. The slot is cache-line aligned and
+// padded: adjacent slots never share a line.
+//
+// Exactly one writer thread; any number of reader threads.
+template <typename T>
+class alignas(kCacheLineSize) Seqlock {
+    static_assert(std::is_trivially_copyable_v<T>, "Seqlock<T>: T must be trivially copyable");
+
+public:
+    static constexpr std::size_t kWords = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    // Before the first store() a load returns T's all-zero-bytes value.
+    Seqlock() noexcept = default;
+
+    Seqlock(const Seqlock&)            = delete;
+    Seqlock& operator=(const Seqlock&) = delete;
+
+    // ---- writer ----
+
+    void store(const T& value) noexcept {
+        std::array<std::uint64_t, kWords> words{};
+        std::memcpy(words.data(), &value, sizeof(T));
+
+        const std::uint64_t seq = seq_.load(std::memory_order_relaxed);
+        seq_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release); // odd seq before the data
+        for (std::size_t i = 0; i < kWords; ++i) {
+            data_[i].store(words[i], std::memory_order_relaxed);
+        }
+        seq_.store(seq + 2, std::memory_order_release);
+    }
+
+    // ---- readers ----
+
+    // One attempt; false if a store was in progress or happened meanwhile.
+    bool try_load(T& out) const noexcept {
+        const std::uint64_t before = seq_.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+        std::array<std::uint64_t, kWords> words;
+        for (std::size_t i = 0; i < kWords; ++i) {
+            words[i] = data_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire); // data before the re-check
+        if (seq_.load(std::memory_order_relaxed) != before) {
+            return false;
+        }
+        std::memcpy(static_cast<void*>(&out), words.data(), sizeof(T));
+        return true;
+    }
+
+    // Spin until a consistent copy is read.
+    T load() const noexcept {
+        T value;
+        while (!try_load(value)) {
+            cpu_relax();
+        }
+        return value;
+    }
+
+    // Number of completed stores: a reader can skip a slot it already saw.
+    std::uint64_t version() const noexcept { return seq_.load(std::memory_order_acquire) / 2; }
+
+private:
+    std::atomic<std::uint64_t>                     seq_{0};
+    std::array<std::atomic<std::uint64_t>, kWords> data_{};
+};
+
+} // namespace utils
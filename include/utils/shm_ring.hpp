@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace utils {
+
+// Single-producer / single-consumer ring of variable-length messages in
+// POSIX shared memory (/dev/shm/<name>), for feeds whose producer has to stay
+// a separate process (tools/*.py --shm NAME). The consumer reads each
+// message in place — no pipe, no read(2) copy, no line splitting.
+//
+//   ShmRing ring("bybit_feed", 1 << 22);  // consumer: create, unlinked on destruction
+//   ShmRing ring("bybit_feed");           // producer: attach to an existing ring
+//
+//   producer: ring.try_push(msg) ... ring.close();
+//   consumer: std::string_view msg;
+//             while (ring.front(msg)) { ...; ring.pop(); }   // msg valid until pop()
+//
+// Layout (little-endian, offsets in bytes) — kept simple so a producer in
+// another language can write it through a plain mmap:
+//
+//   0    char[8]  magic "TRDSHMRG"
+//   8    u32      version (1)
+//   12   u32      header size (192)
+//   16   u64      capacity: data bytes, a power of two
+//   24   u32      closed: set by the producer when it is done
+//   64   u64      write position (bytes ever written; producer only)
+//   128  u64      read position (bytes ever consumed; consumer only)
+//   192  data
+//
+// A record is a u32 payload length followed by the payload, padded to 8
+// bytes; the producer stores the record first and publishes it by advancing
+// the write position. Records never wrap: if one does not fit before the end
+// of the data area, a u32 kWrapMark is written there and the record starts at
+// offset 0.
+//
+// Throws std::runtime_error on open / format errors.
+class ShmRing {
+public:
+    static constexpr char          kMagic[8]   = {'T', 'R', 'D', 'S', 'H', 'M', 'R', 'G'};
+    static constexpr std::uint32_t kVersion    = 1;
+    static constexpr std::size_t   kHeaderSize = 192;
+    static constexpr std::uint32_t kWrapMark   = 0xFFFFFFFFu;
+
+    // Consumer side: create (or replace) the ring with at least `capacity`
+    // data bytes (rounded up to a power of two).
+    ShmRing(const std::string& name, std::size_t capacity);
+
+    // Producer side: attach to a ring created by the consumer.
+    explicit ShmRing(const std::string& name);
+
+    ~ShmRing();
+
+    ShmRing(const ShmRing&)            = delete;
+    ShmRing& operator=(const ShmRing&) = delete;
+
+    // ---- producer ----------------------------------------------------------
+    // False if the ring is full (or msg can never fit).
+    bool try_push(std::string_view msg) noexcept;
+    // No more messages: the consumer sees closed() once it has drained the ring.
+    void close() noexcept;
+
+    // ---- consumer ----------------------------------------------------------
+    // Oldest message, viewed in shared memory; false if the ring is empty.
+    bool front(std::string_view& msg) noexcept;
+    // Release the message returned by front().
+    void pop() noexcept;
+    bool closed() const noexcept;
+
+    std::size_t        capacity() const noexcept { return capacity_; }
+    const std::string& name() const noexcept { return name_; }
+
+private:
+    std::uint64_t& write_pos() const noexcept;
+    std::uint64_t& read_pos() const noexcept;
+    std::uint32_t& closed_flag() const noexcept;
+    char*          data() const noexcept { return base_ + kHeaderSize; }
+
+    std::string   name_;
+    bool          owner_    = false; // created here: unlink on destruction
+    char*         base_     = nullptr;
+    std::size_t   length_   = 0;
+    std::size_t   capacity_ = 0;
+    std::uint64_t local_    = 0; // producer: write pos, consumer: read pos
+    std::uint64_t cached_   = 0; // last seen position of the other side
+    std::uint64_t pending_  = 0; // consumer: bytes of the record front() returned
+};
+
+} // namespace utils
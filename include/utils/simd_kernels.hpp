@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace utils::simd {
+
+// Vectorized kernels for level arrays kept as structure of arrays
+// (prices[] and qtys[] side by side) and for decimal string -> tick parsing,
+// with one implementation per instruction set, picked at run time:
+//
+//   Scalar   portable C++ (whatever the compiler makes of it for the baseline ISA);
+//   Avx2     x86-64 AVX2 (the decimal parser uses SSE4.1 within the same tier:
+//            one price / qty field fits in 16 bytes).
+//
+// The library is built for the baseline ISA; the AVX2 code is compiled with
+// a per-function target attribute and only called when the CPU reports AVX2,
+// so the same binary runs everywhere. Every tier returns exactly the same
+// results as Scalar.
+enum class Level : std::uint8_t { Scalar, Avx2 };
+
+const char* name(Level level) noexcept;
+
+// Best level this CPU supports.
+Level detected() noexcept;
+
+// Level used by the dispatching functions below; detected() by default.
+Level active() noexcept;
+// Switch the dispatching functions (e.g. to benchmark Scalar on an AVX2
+// box). False, nothing changed, if the CPU does not support `level`.
+bool set_active(Level level) noexcept;
+
+struct Kernels {
+    // Sum of qtys[0, n).
+    std::int64_t (*sum_qty)(const std::int64_t* qtys, std::size_t n) noexcept;
+    // Drop the levels with qty <= 0 in place, keeping the order of the rest;
+    // returns the new count. Entries past it are unspecified.
+    std::size_t (*compact_levels)(std::int64_t* prices, std::int64_t* qtys, std::size_t n) noexcept;
+    // Same contract as utils::parse_fixed_point (decimal.hpp).
+    bool (*parse_decimal)(std::string_view s, unsigned decimals, std::int64_t& out) noexcept;
+};
+
+// Kernels of one level; nullptr if the CPU (or the build) does not support it.
+const Kernels* kernels(Level level) noexcept;
+
+// Kernels of active().
+const Kernels& active_kernels() noexcept;
+
+// ---- dispatching entry points -----------------------------------------------
+
+inline std::int64_t sum_qty(std::span<const std::int64_t> qtys) noexcept {
+    return active_kernels().sum_qty(qtys.data(), qtys.size());
+}
+
+// prices and qtys are the same level array: sizes must match.
+inline std::size_t compact_levels(std::span<std::int64_t> prices, std::span<std::int64_t> qtys) noexcept {
+    return active_kernels().compact_levels(prices.data(), qtys.data(), qtys.size());
+}
+
+inline bool parse_decimal(std::string_view s, unsigned decimals, std::int64_t& out) noexcept {
+    return active_kernels().parse_decimal(s, decimals, out);
+}
+
+} // namespace utils::simd
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+
+namespace utils {
+
+// Cache line size used for padding; 64 on every x86-64 / most ARM cores.
+inline constexpr std::size_t kCacheLineSize = 64;
+
+// Bounded single-producer / single-consumer ring, v2 of SpscQueue:
+//  - capacity is rounded up to a power of two, indices wrap with a mask and
+//    run freely (head - tail = size), so all capacity() cells are usable;
+//  - producer and consumer indices live on separate cache lines;
+//  - each side keeps a cached copy of the other side's index and reloads the
+//    shared atomic only when the cache says full / empty;
+//  - push_bulk / pop_bulk move up to N items with one release store.
+//
+// Same contract as SpscQueue: T must be default-constructible and copy- or
+// move-assignable; exactly one producer thread and one consumer thread.
+template <typename T>
+class SpscQueueV2 {
+public:
+    explicit SpscQueueV2(std::size_t capacity)
+        : capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 2))),
+          mask_(capacity_ - 1),
+          buffer_(std::make_unique<T[]>(capacity_))
+    {}
+
+    SpscQueueV2(const SpscQueueV2&)            = delete;
+    SpscQueueV2& operator=(const SpscQueueV2&) = delete;
+
+    // ---- producer ----
+
+    bool push(const T& value) {
+        const std::size_t head = producer_.head.load(std::memory_order_relaxed);
+        if (!has_room(head, 1)) {
+            return false; // full
+        }
+        buffer_[head & mask_] = value;
+        producer_.head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Push up to n items from `items`; returns how many were pushed.
+    std::size_t push_bulk(const T* items, std::size_t n) {
+        const std::size_t head = producer_.head.load(std::memory_order_relaxed);
+        std::size_t free = capacity_ - (head - producer_.cached_tail);
+        if (free < n) {
+            producer_.cached_tail = consumer_.tail.load(std::memory_order_acquire);
+            free = capacity_ - (head - producer_.cached_tail);
+        }
+        n = std::min(n, free);
+        copy_in(head, items, n);
+        if (n != 0) {
+            producer_.head.store(head + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // ---- consumer ----
+
+    bool pop(T& out) {
+        const std::size_t tail = consumer_.tail.load(std::memory_order_relaxed);
+        if (tail == consumer_.cached_head) {
+            consumer_.cached_head = producer_.head.load(std::memory_order_acquire);
+            if (tail == consumer_.cached_head) {
+                return false; // empty
+            }
+        }
+        out = std::move(buffer_[tail & mask_]);
+        consumer_.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pop up to max_items into `out`; returns how many were popped.
+    std::size_t pop_bulk(T* out, std::size_t max_items) {
+        const std::size_t tail = consumer_.tail.load(std::memory_order_relaxed);
+        std::size_t avail = consumer_.cached_head - tail;
+        if (avail < max_items) {
+            consumer_.cached_head = producer_.head.load(std::memory_order_acquire);
+            avail = consumer_.cached_head - tail;
+        }
+        const std::size_t n = std::min(avail, max_items);
+        copy_out(tail, out, n);
+        if (n != 0) {
+            consumer_.tail.store(tail + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    // ---- either side (approximate while the other side is running) ----
+
+    bool empty() const {
+        return producer_.head.load(std::memory_order_acquire) ==
+               consumer_.tail.load(std::memory_order_acquire);
+    }
+
+    bool full() const { return size() == capacity_; }
+
+    std::size_t size() const {
+        const std::size_t tail = consumer_.tail.load(std::memory_order_acquire);
+        const std::size_t head = producer_.head.load(std::memory_order_acquire);
+        return head - tail;
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    bool has_room(std::size_t head, std::size_t n) {
+        if (head - producer_.cached_tail + n <= capacity_) {
+            return true;
+        }
+        producer_.cached_tail = consumer_.tail.load(std::memory_order_acquire);
+        return head - producer_.cached_tail + n <= capacity_;
+    }
+
+    // Copy in at most two contiguous runs (before and after the wrap point).
+    void copy_in(std::size_t head, const T* items, std::size_t n) {
+        const std::size_t pos   = head & mask_;
+        const std::size_t first = std::min(n, capacity_ - pos);
+        std::copy_n(items, first, buffer_.get() + pos);
+        if (first < n) {
+            std::copy_n(items + first, n - first, buffer_.get());
+        }
+    }
+
+    void copy_out(std::size_t tail, T* out, std::size_t n) {
+        const std::size_t pos   = tail & mask_;
+        const std::size_t first = std::min(n, capacity_ - pos);
+        std::move(buffer_.get() + pos, buffer_.get() + pos + first, out);
+        if (first < n) {
+            std::move(buffer_.get(), buffer_.get() + (n - first), out + first);
+        }
+    }
+
+    // Producer line: head is read by the consumer, cached_tail is private.
+    struct alignas(kCacheLineSize) ProducerSide {
+        std::atomic<std::size_t> head{0};
+        std::size_t              cached_tail{0};
+    };
+
+    // Consumer line: tail is read by the producer, cached_head is private.
+    struct alignas(kCacheLineSize) ConsumerSide {
+        std::atomic<std::size_t> tail{0};
+        std::size_t              cached_head{0};
+    };
+
+    // Read-only after construction: own line, so index stores do not
+    // invalidate it.
+    alignas(kCacheLineSize) const std::size_t capacity_;
+    const std::size_t                         mask_;
+    std::unique_ptr<T[]>                      buffer_;
+
+    ProducerSide producer_;
+    ConsumerSide consumer_;
+};
+
+} // namespace utils
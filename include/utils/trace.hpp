@@ -0,0 +1,250 @@
+#pragma once
+
+// Hot-path stage tracing on the TSC.
+//
+//   void on_frame(...) {
+//       TRADING_TRACE_SCOPE("parse");     // rdtsc now and at scope exit
+//       ...
+//   }
+//   TRADING_TRACE_FLUSH();                // idle point, off the hot path
+//   TRADING_TRACE_REPORT(std::cout);      // per-stage ns breakdown
+//
+// Enabled by compiling with TRADING_TRACE=1 (cmake -DENABLE_TRACING=ON).
+// Otherwise every TRADING_TRACE_* macro expands to nothing and this header
+// pulls in no code at all.
+//
+// How it works (enabled):
+//  - a scope writes one {start, end, stage} record into a thread-local
+//    SpscQueueV2 ring: two rdtsc reads and one push, no lock, no allocation;
+//    a full ring drops the record and counts it;
+//  - TRADING_TRACE_FLUSH() (any thread) drains every ring into per-stage
+//    LatencyHistograms (in ticks) under a mutex; call it where the thread
+//    would otherwise idle, and rings of finished threads are drained too;
+//  - the report converts ticks to ns with bench::detail::tsc_ns_per_tick().
+//
+// Nested scopes are reported separately (an outer stage includes its inner
+// ones). A stage name must be a string that outlives the program (literal).
+
+#if defined(TRADING_TRACE) && TRADING_TRACE
+    #define TRADING_TRACE_ENABLED 1
+#else
+    #define TRADING_TRACE_ENABLED 0
+#endif
+
+#if TRADING_TRACE_ENABLED
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "utils/latency_histogram.hpp"
+#include "utils/spsc_queue_v2.hpp"
+#include "utils/tsc_timer.hpp"
+
+namespace utils::trace {
+
+using StageId = std::uint16_t;
+
+// Records per thread between two flushes.
+inline constexpr std::size_t kRingCapacity = 1 << 13;
+
+struct SpanRecord {
+    std::uint64_t start = 0; // TSC
+    std::uint64_t end   = 0; // TSC
+    StageId       stage = 0;
+};
+
+// One per tracing thread: the thread pushes, flush() pops.
+struct Ring {
+    SpscQueueV2<SpanRecord>    queue{kRingCapacity};
+    std::atomic<std::uint64_t> dropped{0};
+};
+
+struct StageSummary {
+    std::string_view name;
+    std::uint64_t    count   = 0;
+    double           mean_ns = 0.0;
+    double           p50_ns  = 0.0;
+    double           p99_ns  = 0.0;
+    double           p999_ns = 0.0;
+    double           max_ns  = 0.0;
+};
+
+struct Report {
+    std::vector<StageSummary> stages;      // in registration order
+    std::uint64_t             dropped = 0; // records lost to full rings
+};
+
+class Registry {
+public:
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    // Id of `name`, registered on first use.
+    StageId stage(std::string_view name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t i = 0; i < stages_.size(); ++i) {
+            if (stages_[i].name == name) {
+                return static_cast<StageId>(i);
+            }
+        }
+        stages_.push_back(Stage{name, std::make_unique<LatencyHistogram>()});
+        return static_cast<StageId>(stages_.size() - 1);
+    }
+
+    std::shared_ptr<Ring> attach() {
+        auto ring = std::make_shared<Ring>();
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_.push_back(ring);
+        return ring;
+    }
+
+    void flush() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        flush_locked();
+    }
+
+    Report report() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        flush_locked();
+
+        const double ns_per_tick = bench::detail::tsc_ns_per_tick();
+        Report       out;
+        out.dropped = dropped_;
+        for (const Stage& s : stages_) {
+            const LatencyHistogram& h = *s.ticks;
+            StageSummary            sum;
+            sum.name    = s.name;
+            sum.count   = h.count();
+            sum.mean_ns = h.mean() * ns_per_tick;
+            sum.p50_ns  = static_cast<double>(h.percentile(0.50)) * ns_per_tick;
+            sum.p99_ns  = static_cast<double>(h.percentile(0.99)) * ns_per_tick;
+            sum.p999_ns = static_cast<double>(h.percentile(0.999)) * ns_per_tick;
+            sum.max_ns  = static_cast<double>(h.max()) * ns_per_tick;
+            out.stages.push_back(sum);
+        }
+        return out;
+    }
+
+    // Forget collected samples (stages and rings stay registered).
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        flush_locked();
+        for (Stage& s : stages_) {
+            s.ticks->reset();
+        }
+        dropped_ = 0;
+    }
+
+private:
+    struct Stage {
+        std::string_view                  name;
+        std::unique_ptr<LatencyHistogram> ticks;
+    };
+
+    static constexpr std::size_t kFlushBatch = 256;
+
+    void flush_locked() {
+        SpanRecord batch[kFlushBatch];
+        for (const auto& ring : rings_) {
+            std::size_t n = 0;
+            while ((n = ring->queue.pop_bulk(batch, kFlushBatch)) != 0) {
+                for (std::size_t i = 0; i < n; ++i) {
+                    const SpanRecord& r = batch[i];
+                    if (r.stage < stages_.size() && r.end >= r.start) {
+                        stages_[r.stage].ticks->record(r.end - r.start);
+                    }
+                }
+            }
+            dropped_ += ring->dropped.exchange(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::mutex                         mutex_;
+    std::vector<Stage>                 stages_;
+    std::vector<std::shared_ptr<Ring>> rings_; // kept after the thread exits
+    std::uint64_t                      dropped_ = 0;
+};
+
+inline StageId stage(std::string_view name) {
+    return Registry::instance().stage(name);
+}
+
+inline Ring& local_ring() {
+    thread_local const std::shared_ptr<Ring> ring = Registry::instance().attach();
+    return *ring;
+}
+
+inline void record(StageId stage, std::uint64_t start, std::uint64_t end) noexcept {
+    Ring& ring = local_ring();
+    if (!ring.queue.push(SpanRecord{start, end, stage})) {
+        ring.dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Times its own lifetime.
+class Scope {
+public:
+    explicit Scope(StageId stage) noexcept
+        : stage_(stage), start_(bench::TscTimer::now()) {}
+
+    ~Scope() { record(stage_, start_, bench::TscTimer::now()); }
+
+    Scope(const Scope&)            = delete;
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    StageId       stage_;
+    std::uint64_t start_;
+};
+
+inline void flush() { Registry::instance().flush(); }
+
+inline void print_report(std::ostream& os) {
+    const Report report = Registry::instance().report();
+
+    os << "Stage breakdown (TSC trace):\n";
+    for (const StageSummary& s : report.stages) {
+        os << "  " << s.name << ": n=" << s.count;
+        if (s.count != 0) {
+            os << ", mean=" << s.mean_ns << " ns"
+               << ", p50=" << s.p50_ns
+               << ", p99=" << s.p99_ns
+               << ", p99.9=" << s.p999_ns
+               << ", max=" << s.max_ns << " ns";
+        }
+        os << "\n";
+    }
+    if (report.dropped != 0) {
+        os << "  (" << report.dropped << " records dropped: flush more often)\n";
+    }
+}
+
+} // namespace utils::trace
+
+#define TRADING_TRACE_CONCAT_INNER(a, b) a##b
+#define TRADING_TRACE_CONCAT(a, b)       TRADING_TRACE_CONCAT_INNER(a, b)
+
+#define TRADING_TRACE_SCOPE(name)                                                                  \
+    static const ::utils::trace::StageId TRADING_TRACE_CONCAT(trading_trace_stage_, __LINE__) =    \
+        ::utils::trace::stage(name);                                                               \
+    const ::utils::trace::Scope TRADING_TRACE_CONCAT(trading_trace_scope_, __LINE__)(              \
+        TRADING_TRACE_CONCAT(trading_trace_stage_, __LINE__))
+
+#define TRADING_TRACE_FLUSH()      ::utils::trace::flush()
+#define TRADING_TRACE_REPORT(os)   ::utils::trace::print_report(os)
+
+#else
+
+#define TRADING_TRACE_SCOPE(name)  static_cast<void>(0)
+#define TRADING_TRACE_FLUSH()      static_cast<void>(0)
+#define TRADING_TRACE_REPORT(os)   static_cast<void>(0)
+
+#endif
@@ -1,12 +1,16 @@
 #pragma once
 
-#include <cstdint>
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <fstream>
 #include <thread>
 
 #if defined(_MSC_VER)
     #include <intrin.h>
 #elif defined(__i386__) || defined(__x86_64__)
+    #include <cpuid.h>
     #include <x86intrin.h>
 #endif
 
@@ -23,45 +27,226 @@ inline std::uint64_t read_tsc() noexcept {
 #endif
 }
 
-// Calibrate TSC against steady_clock to get ns per tick.
-inline double tsc_ns_per_tick() {
-    static double value = [] {
-        using Clock = std::chrono::steady_clock;
-
-        const auto sleep_duration = std::chrono::milliseconds(200);
+// rdtscp: waits until all earlier instructions have executed (later ones may
+// still start early). `aux` gets IA32_TSC_AUX, which Linux sets to
+// (numa_node << 12) | cpu. Needs TscInfo::has_rdtscp (every x86-64 CPU of
+// the last ~15 years).
+inline std::uint64_t read_tscp(std::uint32_t& aux) noexcept {
+    unsigned int a = 0;
+    const std::uint64_t t = __rdtscp(&a);
+    aux = a;
+    return t;
+}
 
-        auto t0 = Clock::now();
-        auto c0 = read_tsc();
-        std::this_thread::sleep_for(sleep_duration);
-        auto t1 = Clock::now();
-        auto c1 = read_tsc();
+// Start of a measured region: lfence keeps rdtsc from running before earlier
+// instructions, the second one keeps the region from starting before rdtsc.
+inline std::uint64_t read_tsc_begin() noexcept {
+    _mm_lfence();
+    const std::uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+}
 
-        auto ns    = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count();
-        auto ticks = c1 - c0;
+// End of a measured region: rdtscp after the region's instructions, lfence
+// so that nothing after it starts before the read.
+inline std::uint64_t read_tsc_end() noexcept {
+    std::uint32_t aux = 0;
+    const std::uint64_t t = read_tscp(aux);
+    _mm_lfence();
+    return t;
+}
 
-        if (ticks == 0) {
-            return 0.0;
-        }
+struct CpuidRegs {
+    std::uint32_t eax = 0, ebx = 0, ecx = 0, edx = 0;
+};
 
-        // ns per tick
-        return static_cast<double>(ns) / static_cast<double>(ticks);
-    }();
+inline CpuidRegs cpuid(std::uint32_t leaf, std::uint32_t subleaf = 0) noexcept {
+    CpuidRegs r;
+#if defined(_MSC_VER)
+    int regs[4] = {};
+    __cpuidex(regs, static_cast<int>(leaf), static_cast<int>(subleaf));
+    r.eax = static_cast<std::uint32_t>(regs[0]);
+    r.ebx = static_cast<std::uint32_t>(regs[1]);
+    r.ecx = static_cast<std::uint32_t>(regs[2]);
+    r.edx = static_cast<std::uint32_t>(regs[3]);
+#else
+    unsigned int a = 0, b = 0, c = 0, d = 0;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    r = CpuidRegs{a, b, c, d};
+#endif
+    return r;
+}
 
-    return value;
+// steady_clock ns and TSC read as close together as possible: best of a few
+// tries, the TSC paired with the midpoint of the tightest clock bracket.
+inline void sample_clock_pair(std::int64_t& ns, std::uint64_t& tsc) noexcept {
+    using Clock = std::chrono::steady_clock;
+    std::int64_t best = -1;
+    for (int i = 0; i < 8; ++i) {
+        const auto          a = Clock::now();
+        const std::uint64_t c = read_tsc_begin();
+        const auto          b = Clock::now();
+        const std::int64_t  w = std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count();
+        if (best < 0 || w < best) {
+            best = w;
+            ns   = std::chrono::duration_cast<std::chrono::nanoseconds>(a.time_since_epoch()).count() + w / 2;
+            tsc  = c;
+        }
+    }
 }
 
 } // namespace bench::detail
 
 namespace bench {
 
+// Where TscInfo::ghz comes from, most trusted first.
+enum class TscSource : std::uint8_t {
+    Cpuid,      // CPUID 0x15: crystal clock * TSC / crystal ratio
+    Hypervisor, // CPUID 0x40000010 (VMware / KVM timing leaf)
+    Kernel,     // /sys/devices/system/cpu/cpu0/tsc_freq_khz
+    Calibrated, // median of several rounds against steady_clock
+};
+
+inline const char* to_string(TscSource s) noexcept {
+    switch (s) {
+        case TscSource::Cpuid:      return "cpuid";
+        case TscSource::Hypervisor: return "hypervisor";
+        case TscSource::Kernel:     return "kernel";
+        case TscSource::Calibrated: return "calibrated";
+    }
+    return "?";
+}
+
+struct TscInfo {
+    bool      invariant   = false; // CPUID 0x80000007 EDX[8]: constant rate, runs in C-states
+    bool      has_rdtscp  = false; // CPUID 0x80000001 EDX[27]
+    double    ghz         = 0.0;   // ticks per ns
+    double    ns_per_tick = 0.0;
+    TscSource source      = TscSource::Calibrated;
+};
+
+namespace detail {
+
+inline double tsc_ghz_from_cpuid(TscSource& source) {
+    const std::uint32_t max_leaf = cpuid(0).eax;
+    if (max_leaf >= 0x15) {
+        const CpuidRegs r = cpuid(0x15);
+        // eax / ebx: TSC / crystal ratio, ecx: crystal Hz (0 if not enumerated).
+        if (r.eax != 0 && r.ebx != 0 && r.ecx != 0) {
+            source = TscSource::Cpuid;
+            return static_cast<double>(r.ecx) * r.ebx / r.eax / 1e9;
+        }
+    }
+
+    const bool hypervisor = (cpuid(1).ecx >> 31) & 1u;
+    if (hypervisor && cpuid(0x40000000).eax >= 0x40000010) {
+        const std::uint32_t khz = cpuid(0x40000010).eax;
+        if (khz != 0) {
+            source = TscSource::Hypervisor;
+            return static_cast<double>(khz) / 1e6;
+        }
+    }
+    return 0.0;
+}
+
+inline double tsc_ghz_from_kernel() {
+    std::ifstream in("/sys/devices/system/cpu/cpu0/tsc_freq_khz");
+    double khz = 0.0;
+    if (in >> khz && khz > 0.0) {
+        return khz / 1e6;
+    }
+    return 0.0;
+}
+
+// Median of `rounds` measurements of `round` each: one preempted round does
+// not skew the result the way a single 200 ms sleep could.
+inline double tsc_ghz_calibrated(int rounds = 5,
+                                 std::chrono::milliseconds round = std::chrono::milliseconds(20)) {
+    std::array<double, 16> ghz{};
+    rounds = std::clamp(rounds, 1, static_cast<int>(ghz.size()));
+
+    int ok = 0;
+    for (int i = 0; i < rounds; ++i) {
+        std::int64_t  ns0 = 0, ns1 = 0;
+        std::uint64_t c0 = 0, c1 = 0;
+        sample_clock_pair(ns0, c0);
+        std::this_thread::sleep_for(round);
+        sample_clock_pair(ns1, c1);
+        if (ns1 > ns0 && c1 > c0) {
+            ghz[static_cast<std::size_t>(ok++)] = static_cast<double>(c1 - c0) / static_cast<double>(ns1 - ns0);
+        }
+    }
+    if (ok == 0) {
+        return 0.0;
+    }
+    std::sort(ghz.begin(), ghz.begin() + ok);
+    return ghz[static_cast<std::size_t>(ok / 2)];
+}
+
+inline TscInfo detect_tsc() {
+    TscInfo info;
+    const std::uint32_t max_ext = cpuid(0x80000000).eax;
+    if (max_ext >= 0x80000001) {
+        info.has_rdtscp = (cpuid(0x80000001).edx >> 27) & 1u;
+    }
+    if (max_ext >= 0x80000007) {
+        info.invariant = (cpuid(0x80000007).edx >> 8) & 1u;
+    }
+
+    info.ghz = tsc_ghz_from_cpuid(info.source);
+    if (info.ghz <= 0.0) {
+        info.ghz    = tsc_ghz_from_kernel();
+        info.source = TscSource::Kernel;
+    }
+    if (info.ghz <= 0.0) {
+        info.ghz    = tsc_ghz_calibrated();
+        info.source = TscSource::Calibrated;
+    }
+    info.ns_per_tick = info.ghz > 0.0 ? 1.0 / info.ghz : 0.0;
+    return info;
+}
+
+} // namespace detail
+
+// Detected once (first call may take ~100 ms if the frequency has to be
+// calibrated); thread-safe.
+inline const TscInfo& tsc_info() {
+    static const TscInfo info = detail::detect_tsc();
+    return info;
+}
+
+namespace detail {
+
+// ns per tick (kept for existing callers; see tsc_info()).
+inline double tsc_ns_per_tick() {
+    return tsc_info().ns_per_tick;
+}
+
+} // namespace detail
+
 // TSC-based timer compatible with benchmark.hpp timer interface.
+//
+// Comparing stamps taken on different cores is only meaningful when the TSC
+// is invariant (tsc_info().invariant) and the kernel keeps the cores in sync
+// (Linux "tsc" clocksource); otherwise use steady_clock.
 struct TscTimer {
     using time_point = std::uint64_t;
 
+    // Plain rdtsc: cheapest, may be reordered with nearby instructions.
     static time_point now() noexcept {
         return detail::read_tsc();
     }
 
+    // Fenced pair for short regions: start() / stop() keep the measured
+    // instructions between the two reads.
+    static time_point start() noexcept {
+        return detail::read_tsc_begin();
+    }
+
+    static time_point stop() noexcept {
+        return detail::read_tsc_end();
+    }
+
     static double to_ns(time_point start, time_point end) noexcept {
         std::uint64_t ticks = end - start;
         double ns_per_tick  = detail::tsc_ns_per_tick();
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+namespace utils {
+
+// One spin-wait iteration: PAUSE on x86 (lets the sibling hyperthread run and
+// avoids the memory-order pipeline flush on exit), YIELD on ARM.
+inline void cpu_relax() noexcept {
+#if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+// Wake-up channel between one side that waits for work (parks) and the side
+// that publishes it (notifies). While nobody is parked, notify() is a
+// seq_cst fence (MFENCE / a locked op on x86, tens of cycles) plus a relaxed
+// load of a line that stays shared: no RMW, no syscall. Cheap enough per
+// push for a blocking consumer; a spinning one does not need notify().
+class WakeSignal {
+public:
+    // Publisher: call after the data is published (e.g. after queue.push).
+    void notify() noexcept {
+        // Pairs with the fence in park(): either we see the sleeper or the
+        // sleeper's re-check sees our data.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers_.load(std::memory_order_relaxed) != 0) {
+            epoch_.fetch_add(1, std::memory_order_release);
+            epoch_.notify_all();
+        }
+    }
+
+    // Waiter: block until ready() is true. ready() is re-checked after
+    // registering as a sleeper, so a notify() racing with park() is not lost.
+    template <typename Ready>
+    void park(Ready&& ready) {
+        sleepers_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (;;) {
+            const std::uint32_t epoch = epoch_.load(std::memory_order_acquire);
+            if (ready()) {
+                break;
+            }
+            epoch_.wait(epoch, std::memory_order_acquire);
+        }
+        sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint32_t> epoch_{0};
+    std::atomic<std::uint32_t> sleepers_{0};
+};
+
+// How a thread waits when its queue is empty (consumer) or full (producer):
+//  - Spin:  busy-spin with cpu_relax(); lowest latency, burns the core;
+//  - Yield: spin, then std::this_thread::yield() (the old behaviour);
+//  - Park:  spin, then sleep in WakeSignal::park (futex via atomic::wait);
+//           lowest CPU use, wake-up costs a syscall on the publishing side.
+enum class WaitMode : std::uint8_t {
+    Spin,
+    Yield,
+    Park,
+};
+
+inline const char* to_string(WaitMode mode) noexcept {
+    switch (mode) {
+    case WaitMode::Spin:  return "spin";
+    case WaitMode::Yield: return "yield";
+    case WaitMode::Park:  return "park";
+    }
+    return "?";
+}
+
+inline bool parse_wait_mode(std::string_view s, WaitMode& out) noexcept {
+    if (s == "spin")  { out = WaitMode::Spin;  return true; }
+    if (s == "yield") { out = WaitMode::Yield; return true; }
+    if (s == "park")  { out = WaitMode::Park;  return true; }
+    return false;
+}
+
+// Per-thread wait state. Usage in a polling loop:
+//
+//     Waiter waiter(mode, &signal);
+//     for (;;) {
+//         if (queue.pop(x)) { waiter.reset(); ...; continue; }
+//         waiter.idle([&] { return !queue.empty(); });
+//     }
+//
+// and signal.notify() on the other side after each publish (only needed for
+// Park; a no-op check otherwise). Park without a signal degrades to Yield.
+class Waiter {
+public:
+    static constexpr std::uint32_t kDefaultSpins = 256;
+
+    explicit Waiter(WaitMode mode, WakeSignal* signal = nullptr,
+                    std::uint32_t spin_limit = kDefaultSpins) noexcept
+        : mode_(mode), signal_(signal), spin_limit_(spin_limit)
+    {}
+
+    WaitMode mode() const noexcept { return mode_; }
+
+    // Called after an unsuccessful poll; ready() tells whether work arrived.
+    template <typename Ready>
+    void idle(Ready&& ready) {
+        if (mode_ == WaitMode::Spin || spins_ < spin_limit_) {
+            ++spins_;
+            cpu_relax();
+            return;
+        }
+        if (mode_ == WaitMode::Park && signal_ != nullptr) {
+            signal_->park(ready);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    // Called after a successful poll: the next idle streak starts spinning.
+    void reset() noexcept { spins_ = 0; }
+
+private:
+    WaitMode      mode_;
+    WakeSignal*   signal_;
+    std::uint32_t spin_limit_;
+    std::uint32_t spins_{0};
+};
+
+} // namespace utils
@@ -0,0 +1,160 @@
+#include "trading/book_snapshot.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace trading {
+
+static_assert(sizeof(BookSnapshotHeader) == 64);
+static_assert(sizeof(SnapshotOrder) == 48);
+static_assert(sizeof(SnapshotIndexEntry) == 16);
+static_assert(sizeof(SnapshotLevel) == 32);
+static_assert(std::is_trivially_copyable_v<SnapshotOrder> && std::is_trivially_copyable_v<SnapshotIndexEntry> &&
+              std::is_trivially_copyable_v<SnapshotLevel>);
+
+namespace {
+
+constexpr std::size_t kSectionAlign = 8;
+
+std::size_t free_section_bytes(std::uint64_t free_count) noexcept
+{
+    const std::size_t bytes = static_cast<std::size_t>(free_count) * sizeof(std::uint32_t);
+    return (bytes + kSectionAlign - 1) & ~(kSectionAlign - 1);
+}
+
+bool write_all(std::FILE* file, const void* data, std::size_t size, std::size_t count)
+{
+    return count == 0 || std::fwrite(data, size, count, file) == count;
+}
+
+} // namespace
+
+// ---- write_book_snapshot ---------------------------------------------------
+
+void write_book_snapshot(const std::string& path, const BookSnapshotView& image)
+{
+    BookSnapshotHeader header;
+    std::memcpy(header.magic, BookSnapshotHeader::kMagic, sizeof(header.magic));
+    header.next_id     = image.next_id;
+    header.order_count = image.orders.size();
+    header.free_count  = image.free_slots.size();
+    header.bid_levels  = static_cast<std::uint32_t>(image.bids.size());
+    header.ask_levels  = static_cast<std::uint32_t>(image.asks.size());
+    header.index_count = image.index.size();
+
+    const std::string tmp  = path + ".tmp";
+    std::FILE*        file = std::fopen(tmp.c_str(), "wb");
+    if (!file)
+        throw std::runtime_error("write_book_snapshot: cannot open " + tmp);
+
+    static constexpr std::uint8_t kPad[kSectionAlign] = {};
+    const std::size_t pad = free_section_bytes(header.free_count) - image.free_slots.size_bytes();
+
+    bool ok = write_all(file, &header, sizeof(header), 1) &&
+              write_all(file, image.orders.data(), sizeof(SnapshotOrder), image.orders.size()) &&
+              write_all(file, image.free_slots.data(), sizeof(std::uint32_t), image.free_slots.size()) &&
+              write_all(file, kPad, 1, pad) &&
+              write_all(file, image.index.data(), sizeof(SnapshotIndexEntry), image.index.size()) &&
+              write_all(file, image.bids.data(), sizeof(SnapshotLevel), image.bids.size()) &&
+              write_all(file, image.asks.data(), sizeof(SnapshotLevel), image.asks.size());
+    ok = (std::fclose(file) == 0) && ok;
+
+    if (!ok || std::rename(tmp.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tmp.c_str());
+        throw std::runtime_error("write_book_snapshot: write failed: " + path);
+    }
+}
+
+// ---- MappedBookSnapshot ----------------------------------------------------
+
+MappedBookSnapshot::MappedBookSnapshot(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("MappedBookSnapshot: cannot open " + path);
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(BookSnapshotHeader))
+    {
+        ::close(fd);
+        throw std::runtime_error("MappedBookSnapshot: not a book snapshot: " + path);
+    }
+
+    length_ = static_cast<std::size_t>(st.st_size);
+    data_   = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps the file referenced
+    if (data_ == MAP_FAILED)
+    {
+        data_ = nullptr;
+        throw std::runtime_error("MappedBookSnapshot: mmap failed: " + path);
+    }
+    // Advice values are not flags: one call each.
+    ::madvise(data_, length_, MADV_SEQUENTIAL);
+    ::madvise(data_, length_, MADV_WILLNEED);
+
+    std::memcpy(&header_, data_, sizeof(header_));
+
+    // Counts come from the file: bound each one by the body size before
+    // multiplying, so the sum below cannot overflow.
+    const std::uint64_t body   = length_ - sizeof(BookSnapshotHeader);
+    const bool          sane   = header_.order_count <= body / sizeof(SnapshotOrder) &&
+                                 header_.free_count <= body / sizeof(std::uint32_t) &&
+                                 header_.index_count <= body / sizeof(SnapshotIndexEntry);
+    const std::uint64_t needed = !sane ? 0
+                                       : header_.order_count * sizeof(SnapshotOrder) +
+                                             free_section_bytes(header_.free_count) +
+                                             header_.index_count * sizeof(SnapshotIndexEntry) +
+                                             (std::uint64_t{header_.bid_levels} + header_.ask_levels) *
+                                                 sizeof(SnapshotLevel);
+
+    const char* error = nullptr;
+    if (std::memcmp(header_.magic, BookSnapshotHeader::kMagic, sizeof(header_.magic)) != 0)
+        error = "bad magic";
+    else if (header_.version != BookSnapshotHeader::kVersion)
+        error = "unsupported version";
+    else if (header_.endian != BookSnapshotHeader::kEndianMark)
+        error = "foreign byte order";
+    else if (header_.header_size != sizeof(BookSnapshotHeader) || header_.order_size != sizeof(SnapshotOrder) ||
+             header_.level_size != sizeof(SnapshotLevel))
+        error = "unexpected header / record size";
+    else if (!sane || needed > body)
+        error = "truncated file";
+
+    if (error)
+    {
+        ::munmap(data_, length_);
+        data_ = nullptr;
+        throw std::runtime_error(std::string("MappedBookSnapshot: ") + error + ": " + path);
+    }
+
+    // Page-aligned mapping, 64-byte header, 8-byte aligned sections.
+    const char* p = static_cast<const char*>(data_) + sizeof(BookSnapshotHeader);
+    const auto  n = [](std::uint64_t v) { return static_cast<std::size_t>(v); };
+
+    view_.next_id = header_.next_id;
+    view_.orders  = {reinterpret_cast<const SnapshotOrder*>(p), n(header_.order_count)};
+    p += n(header_.order_count) * sizeof(SnapshotOrder);
+    view_.free_slots = {reinterpret_cast<const std::uint32_t*>(p), n(header_.free_count)};
+    p += free_section_bytes(header_.free_count);
+    view_.index = {reinterpret_cast<const SnapshotIndexEntry*>(p), n(header_.index_count)};
+    p += n(header_.index_count) * sizeof(SnapshotIndexEntry);
+    view_.bids = {reinterpret_cast<const SnapshotLevel*>(p), n(header_.bid_levels)};
+    p += n(header_.bid_levels) * sizeof(SnapshotLevel);
+    view_.asks = {reinterpret_cast<const SnapshotLevel*>(p), n(header_.ask_levels)};
+}
+
+MappedBookSnapshot::~MappedBookSnapshot()
+{
+    if (data_)
+        ::munmap(data_, length_);
+}
+
+} // namespace trading
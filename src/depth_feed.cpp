@@ -0,0 +1,74 @@
+#include "trading/depth_feed.hpp"
+
+namespace trading {
+
+DepthFeed::DepthFeed(std::size_t levels)
+    : levels_(levels)
+{
+    for (std::size_t s = 0; s < 2; ++s)
+    {
+        prev_[s].resize(levels_);
+        cur_[s].resize(levels_);
+    }
+    // Worst case per side: N levels left the top N and N new ones entered.
+    changes_.reserve(4 * levels_);
+}
+
+std::span<const LevelInfo> DepthFeed::snapshot(Side side) const noexcept
+{
+    const std::size_t s = side == Side::Buy ? 0 : 1;
+    return std::span<const LevelInfo>(prev_[s].data(), prev_count_[s]);
+}
+
+void DepthFeed::reset() noexcept
+{
+    prev_count_ = {};
+    changes_.clear();
+}
+
+// Both lists are sorted best first: one merge pass per side.
+std::span<const DepthChange> DepthFeed::commit() noexcept
+{
+    changes_.clear();
+    for (std::size_t s = 0; s < 2; ++s)
+    {
+        const Side        side  = kSides[s];
+        const LevelInfo*  old   = prev_[s].data();
+        const LevelInfo*  now   = cur_[s].data();
+        const std::size_t n_old = prev_count_[s];
+        const std::size_t n_now = cur_count_[s];
+
+        const auto better = [side](Price a, Price b) { return side == Side::Buy ? a > b : a < b; };
+        const auto emit   = [&](Price price, Quantity qty, std::uint32_t orders) {
+            changes_.push_back(DepthChange{side, price, qty, orders});
+        };
+
+        std::size_t i = 0, j = 0;
+        while (i < n_old || j < n_now)
+        {
+            if (j == n_now || (i < n_old && better(old[i].price, now[j].price)))
+            {
+                emit(old[i].price, 0, 0); // gone from the top N
+                ++i;
+            }
+            else if (i == n_old || better(now[j].price, old[i].price))
+            {
+                emit(now[j].price, now[j].qty, now[j].orders); // new in the top N
+                ++j;
+            }
+            else
+            {
+                if (old[i].qty != now[j].qty || old[i].orders != now[j].orders)
+                    emit(now[j].price, now[j].qty, now[j].orders);
+                ++i;
+                ++j;
+            }
+        }
+
+        prev_[s].swap(cur_[s]);
+        prev_count_[s] = n_now;
+    }
+    return changes_;
+}
+
+} // namespace trading
@@ -0,0 +1,149 @@
+#include "trading/event_csv.hpp"
+
+#include <charconv>
+#include <system_error>
+
+namespace trading {
+
+namespace {
+
+bool is_space(char c) noexcept {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+std::string_view trim(std::string_view s) noexcept {
+    while (!s.empty() && is_space(s.front())) s.remove_prefix(1);
+    while (!s.empty() && is_space(s.back()))  s.remove_suffix(1);
+    return s;
+}
+
+// ASCII case-insensitive compare against an upper-case literal.
+bool iequals(std::string_view token, std::string_view upper) noexcept {
+    if (token.size() != upper.size()) return false;
+    for (std::size_t i = 0; i < token.size(); ++i) {
+        char c = token[i];
+        if (c >= 'a' && c <= 'z') c = static_cast<char>(c - 'a' + 'A');
+        if (c != upper[i]) return false;
+    }
+    return true;
+}
+
+// Comma-separated fields of one line, trimmed.
+class Fields {
+public:
+    explicit Fields(std::string_view line) noexcept : rest_(line) {}
+
+    bool next(std::string_view& field) noexcept {
+        if (done_) return false;
+        const auto comma = rest_.find(',');
+        if (comma == std::string_view::npos) {
+            field = trim(rest_);
+            done_ = true;
+        } else {
+            field = trim(rest_.substr(0, comma));
+            rest_.remove_prefix(comma + 1);
+        }
+        return true;
+    }
+
+private:
+    std::string_view rest_;
+    bool             done_ = false;
+};
+
+// Whole field must be the number.
+template <typename Int>
+bool to_int(std::string_view field, Int& out) noexcept {
+    const char* end = field.data() + field.size();
+    const auto [ptr, ec] = std::from_chars(field.data(), end, out);
+    return ec == std::errc{} && ptr == end && !field.empty();
+}
+
+bool parse_side(std::string_view token, Side& out) noexcept {
+    if (iequals(token, "BUY") || iequals(token, "B"))  { out = Side::Buy;  return true; }
+    if (iequals(token, "SELL") || iequals(token, "S")) { out = Side::Sell; return true; }
+    return false;
+}
+
+bool is_comment_or_empty(std::string_view line) noexcept {
+    const auto t = trim(line);
+    return t.empty() || t[0] == '#';
+}
+
+} // namespace
+
+CsvParseStatus parse_csv_event(std::string_view line, Event& out) noexcept {
+    if (is_comment_or_empty(line)) {
+        return CsvParseStatus::Skip;
+    }
+
+    Fields f(line);
+    std::string_view type;
+    if (!f.next(type)) return CsvParseStatus::Error;
+
+    Event ev;
+    std::string_view side, price, qty, id;
+
+    if (iequals(type, "ADD")) {
+        // Формат: ADD,side,price,qty,id
+        if (!f.next(side) || !f.next(price) || !f.next(qty) || !f.next(id) ||
+            !parse_side(side, ev.side) || !to_int(price, ev.price) ||
+            !to_int(qty, ev.qty) || !to_int(id, ev.id)) {
+            return CsvParseStatus::Error;
+        }
+        ev.type = EventType::Add;
+    } else if (iequals(type, "MKT") || iequals(type, "MARKET")) {
+        // Формат: MKT,side,qty
+        if (!f.next(side) || !f.next(qty) ||
+            !parse_side(side, ev.side) || !to_int(qty, ev.qty)) {
+            return CsvParseStatus::Error;
+        }
+        ev.type = EventType::Market;
+    } else if (iequals(type, "CANCEL") || iequals(type, "CXL")) {
+        // Формат: CANCEL,id
+        if (!f.next(id) || !to_int(id, ev.id)) {
+            return CsvParseStatus::Error;
+        }
+        ev.type = EventType::Cancel;
+    } else {
+        // неизвестный тип события
+        return CsvParseStatus::Error;
+    }
+
+    out = ev;
+    return CsvParseStatus::Ok;
+}
+
+CsvParseStatus parse_feed_event(std::string_view line, Event& out) noexcept {
+    if (trim(line).empty()) {
+        return CsvParseStatus::Skip;
+    }
+
+    Fields f(line);
+    std::string_view ts, type, side, price, qty;
+    if (!f.next(ts) || !f.next(type) || !f.next(side) || !f.next(price) || !f.next(qty)) {
+        return CsvParseStatus::Error;
+    }
+
+    Event ev;
+    if (type == "T") {
+        ev.type = EventType::Market;
+    } else if (type == "A") {
+        ev.type = EventType::Add;
+    } else if (type == "C") {
+        ev.type = EventType::Cancel;
+    } else {
+        return CsvParseStatus::Error;
+    }
+    ev.side = (!side.empty() && (side[0] == 'B' || side[0] == 'b')) ? Side::Buy : Side::Sell;
+
+    if (!to_int(ts, ev.ts_ns) || !to_int(price, ev.price) || !to_int(qty, ev.qty)) {
+        return CsvParseStatus::Error;
+    }
+    ev.id = 0;
+
+    out = ev;
+    return CsvParseStatus::Ok;
+}
+
+} // namespace trading
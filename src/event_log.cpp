@@ -0,0 +1,197 @@
+#include "trading/event_log.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace trading {
+
+// The zero-copy replay reinterprets records as Event: keep the layouts in sync.
+static_assert(sizeof(EventLogHeader) == 64);
+static_assert(sizeof(EventRecord) == 40);
+static_assert(std::is_trivially_copyable_v<Event> && std::is_standard_layout_v<Event>);
+static_assert(sizeof(Event) == sizeof(EventRecord));
+static_assert(sizeof(EventType) == sizeof(EventRecord::type));
+static_assert(sizeof(InstrumentId) == sizeof(EventRecord::instrument));
+static_assert(sizeof(Side) == sizeof(EventRecord::side));
+static_assert(offsetof(Event, type) == offsetof(EventRecord, type));
+static_assert(offsetof(Event, instrument) == offsetof(EventRecord, instrument));
+static_assert(offsetof(Event, side) == offsetof(EventRecord, side));
+static_assert(offsetof(Event, price) == offsetof(EventRecord, price));
+static_assert(offsetof(Event, qty) == offsetof(EventRecord, qty));
+static_assert(offsetof(Event, id) == offsetof(EventRecord, id));
+static_assert(offsetof(Event, ts_ns) == offsetof(EventRecord, ts_ns));
+
+namespace {
+
+constexpr std::size_t kWriteBufferRecords = 4096;
+
+bool has_magic(const EventLogHeader& header) noexcept
+{
+    return std::memcmp(header.magic, EventLogHeader::kMagic, sizeof(header.magic)) == 0;
+}
+
+} // namespace
+
+EventRecord to_record(const Event& ev) noexcept
+{
+    EventRecord rec;
+    rec.type       = static_cast<std::uint8_t>(ev.type);
+    rec.instrument = ev.instrument;
+    rec.side       = static_cast<std::int32_t>(ev.side);
+    rec.price      = ev.price;
+    rec.qty        = ev.qty;
+    rec.id         = ev.id;
+    rec.ts_ns      = ev.ts_ns;
+    return rec;
+}
+
+// ---- EventLogWriter --------------------------------------------------------
+
+EventLogWriter::EventLogWriter(const std::string& path, const EventLogScale& scale)
+    : path_(path)
+{
+    std::memcpy(header_.magic, EventLogHeader::kMagic, sizeof(header_.magic));
+    header_.price_decimals = scale.price_decimals;
+    header_.qty_decimals   = scale.qty_decimals;
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_)
+        throw std::runtime_error("EventLogWriter: cannot open " + path);
+
+    // Placeholder header; close() rewrites it with the final count.
+    if (std::fwrite(&header_, sizeof(header_), 1, file_) != 1)
+    {
+        std::fclose(file_);
+        file_ = nullptr;
+        throw std::runtime_error("EventLogWriter: write failed: " + path);
+    }
+    buffer_.reserve(kWriteBufferRecords);
+}
+
+EventLogWriter::~EventLogWriter()
+{
+    try
+    {
+        close();
+    }
+    catch (...)
+    {
+        // Destructor must not throw; call close() to see the error.
+    }
+}
+
+void EventLogWriter::write(const Event& ev)
+{
+    buffer_.push_back(to_record(ev));
+    ++count_;
+    if (buffer_.size() == kWriteBufferRecords)
+        flush();
+}
+
+void EventLogWriter::write(std::span<const Event> events)
+{
+    for (const Event& ev : events)
+        write(ev);
+}
+
+void EventLogWriter::flush()
+{
+    if (buffer_.empty())
+        return;
+    if (!file_ || std::fwrite(buffer_.data(), sizeof(EventRecord), buffer_.size(), file_) != buffer_.size())
+        throw std::runtime_error("EventLogWriter: write failed: " + path_);
+    buffer_.clear();
+}
+
+void EventLogWriter::close()
+{
+    if (!file_)
+        return;
+
+    flush();
+    header_.record_count = count_;
+    const bool ok = std::fseek(file_, 0, SEEK_SET) == 0 &&
+                    std::fwrite(&header_, sizeof(header_), 1, file_) == 1;
+    const bool closed = std::fclose(file_) == 0;
+    file_ = nullptr;
+    if (!ok || !closed)
+        throw std::runtime_error("EventLogWriter: write failed: " + path_);
+}
+
+// ---- MappedEventLog --------------------------------------------------------
+
+MappedEventLog::MappedEventLog(const std::string& path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("MappedEventLog: cannot open " + path);
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(EventLogHeader))
+    {
+        ::close(fd);
+        throw std::runtime_error("MappedEventLog: not an event log: " + path);
+    }
+
+    length_ = static_cast<std::size_t>(st.st_size);
+    data_   = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // the mapping keeps the file referenced
+    if (data_ == MAP_FAILED)
+    {
+        data_ = nullptr;
+        throw std::runtime_error("MappedEventLog: mmap failed: " + path);
+    }
+    // Advice values are not flags: one call each (read-ahead, and start it now).
+    ::madvise(data_, length_, MADV_SEQUENTIAL);
+    ::madvise(data_, length_, MADV_WILLNEED);
+
+    std::memcpy(&header_, data_, sizeof(header_));
+
+    const char* error = nullptr;
+    if (!has_magic(header_))
+        error = "bad magic";
+    else if (header_.version != EventLogHeader::kVersion)
+        error = "unsupported version";
+    else if (header_.endian != EventLogHeader::kEndianMark)
+        error = "foreign byte order";
+    else if (header_.header_size != sizeof(EventLogHeader) || header_.record_size != sizeof(EventRecord))
+        error = "unexpected header / record size";
+    else if (header_.record_count > (length_ - sizeof(EventLogHeader)) / sizeof(EventRecord))
+        error = "truncated file";
+
+    if (error)
+    {
+        ::munmap(data_, length_);
+        data_ = nullptr;
+        throw std::runtime_error(std::string("MappedEventLog: ") + error + ": " + path);
+    }
+
+    // Page-aligned mapping + 64-byte header: records are 8-byte aligned.
+    const auto* first = reinterpret_cast<const Event*>(static_cast<const char*>(data_) + sizeof(EventLogHeader));
+    events_ = std::span<const Event>(first, static_cast<std::size_t>(header_.record_count));
+}
+
+MappedEventLog::~MappedEventLog()
+{
+    if (data_)
+        ::munmap(data_, length_);
+}
+
+bool is_event_log(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    EventLogHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        return false;
+    return has_magic(header);
+}
+
+} // namespace trading
@@ -0,0 +1,276 @@
+// src/exchange/bybit_book_sync.cpp
+#include "exchange/bybit_book_sync.hpp"
+
+#include "utils/decimal.hpp"
+#include "utils/trace.hpp"
+
+#include <cmath>
+
+namespace exchange {
+
+namespace {
+
+trading::Price to_ticks(double v, unsigned decimals) noexcept
+{
+    return static_cast<trading::Price>(std::llround(v * static_cast<double>(utils::kPow10[decimals])));
+}
+
+} // namespace
+
+BybitBookSync::BybitBookSync(trading::LevelBook& book, std::size_t max_buffered_levels)
+    : book_(book)
+    , max_levels_(max_buffered_levels)
+{
+    levels_.reserve(max_levels_);
+    chain_.reserve(1024);
+}
+
+void BybitBookSync::on_book_begin(const BybitMessageHeader& h)
+{
+    applied_        = false;
+    frame_overflow_ = false;
+
+    if (h.kind == BybitMessageKind::OrderbookSnapshot) {
+        action_ = Action::Apply;
+        TRADING_TRACE_SCOPE("book.clear");
+        book_.clear();
+    } else {
+        action_ = classify_delta(h);
+    }
+    if (action_ == Action::Apply) {
+        // Live again only in on_book_end: a frame whose levels fail to parse
+        // halfway leaves the book half-updated and the stream resyncing.
+        state_ = BookSyncState::Resyncing;
+    } else if (action_ == Action::Buffer) {
+        start_buffering();
+    }
+}
+
+BybitBookSync::Action BybitBookSync::classify_delta(const BybitMessageHeader& h)
+{
+    if (state_ == BookSyncState::Live) {
+        if (!u_known_) {
+            // First delta after a REST snapshot with nothing buffered past it.
+            if (h.seq <= anchor_seq_) {
+                ++stats_.stale_deltas;
+                return Action::Drop;
+            }
+            return Action::Apply;
+        }
+        if (h.update_id <= last_u_) {
+            ++stats_.stale_deltas;
+            return Action::Drop;
+        }
+        if (h.update_id == last_u_ + 1) {
+            return Action::Apply;
+        }
+        ++stats_.gaps;
+        state_ = BookSyncState::Resyncing;
+        clear_buffer(); // the chain starts at this delta
+        return Action::Buffer;
+    }
+
+    // Waiting for a snapshot: extend the chain if contiguous.
+    if (!chain_.empty()) {
+        const std::uint64_t back = chain_.back().u;
+        if (h.update_id <= back) {
+            ++stats_.stale_deltas;
+            return Action::Drop;
+        }
+        if (h.update_id != back + 1) {
+            // Gap inside the buffer: whatever is buffered can no longer be
+            // replayed, restart the chain here.
+            ++stats_.gaps;
+            clear_buffer();
+        }
+    }
+    return Action::Buffer;
+}
+
+void BybitBookSync::start_buffering()
+{
+    // Drop levels of a frame that failed to parse (no on_book_end).
+    levels_.resize(chain_.empty() ? 0 : chain_.back().end);
+    frame_begin_ = levels_.size();
+}
+
+void BybitBookSync::on_level(const BybitLevel& lvl)
+{
+    if (action_ == Action::Apply) {
+        TRADING_TRACE_SCOPE("book.set_level");
+        book_.set_level(lvl.side, lvl.price, lvl.qty);
+        return;
+    }
+    if (action_ != Action::Buffer || frame_overflow_) {
+        return;
+    }
+    if (levels_.size() == max_levels_) {
+        // Make room by discarding the oldest buffered delta (never the
+        // current one): the chain stays contiguous, only shorter.
+        if (chain_.empty()) {
+            frame_overflow_ = true; // one frame larger than the whole buffer
+            return;
+        }
+        drop_front(1);
+        ++stats_.buffer_overflows;
+    }
+    levels_.push_back(lvl);
+}
+
+void BybitBookSync::on_book_end(const BybitMessageHeader& h)
+{
+    switch (action_) {
+    case Action::Apply:
+        last_    = h;
+        applied_ = true;
+        last_u_  = h.update_id;
+        u_known_ = true;
+        state_   = BookSyncState::Live;
+        if (h.kind == BybitMessageKind::OrderbookSnapshot) {
+            ++stats_.snapshots;
+            min_snapshot_seq_ = 0;
+            replay(false, 0);
+        } else {
+            ++stats_.deltas;
+        }
+        break;
+
+    case Action::Buffer:
+        if (frame_overflow_) {
+            // Lost: older than everything buffered after it, but with the
+            // chain empty a REST snapshot must still cover it.
+            ++stats_.buffer_overflows;
+            clear_buffer();
+            min_snapshot_seq_ = h.seq;
+            break;
+        }
+        {
+            Delta d;
+            d.u      = h.update_id;
+            d.seq    = h.seq;
+            d.begin  = frame_begin_;
+            d.end    = levels_.size();
+            d.ts_ms  = h.ts_ms;
+            d.cts_ms = h.cts_ms;
+            chain_.push_back(d);
+            ++stats_.buffered;
+        }
+        break;
+
+    case Action::Drop:
+        break;
+    }
+    action_ = Action::Drop;
+}
+
+bool BybitBookSync::apply_snapshot(const OrderBookSnapshot& snap, const BybitScale& scale)
+{
+    if (state_ == BookSyncState::Live) {
+        return false; // a WS snapshot got there first
+    }
+    const auto seq = static_cast<std::uint64_t>(snap.seq);
+    if (seq < min_snapshot_seq_ || (!chain_.empty() && seq < chain_.front().seq)) {
+        ++stats_.stale_snapshots; // misses a lost frame / updates before the chain front
+        return false;
+    }
+
+    {
+        TRADING_TRACE_SCOPE("book.clear");
+        book_.clear();
+    }
+    for (const auto& lvl : snap.bids) {
+        book_.set_level(trading::Side::Buy, to_ticks(lvl.price, scale.price_decimals),
+                        to_ticks(lvl.qty, scale.qty_decimals));
+    }
+    for (const auto& lvl : snap.asks) {
+        book_.set_level(trading::Side::Sell, to_ticks(lvl.price, scale.price_decimals),
+                        to_ticks(lvl.qty, scale.qty_decimals));
+    }
+    ++stats_.snapshots;
+
+    state_            = BookSyncState::Live;
+    u_known_          = false;
+    anchor_seq_       = seq;
+    min_snapshot_seq_ = 0;
+    replay(true, seq);
+    return state_ == BookSyncState::Live;
+}
+
+void BybitBookSync::replay(bool by_seq, std::uint64_t snapshot_seq)
+{
+    TRADING_TRACE_SCOPE("book.replay");
+    for (std::size_t i = 0; i < chain_.size(); ++i) {
+        const Delta& d = chain_[i];
+        if (by_seq ? d.seq <= snapshot_seq : d.u <= last_u_) {
+            if (by_seq) {
+                // Covered by the snapshot; the chain is contiguous, so the
+                // next delta must follow this one.
+                last_u_  = d.u;
+                u_known_ = true;
+            }
+            continue;
+        }
+        if (u_known_ && d.u != last_u_ + 1) {
+            // The snapshot misses deltas in front of the chain: still a gap.
+            ++stats_.gaps;
+            state_ = BookSyncState::Resyncing;
+            drop_front(i);
+            return;
+        }
+        apply_delta(d);
+    }
+    clear_buffer();
+}
+
+void BybitBookSync::apply_delta(const Delta& d)
+{
+    for (std::size_t i = d.begin; i < d.end; ++i) {
+        book_.set_level(levels_[i].side, levels_[i].price, levels_[i].qty);
+    }
+    last_u_  = d.u;
+    u_known_ = true;
+    applied_ = true;
+
+    last_.kind      = BybitMessageKind::OrderbookDelta;
+    last_.update_id = d.u;
+    last_.seq       = d.seq;
+    last_.ts_ms     = d.ts_ms;
+    last_.cts_ms    = d.cts_ms;
+
+    ++stats_.deltas;
+    ++stats_.replayed;
+}
+
+void BybitBookSync::drop_front(std::size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+    const std::size_t shift = chain_[count - 1].end;
+    levels_.erase(levels_.begin(), levels_.begin() + static_cast<std::ptrdiff_t>(shift));
+    chain_.erase(chain_.begin(), chain_.begin() + static_cast<std::ptrdiff_t>(count));
+    for (Delta& d : chain_) {
+        d.begin -= shift;
+        d.end -= shift;
+    }
+    frame_begin_ -= shift;
+}
+
+void BybitBookSync::clear_buffer() noexcept
+{
+    levels_.clear();
+    chain_.clear();
+    frame_begin_ = 0;
+}
+
+void BybitBookSync::reset() noexcept
+{
+    state_            = BookSyncState::WaitingSnapshot;
+    action_           = Action::Drop;
+    u_known_          = false;
+    last_u_           = 0;
+    min_snapshot_seq_ = 0;
+    clear_buffer();
+}
+
+} // namespace exchange
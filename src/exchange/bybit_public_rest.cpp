@@ -17,10 +17,11 @@ exchange::OrderBookSnapshot parse_spot_orderbook_snapshot_json(const nlohmann::j
 
     const auto& result = j.at("result");
 
-    snap.symbol = result.value("s", symbol_fallback);
-    snap.seq    = result.value("seq", 0LL);
-    snap.ts_ms  = result.value("ts", 0LL);
-    snap.cts_ms = result.value("cts", 0LL);
+    snap.symbol    = result.value("s", symbol_fallback);
+    snap.update_id = result.value("u", 0LL);
+    snap.seq       = result.value("seq", 0LL);
+    snap.ts_ms     = result.value("ts", 0LL);
+    snap.cts_ms    = result.value("cts", 0LL);
 
     if (result.contains("b")) {
         for (const auto& lvl : result.at("b")) {
@@ -45,21 +46,24 @@ exchange::OrderBookSnapshot parse_spot_orderbook_snapshot_json(const nlohmann::j
     return snap;
 }
 
+// /v5/market/orderbook?category=spot&symbol=BTCUSDT&limit=50
+std::string orderbook_query(const std::string& symbol, int limit) {
+    return "category=spot&symbol=" + symbol + "&limit=" + std::to_string(limit);
+}
+
 } // namespace
 
 namespace exchange {
 
 BybitPublicRest::BybitPublicRest(std::string base_url)
-    : base_url_(std::move(base_url)) {}
+    : http_(std::move(base_url)) {}
 
-std::string BybitPublicRest::get_server_time_raw() const {
-    utils::HttpClient client(base_url_);
-    return client.get("/v5/market/time");
+std::string BybitPublicRest::get_server_time_raw() {
+    return http_.get("/v5/market/time");
 }
 
-std::int64_t BybitPublicRest::get_server_time_ms() const {
-    utils::HttpClient client(base_url_);
-    auto body = client.get("/v5/market/time");
+std::int64_t BybitPublicRest::get_server_time_ms() {
+    const std::string& body = http_.get("/v5/market/time");
     auto j = json::parse(body);
 
     if (j.value("retCode", -1) != 0) {
@@ -70,11 +74,9 @@ std::int64_t BybitPublicRest::get_server_time_ms() const {
     return j.value("time", 0LL);
 }
 
-Ticker BybitPublicRest::get_spot_ticker(const std::string& symbol) const {
-    utils::HttpClient client(base_url_);
-
+Ticker BybitPublicRest::get_spot_ticker(const std::string& symbol) {
     std::string query = "category=spot&symbol=" + symbol;
-    auto body = client.get("/v5/market/tickers", query);
+    const std::string& body = http_.get("/v5/market/tickers", query);
     auto j = json::parse(body);
 
     if (j.value("retCode", -1) != 0) {
@@ -99,15 +101,9 @@ Ticker BybitPublicRest::get_spot_ticker(const std::string& symbol) const {
 }
 
 OrderBookSnapshot BybitPublicRest::get_spot_orderbook_snapshot(const std::string& symbol,
-                                                               int                 limit) const {
-    utils::HttpClient client(base_url_);
-
-    // /v5/market/orderbook?category=spot&symbol=BTCUSDT&limit=50 
-    std::string query = "category=spot&symbol=" + symbol +
-                        "&limit=" + std::to_string(limit);
-
-    auto body = client.get("/v5/market/orderbook", query);
-    auto j    = json::parse(body);
+                                                               int                 limit) {
+    const std::string& body = http_.get("/v5/market/orderbook", orderbook_query(symbol, limit));
+    auto j = json::parse(body);
 
     if (j.value("retCode", -1) != 0) {
         throw std::runtime_error("Bybit get_spot_orderbook_snapshot error: " + j.dump());
@@ -116,4 +112,30 @@ OrderBookSnapshot BybitPublicRest::get_spot_orderbook_snapshot(const std::string
     return parse_spot_orderbook_snapshot_json(j, symbol);
 }
 
+std::vector<OrderBookSnapshot> BybitPublicRest::get_spot_orderbook_snapshots(const std::vector<std::string>& symbols,
+                                                                             int limit,
+                                                                             std::size_t max_parallel) {
+    std::vector<utils::HttpRequest> requests;
+    requests.reserve(symbols.size());
+    for (const auto& symbol : symbols) {
+        requests.push_back(utils::HttpRequest{"/v5/market/orderbook", orderbook_query(symbol, limit)});
+    }
+
+    auto results = http_.get_many(requests, max_parallel);
+
+    std::vector<OrderBookSnapshot> snaps;
+    snaps.reserve(symbols.size());
+    for (std::size_t i = 0; i < symbols.size(); ++i) {
+        if (!results[i].ok()) {
+            throw std::runtime_error("Bybit orderbook snapshot " + symbols[i] + ": " + results[i].error);
+        }
+        auto j = json::parse(results[i].body);
+        if (j.value("retCode", -1) != 0) {
+            throw std::runtime_error("Bybit get_spot_orderbook_snapshots error: " + j.dump());
+        }
+        snaps.push_back(parse_spot_orderbook_snapshot_json(j, symbols[i]));
+    }
+    return snaps;
+}
+
 } // namespace exchange
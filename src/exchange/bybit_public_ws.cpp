@@ -1,19 +1,31 @@
 // src/exchange/bybit_public_ws.cpp
 #include "exchange/bybit_public_ws.hpp"
+#include "exchange/bybit_topic_router.hpp"
 
 #include <boost/beast/core.hpp>
 #include <boost/beast/websocket.hpp>
 #include <boost/beast/ssl.hpp>
 #include <boost/asio/connect.hpp>
+#include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/ssl/error.hpp>
 #include <boost/asio/ssl/stream.hpp>
+#include <boost/asio/steady_timer.hpp>
 
 #include <nlohmann/json.hpp>
 
+#include "utils/spsc_queue_v2.hpp"
+#include "utils/trace.hpp"
+
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
+#include <stdexcept>
+#include <thread>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace exchange {
@@ -27,6 +39,22 @@ using     tcp   = net::ip::tcp;
 
 using json = nlohmann::json;
 
+std::vector<std::string> bybit_subscribe_messages(const std::vector<std::string>& topics,
+                                                  std::size_t max_args)
+{
+    max_args = std::max<std::size_t>(max_args, 1);
+    std::vector<std::string> out;
+    for (std::size_t i = 0; i < topics.size(); i += max_args) {
+        const auto first = topics.begin() + static_cast<std::ptrdiff_t>(i);
+        const auto last  = topics.begin() + static_cast<std::ptrdiff_t>(std::min(i + max_args, topics.size()));
+        json sub_msg;
+        sub_msg["op"]   = "subscribe";
+        sub_msg["args"] = std::vector<std::string>(first, last);
+        out.push_back(sub_msg.dump());
+    }
+    return out;
+}
+
 BybitPublicWs::BybitPublicWs(std::string host,
                              std::string port,
                              std::string path)
@@ -36,9 +64,33 @@ BybitPublicWs::BybitPublicWs(std::string host,
 {
 }
 
+BybitPublicWs::~BybitPublicWs()
+{
+    stop();
+}
+
 void BybitPublicWs::run(const std::vector<std::string>& channels,
                         const MessageHandler& handler,
                         int max_messages)
+{
+    run_raw(channels,
+            [&](std::string_view text) {
+                json msg;
+                try {
+                    msg = json::parse(text);
+                } catch (const std::exception& ex) {
+                    std::cerr << "[BybitPublicWs] JSON parse error: " << ex.what()
+                              << " | raw=" << text << "\n";
+                    return;
+                }
+                handler(msg);
+            },
+            max_messages);
+}
+
+void BybitPublicWs::run_raw(const std::vector<std::string>& channels,
+                            const RawMessageHandler& handler,
+                            int max_messages)
 {
     try {
         net::io_context ioc;
@@ -76,13 +128,10 @@ void BybitPublicWs::run(const std::vector<std::string>& channels,
 
         ws.handshake(host_, path_);
 
-        // Формируем subscribe сообщение
-        json sub_msg;
-        sub_msg["op"]   = "subscribe";
-        sub_msg["args"] = channels;
-
-        auto sub_str = sub_msg.dump();
-        ws.write(net::buffer(sub_str));
+        // Формируем subscribe сообщения (не больше 10 топиков в каждом)
+        for (const std::string& sub_str : bybit_subscribe_messages(channels)) {
+            ws.write(net::buffer(sub_str));
+        }
 
         // Чтение сообщений
         beast::flat_buffer buffer;
@@ -99,19 +148,9 @@ void BybitPublicWs::run(const std::vector<std::string>& channels,
                 throw beast::system_error{ec};
             }
 
+            // flat_buffer is contiguous: hand out a view, no copy.
             auto data = buffer.data();
-            std::string text{static_cast<const char*>(data.data()), data.size()};
-
-            json msg;
-            try {
-                msg = json::parse(text);
-            } catch (const std::exception& ex) {
-                std::cerr << "[BybitPublicWs] JSON parse error: " << ex.what()
-                          << " | raw=" << text << "\n";
-                continue;
-            }
-
-            handler(msg);
+            handler(std::string_view{static_cast<const char*>(data.data()), data.size()});
 
             ++count;
             if (max_messages >= 0 && static_cast<int>(count) >= max_messages) {
@@ -129,4 +168,424 @@ void BybitPublicWs::run(const std::vector<std::string>& channels,
     }
 }
 
+// ============================================================================
+// Persistent session
+// ============================================================================
+
+namespace {
+
+std::int64_t steady_now_ns() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+struct BybitPublicWs::Session {
+    using WsStream = websocket::stream<beast::ssl_stream<beast::tcp_stream>>;
+
+    struct Slot {
+        std::string   data;
+        std::int64_t  recv_ns    = 0;
+        std::uint64_t seq        = 0;
+        std::uint32_t connection = 0;
+    };
+
+    Session(const std::string& host, const std::string& port, const std::string& path,
+            const std::vector<std::string>& channels, const WsSessionOptions& options)
+        : host_(host)
+        , port_(port)
+        , path_(path)
+        , opts_(options)
+        , backoff_(options.backoff_initial)
+        , slots_(std::max<std::size_t>(options.queue_frames, 1))
+        , ready_(slots_.size())
+        , free_(slots_.size())
+    {
+        subscribe_msgs_ = bybit_subscribe_messages(channels);
+
+        ctx_.set_default_verify_paths();
+        ctx_.set_verify_mode(ssl::verify_peer);
+        // Client-side session cache so reconnects can resume TLS.
+        ::SSL_CTX_set_session_cache_mode(ctx_.native_handle(), SSL_SESS_CACHE_CLIENT);
+
+        for (std::uint32_t i = 0; i < slots_.size(); ++i) {
+            slots_[i].data.reserve(opts_.frame_reserve);
+            free_.push(i);
+        }
+    }
+
+    ~Session()
+    {
+        if (tls_session_) {
+            ::SSL_SESSION_free(tls_session_);
+        }
+    }
+
+    // ---- I/O thread ------------------------------------------------------
+
+    void connect()
+    {
+        if (stopping_) {
+            return;
+        }
+        if (!endpoints_.empty()) {
+            open();
+            return;
+        }
+        resolver_.async_resolve(host_, port_,
+            [this](beast::error_code ec, tcp::resolver::results_type results) {
+                if (stopping_) {
+                    return;
+                }
+                if (ec) {
+                    fail(ec, "resolve");
+                    return;
+                }
+                endpoints_ = std::move(results);
+                open();
+            });
+    }
+
+    void open()
+    {
+        retired_.reset();
+        ws_ = std::make_unique<WsStream>(ioc_, ctx_);
+        const std::uint32_t gen = ++generation_;
+        ++opened_;
+
+        auto& tls = ws_->next_layer();
+        if (! ::SSL_set_tlsext_host_name(tls.native_handle(), host_.c_str())) {
+            fail(beast::error_code{static_cast<int>(::ERR_get_error()), net::error::get_ssl_category()},
+                 "sni");
+            return;
+        }
+        if (tls_session_) {
+            ::SSL_set_session(tls.native_handle(), tls_session_);
+        }
+
+        beast::get_lowest_layer(*ws_).expires_after(std::chrono::seconds(10));
+        beast::get_lowest_layer(*ws_).async_connect(endpoints_,
+            [this, gen](beast::error_code ec, const tcp::endpoint&) {
+                if (stale(gen)) {
+                    return;
+                }
+                if (ec) {
+                    endpoints_ = {}; // re-resolve next time, the address may have moved
+                    fail(ec, "connect");
+                    return;
+                }
+                on_tcp(gen);
+            });
+    }
+
+    void on_tcp(std::uint32_t gen)
+    {
+        ws_->next_layer().async_handshake(ssl::stream_base::client,
+            [this, gen](beast::error_code ec) {
+                if (stale(gen)) {
+                    return;
+                }
+                if (ec) {
+                    fail(ec, "tls");
+                    return;
+                }
+                if (SSL_SESSION* sess = ::SSL_get1_session(ws_->next_layer().native_handle())) {
+                    if (tls_session_) {
+                        ::SSL_SESSION_free(tls_session_);
+                    }
+                    tls_session_ = sess;
+                }
+                on_tls(gen);
+            });
+    }
+
+    void on_tls(std::uint32_t gen)
+    {
+        // The websocket stream manages its own timeouts from here on.
+        beast::get_lowest_layer(*ws_).expires_never();
+        ws_->set_option(websocket::stream_base::timeout::suggested(beast::role_type::client));
+        ws_->set_option(websocket::stream_base::decorator(
+            [this](websocket::request_type& req) {
+                req.set(http::field::host, host_);
+                req.set(http::field::user_agent, std::string("cpp-trading-core/bybit-ws"));
+            }));
+
+        ws_->async_handshake(host_, path_, [this, gen](beast::error_code ec) {
+            if (stale(gen)) {
+                return;
+            }
+            if (ec) {
+                fail(ec, "ws handshake");
+                return;
+            }
+            subscribe(gen, 0);
+        });
+    }
+
+    // Write subscribe_msgs_[i..] one after another (one write in flight on a
+    // websocket stream), then start the heartbeat and the reads.
+    void subscribe(std::uint32_t gen, std::size_t i)
+    {
+        if (i == subscribe_msgs_.size()) {
+            connects_.fetch_add(1, std::memory_order_relaxed);
+            backoff_ = opts_.backoff_initial;
+            schedule_heartbeat(gen);
+            read(gen);
+            return;
+        }
+        ws_->async_write(net::buffer(subscribe_msgs_[i]),
+            [this, gen, i](beast::error_code wec, std::size_t) {
+                if (stale(gen)) {
+                    return;
+                }
+                if (wec) {
+                    fail(wec, "subscribe");
+                    return;
+                }
+                subscribe(gen, i + 1);
+            });
+    }
+
+    void read(std::uint32_t gen)
+    {
+        buffer_.clear();
+        ws_->async_read(buffer_, [this, gen](beast::error_code ec, std::size_t) {
+            if (stale(gen)) {
+                return;
+            }
+            if (ec) {
+                fail(ec, "read");
+                return;
+            }
+            enqueue();
+            read(gen);
+        });
+    }
+
+    void enqueue()
+    {
+        TRADING_TRACE_SCOPE("ws.enqueue");
+        const std::int64_t recv_ns = steady_now_ns();
+        const std::uint64_t seq    = next_seq_++;
+        frames_received_.fetch_add(1, std::memory_order_relaxed);
+
+        std::uint32_t idx = 0;
+        if (!free_.pop(idx)) {
+            frames_dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        Slot& slot = slots_[idx];
+        auto  data = buffer_.data(); // flat_buffer: one contiguous block
+        slot.data.assign(static_cast<const char*>(data.data()), data.size());
+        slot.recv_ns    = recv_ns;
+        slot.seq        = seq;
+        slot.connection = opened_ - 1;
+        ready_.push(idx); // cannot fail: ready_ has room for every slot
+    }
+
+    void schedule_heartbeat(std::uint32_t gen)
+    {
+        if (opts_.heartbeat.count() <= 0) {
+            return;
+        }
+        heartbeat_timer_.expires_after(opts_.heartbeat);
+        heartbeat_timer_.async_wait([this, gen](beast::error_code ec) {
+            if (ec || stale(gen)) {
+                return;
+            }
+            // Bybit drops idle connections: application-level ping.
+            ws_->async_write(net::buffer(ping_msg_), [this, gen](beast::error_code wec, std::size_t) {
+                if (stale(gen)) {
+                    return;
+                }
+                if (wec) {
+                    fail(wec, "ping");
+                    return;
+                }
+                schedule_heartbeat(gen);
+            });
+        });
+    }
+
+    void fail(beast::error_code ec, const char* what)
+    {
+        if (stopping_) {
+            return;
+        }
+        connect_failures_.fetch_add(1, std::memory_order_relaxed);
+        std::cerr << "[BybitPublicWs] " << what << ": " << ec.message()
+                  << ", reconnect in " << backoff_.count() << " ms\n";
+
+        retire();
+
+        reconnect_timer_.expires_after(backoff_);
+        backoff_ = std::min(backoff_ * 2, opts_.backoff_max);
+        reconnect_timer_.async_wait([this](beast::error_code tec) {
+            if (!tec) {
+                connect();
+            }
+        });
+    }
+
+    // Cancel everything on the current stream; its handlers see a new
+    // generation and return. The stream object is destroyed on the next
+    // open(), after those handlers have run.
+    void retire()
+    {
+        ++generation_;
+        heartbeat_timer_.cancel();
+        if (ws_) {
+            beast::error_code ignored;
+            beast::get_lowest_layer(*ws_).socket().close(ignored);
+            retired_ = std::move(ws_);
+        }
+    }
+
+    bool stale(std::uint32_t gen) const noexcept { return stopping_ || gen != generation_; }
+
+    void shutdown()
+    {
+        stopping_ = true;
+        resolver_.cancel();
+        reconnect_timer_.cancel();
+        retire();
+    }
+
+    // ---- configuration / state (I/O thread) --------------------------------
+    std::string              host_;
+    std::string              port_;
+    std::string              path_;
+    std::vector<std::string> subscribe_msgs_; // kBybitMaxSubscribeArgs topics each
+    std::string              ping_msg_ = R"({"op":"ping"})";
+    WsSessionOptions         opts_;
+
+    net::io_context             ioc_;
+    ssl::context                ctx_{ssl::context::tls_client};
+    tcp::resolver               resolver_{ioc_};
+    tcp::resolver::results_type endpoints_;
+    std::unique_ptr<WsStream>   ws_;
+    std::unique_ptr<WsStream>   retired_;
+    beast::flat_buffer          buffer_;
+    net::steady_timer           reconnect_timer_{ioc_};
+    net::steady_timer           heartbeat_timer_{ioc_};
+    std::chrono::milliseconds   backoff_;
+    SSL_SESSION*                tls_session_ = nullptr;
+    std::uint32_t               generation_ = 0; // bumped on open and retire
+    std::uint32_t               opened_     = 0; // streams opened so far
+    std::uint64_t               next_seq_   = 0;
+    bool                        stopping_   = false;
+
+    // ---- frame hand-off (I/O thread -> book thread) -------------------------
+    std::vector<Slot>               slots_;
+    utils::SpscQueueV2<std::uint32_t> ready_; // filled slots, I/O -> book
+    utils::SpscQueueV2<std::uint32_t> free_;  // drained slots, book -> I/O
+
+    std::atomic<std::uint64_t> frames_received_{0};
+    std::atomic<std::uint64_t> frames_dropped_{0};
+    std::atomic<std::uint64_t> connects_{0};
+    std::atomic<std::uint64_t> connect_failures_{0};
+    std::atomic<bool>          running_{false};
+
+    std::thread io_thread_;
+};
+
+void BybitPublicWs::start(const std::vector<std::string>& channels, WsSessionOptions options)
+{
+    if (running()) {
+        throw std::logic_error("BybitPublicWs::start: session already running");
+    }
+    stop(); // join a finished I/O thread of a previous session
+
+    session_ = std::make_unique<Session>(host_, port_, path_, channels, options);
+    Session& s = *session_;
+
+    s.running_.store(true, std::memory_order_release);
+    s.io_thread_ = std::thread([&s] {
+        net::post(s.ioc_, [&s] { s.connect(); });
+        try {
+            s.ioc_.run();
+        } catch (const std::exception& ex) {
+            std::cerr << "[BybitPublicWs] I/O thread exception: " << ex.what() << "\n";
+        }
+        s.running_.store(false, std::memory_order_release);
+    });
+}
+
+void BybitPublicWs::stop()
+{
+    if (!session_ || !session_->io_thread_.joinable()) {
+        return;
+    }
+    Session& s = *session_;
+    net::post(s.ioc_, [&s] { s.shutdown(); });
+    s.io_thread_.join();
+}
+
+void BybitPublicWs::start(const BybitTopicRouter& router, WsSessionOptions options)
+{
+    start(router.topics(), options);
+}
+
+bool BybitPublicWs::running() const noexcept
+{
+    return session_ && session_->running_.load(std::memory_order_acquire);
+}
+
+template <typename Fn>
+std::size_t BybitPublicWs::drain(Fn&& fn, std::size_t max_frames)
+{
+    if (!session_) {
+        return 0;
+    }
+    Session& s = *session_;
+
+    std::size_t   n   = 0;
+    std::uint32_t idx = 0;
+    while (n < max_frames && s.ready_.pop(idx)) {
+        const Session::Slot& slot = s.slots_[idx];
+
+        WsFrameInfo info;
+        info.seq                 = slot.seq;
+        info.recv_ns             = slot.recv_ns;
+        info.dispatch_latency_ns = steady_now_ns() - slot.recv_ns;
+        info.connection          = slot.connection;
+
+        {
+            TRADING_TRACE_SCOPE("ws.handler");
+            fn(std::string_view{slot.data}, info);
+        }
+
+        s.free_.push(idx); // cannot fail: free_ has room for every slot
+        ++n;
+    }
+    return n;
+}
+
+std::size_t BybitPublicWs::poll(const FrameHandler& handler, std::size_t max_frames)
+{
+    return drain(handler, max_frames);
+}
+
+std::size_t BybitPublicWs::poll(BybitTopicRouter& router, std::size_t max_frames)
+{
+    return drain([&router](std::string_view frame, const WsFrameInfo& info) { router.dispatch(frame, info); },
+                 max_frames);
+}
+
+WsSessionStats BybitPublicWs::stats() const noexcept
+{
+    WsSessionStats st;
+    if (session_) {
+        st.frames_received  = session_->frames_received_.load(std::memory_order_relaxed);
+        st.frames_dropped   = session_->frames_dropped_.load(std::memory_order_relaxed);
+        st.connects         = session_->connects_.load(std::memory_order_relaxed);
+        st.connect_failures = session_->connect_failures_.load(std::memory_order_relaxed);
+    }
+    return st;
+}
+
 } // namespace exchange
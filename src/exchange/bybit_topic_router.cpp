@@ -0,0 +1,69 @@
+// src/exchange/bybit_topic_router.cpp
+#include "exchange/bybit_topic_router.hpp"
+
+#include "exchange/bybit_ws_parser.hpp"
+
+#include <utility>
+
+namespace exchange {
+
+std::string_view find_bybit_topic(std::string_view frame) noexcept
+{
+    detail::JsonCursor c(frame.data(), frame.data() + frame.size());
+    if (!c.consume('{')) {
+        return {};
+    }
+    do {
+        std::string_view key;
+        if (!c.string(key) || !c.consume(':')) {
+            return {};
+        }
+        if (key == "topic") {
+            std::string_view topic;
+            return c.string(topic) ? topic : std::string_view{};
+        }
+        if (!c.skip_value()) {
+            return {};
+        }
+    } while (c.consume(','));
+    return {};
+}
+
+TopicId BybitTopicRouter::add(std::string topic, Handler handler)
+{
+    if (auto it = ids_.find(topic); it != ids_.end()) {
+        handlers_[it->second] = std::move(handler);
+        return it->second;
+    }
+    const auto id = static_cast<TopicId>(topics_.size());
+    ids_.emplace(topic, id);
+    topics_.push_back(std::move(topic));
+    handlers_.push_back(std::move(handler));
+    return id;
+}
+
+TopicId BybitTopicRouter::find(std::string_view topic) const noexcept
+{
+    const auto it = ids_.find(topic);
+    return it == ids_.end() ? kNoTopic : it->second;
+}
+
+TopicId BybitTopicRouter::dispatch(std::string_view frame, const WsFrameInfo& info)
+{
+    const std::string_view topic = find_bybit_topic(frame);
+    const TopicId          id    = topic.empty() ? kNoTopic : find(topic);
+
+    if (id != kNoTopic && handlers_[id]) {
+        ++stats_.routed;
+        handlers_[id](id, frame, info);
+        return id;
+    }
+
+    ++(topic.empty() ? stats_.control : stats_.unrouted);
+    if (fallback_) {
+        fallback_(frame, info);
+    }
+    return kNoTopic;
+}
+
+} // namespace exchange
@@ -0,0 +1,9 @@
+#include "trading/level_book.hpp"
+
+namespace trading {
+
+// Explicit instantiations for the level containers shipped with the library.
+template class BasicLevelBook<MapLevels>;
+template class BasicLevelBook<LadderLevels>;
+
+} // namespace trading
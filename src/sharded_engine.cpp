@@ -0,0 +1,11 @@
+#include "trading/sharded_engine.hpp"
+
+namespace trading {
+
+// Explicit instantiations for the book types shipped with the library.
+template class BasicShardedEngine<OrderBookWith<MapLevels, FlatIdIndex>>;
+template class BasicShardedEngine<OrderBookWith<MapLevels, DirectIdIndex>>;
+template class BasicShardedEngine<OrderBookWith<LadderLevels, FlatIdIndex>>;
+template class BasicShardedEngine<OrderBookWith<LadderLevels, DirectIdIndex>>;
+
+} // namespace trading
@@ -2,6 +2,7 @@
 #include "utils/http_client.hpp"
 
 #include <curl/curl.h>
+#include <algorithm>
 #include <stdexcept>
 #include <sstream>
 #include <utility>
@@ -24,38 +25,116 @@ size_t write_cb(char* ptr, size_t size, size_t nmemb, void* userdata) {
     return size * nmemb;
 }
 
+std::string http_error(long http_code, const std::string& url) {
+    std::ostringstream oss;
+    oss << "HTTP " << http_code << " for URL " << url;
+    return oss.str();
+}
+
+// A pooled easy handle with its own buffers (get_many).
+struct Transfer {
+    CURL*       curl = nullptr;
+    std::string url;
+    std::string body;
+    std::size_t request = 0; // index into the batch
+};
+
 } // namespace
 
-HttpClient::HttpClient(std::string base_url)
-    : base_url_(std::move(base_url)) {
-    static CurlGlobal curl_global_guard;
-}
+struct HttpClient::Impl {
+    std::string base_url;
+    CURLSH*     share = nullptr;
+    CURL*       easy  = nullptr; // get()
+    std::string url;             // get(): reused buffers
+    std::string body;
+    CURLM*      multi = nullptr; // get_many(), created on first use
+    std::vector<Transfer> pool;
+
+    explicit Impl(std::string base)
+        : base_url(std::move(base)) {
+        share = curl_share_init();
+        if (!share) {
+            throw std::runtime_error("curl_share_init() failed");
+        }
+        // Only this client's thread uses the handles: no share lock callbacks.
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+        easy = make_handle();
+    }
 
-std::string HttpClient::get(const std::string& path, const std::string& query) {
-    CURL* curl = curl_easy_init();
-    if (!curl) {
-        throw std::runtime_error("curl_easy_init() failed");
+    ~Impl() {
+        for (Transfer& t : pool) {
+            curl_easy_cleanup(t.curl);
+        }
+        if (multi) {
+            curl_multi_cleanup(multi);
+        }
+        if (easy) {
+            curl_easy_cleanup(easy);
+        }
+        curl_share_cleanup(share); // after every handle using it
     }
 
-    std::string url = base_url_;
-    url += path;
-    if (!query.empty()) {
-        url += "?";
-        url += query;
+    // Easy handle with the options every request uses.
+    CURL* make_handle() {
+        CURL* curl = curl_easy_init();
+        if (!curl) {
+            throw std::runtime_error("curl_easy_init() failed");
+        }
+        curl_easy_setopt(curl, CURLOPT_SHARE, share);
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_cb);
+        curl_easy_setopt(curl, CURLOPT_USERAGENT, "cpp-trading-core/0.1");
+        curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);
+        curl_easy_setopt(curl, CURLOPT_TCP_NODELAY, 1L);
+        curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+        curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+        // Ждём уже открытое HTTP/2-соединение вместо нового на каждый запрос.
+        curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+        return curl;
     }
 
-    std::string response;
+    void make_url(std::string& out, const std::string& path, const std::string& query) const {
+        out.assign(base_url);
+        out += path;
+        if (!query.empty()) {
+            out += "?";
+            out += query;
+        }
+    }
+
+    void start(Transfer& t, std::size_t index, const HttpRequest& req) {
+        make_url(t.url, req.path, req.query);
+        t.body.clear();
+        t.request = index;
+        curl_easy_setopt(t.curl, CURLOPT_URL, t.url.c_str());
+        curl_easy_setopt(t.curl, CURLOPT_WRITEDATA, &t.body);
+        curl_easy_setopt(t.curl, CURLOPT_PRIVATE, &t);
+        curl_multi_add_handle(multi, t.curl);
+    }
+};
+
+HttpClient::HttpClient(std::string base_url) {
+    static CurlGlobal curl_global_guard;
+    impl_ = std::make_unique<Impl>(std::move(base_url));
+}
+
+HttpClient::~HttpClient() = default;
+
+HttpClient::HttpClient(HttpClient&&) noexcept            = default;
+HttpClient& HttpClient::operator=(HttpClient&&) noexcept = default;
 
-    curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, write_cb);
-    curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
-    curl_easy_setopt(curl, CURLOPT_USERAGENT, "cpp-trading-core/0.1");
-    curl_easy_setopt(curl, CURLOPT_TIMEOUT, 5L);
+const std::string& HttpClient::get(const std::string& path, const std::string& query) {
+    Impl& d = *impl_;
+    d.make_url(d.url, path, query);
+    d.body.clear(); // capacity stays
 
-    CURLcode res = curl_easy_perform(curl);
+    curl_easy_setopt(d.easy, CURLOPT_URL, d.url.c_str());
+    curl_easy_setopt(d.easy, CURLOPT_WRITEDATA, &d.body);
+
+    CURLcode res = curl_easy_perform(d.easy);
     long http_code = 0;
-    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &http_code);
-    curl_easy_cleanup(curl);
+    curl_easy_getinfo(d.easy, CURLINFO_RESPONSE_CODE, &http_code);
 
     if (res != CURLE_OK) {
         throw std::runtime_error(
@@ -63,12 +142,85 @@ std::string HttpClient::get(const std::string& path, const std::string& query) {
             curl_easy_strerror(res));
     }
     if (http_code != 200) {
-        std::ostringstream oss;
-        oss << "HTTP " << http_code << " for URL " << url;
-        throw std::runtime_error(oss.str());
+        throw std::runtime_error(http_error(http_code, d.url));
+    }
+
+    return d.body;
+}
+
+std::vector<HttpResult> HttpClient::get_many(std::span<const HttpRequest> requests,
+                                             std::size_t max_parallel) {
+    Impl& d = *impl_;
+    std::vector<HttpResult> results(requests.size());
+    if (requests.empty()) {
+        return results;
+    }
+
+    if (!d.multi) {
+        d.multi = curl_multi_init();
+        if (!d.multi) {
+            throw std::runtime_error("curl_multi_init() failed");
+        }
+        curl_multi_setopt(d.multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+    }
+
+    const std::size_t parallel = std::clamp<std::size_t>(max_parallel, 1, requests.size());
+    while (d.pool.size() < parallel) {
+        Transfer t;
+        t.curl = d.make_handle();
+        d.pool.push_back(std::move(t));
+    }
+
+    std::size_t next = 0;
+    for (std::size_t i = 0; i < parallel; ++i) {
+        d.start(d.pool[i], next, requests[next]);
+        ++next;
     }
 
-    return response;
+    std::size_t done    = 0;
+    int         running = 0;
+    while (done < requests.size()) {
+        const CURLMcode mc = curl_multi_perform(d.multi, &running);
+        if (mc != CURLM_OK) {
+            // Leave the pool reusable: detach whatever is still in flight.
+            for (Transfer& t : d.pool) {
+                curl_multi_remove_handle(d.multi, t.curl);
+            }
+            throw std::runtime_error(std::string("curl_multi_perform() failed: ") + curl_multi_strerror(mc));
+        }
+
+        int      queued = 0;
+        CURLMsg* msg    = nullptr;
+        while ((msg = curl_multi_info_read(d.multi, &queued)) != nullptr) {
+            if (msg->msg != CURLMSG_DONE) {
+                continue;
+            }
+            Transfer* t = nullptr;
+            curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &t);
+            const CURLcode res = msg->data.result;
+            curl_multi_remove_handle(d.multi, t->curl);
+
+            HttpResult& r = results[t->request];
+            curl_easy_getinfo(t->curl, CURLINFO_RESPONSE_CODE, &r.status);
+            if (res != CURLE_OK) {
+                r.error = std::string("curl: ") + curl_easy_strerror(res);
+            } else if (r.status != 200) {
+                r.error = http_error(r.status, t->url);
+            }
+            r.body.assign(t->body); // copy: the pooled buffer keeps its capacity
+            ++done;
+
+            if (next < requests.size()) {
+                d.start(*t, next, requests[next]);
+                ++next;
+            }
+        }
+
+        if (done < requests.size()) {
+            curl_multi_poll(d.multi, nullptr, 0, 100, nullptr);
+        }
+    }
+    return results;
 }
 
 } // namespace utils
@@ -0,0 +1,96 @@
+#include "utils/line_reader.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace utils {
+
+LineReader::LineReader(const std::string& path, std::size_t block_size)
+    : fd_(::open(path.c_str(), O_RDONLY)),
+      owns_fd_(true),
+      block_size_(block_size ? block_size : kDefaultBlockSize),
+      buffer_(block_size_)
+{
+    failed_ = fd_ < 0;
+    eof_    = failed_;
+}
+
+LineReader::LineReader(int fd, std::size_t block_size)
+    : fd_(fd),
+      block_size_(block_size ? block_size : kDefaultBlockSize),
+      buffer_(block_size_)
+{
+    failed_ = fd_ < 0;
+    eof_    = failed_;
+}
+
+LineReader::~LineReader() {
+    if (owns_fd_ && fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+// Move the partial line to the front (growing the buffer if the line fills
+// it) and append one read(2) worth of data. Returns false at EOF / error.
+bool LineReader::fill() {
+    if (eof_) {
+        return false;
+    }
+    if (begin_ > 0) {
+        std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+        end_  -= begin_;
+        begin_ = 0;
+    }
+    if (end_ == buffer_.size()) {
+        buffer_.resize(buffer_.size() * 2);
+    }
+
+    for (;;) {
+        const ssize_t n = ::read(fd_, buffer_.data() + end_, buffer_.size() - end_);
+        if (n > 0) {
+            end_        += static_cast<std::size_t>(n);
+            bytes_read_ += static_cast<std::size_t>(n);
+            return true;
+        }
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        failed_ = n < 0;
+        eof_    = true;
+        return false;
+    }
+}
+
+bool LineReader::next(std::string_view& line) {
+    std::size_t scanned = begin_;
+    for (;;) {
+        const void* nl = std::memchr(buffer_.data() + scanned, '\n', end_ - scanned);
+        if (nl) {
+            const auto pos = static_cast<std::size_t>(static_cast<const char*>(nl) - buffer_.data());
+            line   = std::string_view(buffer_.data() + begin_, pos - begin_);
+            begin_ = pos + 1;
+            ++line_no_;
+            return true;
+        }
+        // fill() moves the partial line to offset 0: resume the scan there.
+        const std::size_t partial = end_ - begin_;
+        if (!fill()) {
+            break;
+        }
+        scanned = partial;
+    }
+
+    if (begin_ < end_) {
+        // Last line without '\n'.
+        line   = std::string_view(buffer_.data() + begin_, end_ - begin_);
+        begin_ = end_;
+        ++line_no_;
+        return true;
+    }
+    return false;
+}
+
+} // namespace utils
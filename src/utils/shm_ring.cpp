@@ -0,0 +1,213 @@
+#include "utils/shm_ring.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kCapacityOffset = 16;
+constexpr std::size_t kClosedOffset   = 24;
+constexpr std::size_t kWriteOffset    = 64;
+constexpr std::size_t kReadOffset     = 128;
+constexpr std::size_t kRecordAlign    = 8;
+constexpr std::size_t kLengthBytes    = sizeof(std::uint32_t);
+
+std::uint64_t record_bytes(std::size_t payload) noexcept {
+    return (kLengthBytes + payload + kRecordAlign - 1) & ~(kRecordAlign - 1);
+}
+
+std::string shm_path(const std::string& name) {
+    return name.empty() || name[0] != '/' ? "/" + name : name;
+}
+
+[[noreturn]] void fail(const char* what, const std::string& name) {
+    throw std::runtime_error(std::string("ShmRing: ") + what + ": " + name);
+}
+
+} // namespace
+
+static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free &&
+              std::atomic_ref<std::uint32_t>::is_always_lock_free);
+
+ShmRing::ShmRing(const std::string& name, std::size_t capacity)
+    : name_(name),
+      owner_(true),
+      capacity_(std::bit_ceil(std::max<std::size_t>(capacity, 4096)))
+{
+    const std::string path = shm_path(name_);
+    ::shm_unlink(path.c_str()); // stale ring of a previous run
+    const int fd = ::shm_open(path.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        fail("cannot create", name_);
+    }
+    length_ = kHeaderSize + capacity_;
+    if (::ftruncate(fd, static_cast<off_t>(length_)) != 0) {
+        ::close(fd);
+        ::shm_unlink(path.c_str());
+        fail("cannot size", name_);
+    }
+    void* p = ::mmap(nullptr, length_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        ::shm_unlink(path.c_str());
+        fail("mmap failed", name_);
+    }
+    base_ = static_cast<char*>(p);
+
+    // ftruncate zero-fills: positions and closed start at 0. The magic goes
+    // last, so a producer polling for the ring never sees a partial header.
+    const std::uint32_t version     = kVersion;
+    const std::uint32_t header_size = kHeaderSize;
+    const std::uint64_t cap         = capacity_;
+    std::memcpy(base_ + 8, &version, sizeof(version));
+    std::memcpy(base_ + 12, &header_size, sizeof(header_size));
+    std::memcpy(base_ + kCapacityOffset, &cap, sizeof(cap));
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(base_, kMagic, sizeof(kMagic));
+}
+
+ShmRing::ShmRing(const std::string& name)
+    : name_(name)
+{
+    const int fd = ::shm_open(shm_path(name_).c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        fail("cannot open", name_);
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < kHeaderSize) {
+        ::close(fd);
+        fail("not a ring", name_);
+    }
+    length_ = static_cast<std::size_t>(st.st_size);
+    void* p = ::mmap(nullptr, length_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        fail("mmap failed", name_);
+    }
+    base_ = static_cast<char*>(p);
+
+    std::uint32_t version     = 0;
+    std::uint32_t header_size = 0;
+    std::uint64_t cap         = 0;
+    std::memcpy(&version, base_ + 8, sizeof(version));
+    std::memcpy(&header_size, base_ + 12, sizeof(header_size));
+    std::memcpy(&cap, base_ + kCapacityOffset, sizeof(cap));
+
+    const char* error = nullptr;
+    if (std::memcmp(base_, kMagic, sizeof(kMagic)) != 0) {
+        error = "bad magic";
+    } else if (version != kVersion || header_size != kHeaderSize) {
+        error = "unsupported version";
+    } else if (!std::has_single_bit(cap) || kHeaderSize + cap > length_) {
+        error = "bad capacity";
+    }
+    if (error) {
+        ::munmap(base_, length_);
+        base_ = nullptr;
+        fail(error, name_);
+    }
+    capacity_ = static_cast<std::size_t>(cap);
+    local_    = std::atomic_ref<std::uint64_t>(write_pos()).load(std::memory_order_relaxed);
+    cached_   = std::atomic_ref<std::uint64_t>(read_pos()).load(std::memory_order_acquire);
+}
+
+ShmRing::~ShmRing() {
+    if (base_) {
+        ::munmap(base_, length_);
+    }
+    if (owner_) {
+        ::shm_unlink(shm_path(name_).c_str());
+    }
+}
+
+std::uint64_t& ShmRing::write_pos() const noexcept {
+    return *reinterpret_cast<std::uint64_t*>(base_ + kWriteOffset);
+}
+
+std::uint64_t& ShmRing::read_pos() const noexcept {
+    return *reinterpret_cast<std::uint64_t*>(base_ + kReadOffset);
+}
+
+std::uint32_t& ShmRing::closed_flag() const noexcept {
+    return *reinterpret_cast<std::uint32_t*>(base_ + kClosedOffset);
+}
+
+bool ShmRing::try_push(std::string_view msg) noexcept {
+    const std::uint64_t need = record_bytes(msg.size());
+    if (need > capacity_ / 2) {
+        return false; // with a wrap mark in front it might never fit
+    }
+    const std::size_t   mask = capacity_ - 1;
+    const std::size_t   off  = static_cast<std::size_t>(local_) & mask;
+    const std::uint64_t tail = capacity_ - off;           // contiguous bytes up to the end
+    const std::uint64_t room = tail < need ? tail + need : need;
+
+    if (local_ + room - cached_ > capacity_) {
+        cached_ = std::atomic_ref<std::uint64_t>(read_pos()).load(std::memory_order_acquire);
+        if (local_ + room - cached_ > capacity_) {
+            return false;
+        }
+    }
+
+    std::uint64_t pos = local_;
+    if (tail < need) {
+        std::memcpy(data() + off, &kWrapMark, kLengthBytes);
+        pos += tail;
+    }
+    char* rec = data() + (static_cast<std::size_t>(pos) & mask);
+    const auto len = static_cast<std::uint32_t>(msg.size());
+    std::memcpy(rec, &len, kLengthBytes);
+    std::memcpy(rec + kLengthBytes, msg.data(), msg.size());
+
+    local_ = pos + need;
+    std::atomic_ref<std::uint64_t>(write_pos()).store(local_, std::memory_order_release);
+    return true;
+}
+
+void ShmRing::close() noexcept {
+    std::atomic_ref<std::uint32_t>(closed_flag()).store(1, std::memory_order_release);
+}
+
+bool ShmRing::front(std::string_view& msg) noexcept {
+    const std::size_t mask = capacity_ - 1;
+    for (;;) {
+        if (local_ == cached_) {
+            cached_ = std::atomic_ref<std::uint64_t>(write_pos()).load(std::memory_order_acquire);
+            if (local_ == cached_) {
+                return false;
+            }
+        }
+        const std::size_t off = static_cast<std::size_t>(local_) & mask;
+        std::uint32_t     len = 0;
+        std::memcpy(&len, data() + off, kLengthBytes);
+        if (len == kWrapMark) {
+            local_ += capacity_ - off; // skipped with the record after it
+            continue;
+        }
+        msg      = std::string_view(data() + off + kLengthBytes, len);
+        pending_ = record_bytes(len);
+        return true;
+    }
+}
+
+void ShmRing::pop() noexcept {
+    local_ += pending_;
+    pending_ = 0;
+    std::atomic_ref<std::uint64_t>(read_pos()).store(local_, std::memory_order_release);
+}
+
+bool ShmRing::closed() const noexcept {
+    return std::atomic_ref<std::uint32_t>(closed_flag()).load(std::memory_order_acquire) != 0;
+}
+
+} // namespace utils
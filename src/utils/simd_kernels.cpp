@@ -0,0 +1,286 @@
+#include "utils/simd_kernels.hpp"
+
+#include "utils/decimal.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define TRADING_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace utils::simd {
+
+namespace {
+
+// ---- Scalar -------------------------------------------------------------------
+
+std::int64_t scalar_sum_qty(const std::int64_t* qtys, std::size_t n) noexcept {
+    std::uint64_t sum = 0; // wraps like the vector lanes instead of overflowing
+    for (std::size_t i = 0; i < n; ++i) {
+        sum += static_cast<std::uint64_t>(qtys[i]);
+    }
+    return static_cast<std::int64_t>(sum);
+}
+
+std::size_t scalar_compact_levels(std::int64_t* prices, std::int64_t* qtys, std::size_t n) noexcept {
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (qtys[i] > 0) {
+            prices[k] = prices[i];
+            qtys[k]   = qtys[i];
+            ++k;
+        }
+    }
+    return k;
+}
+
+constexpr Kernels kScalar{scalar_sum_qty, scalar_compact_levels, utils::parse_fixed_point};
+
+#ifdef TRADING_SIMD_X86
+
+#define TRADING_TARGET_AVX2 __attribute__((target("avx2")))
+
+// ---- AVX2 ---------------------------------------------------------------------
+
+TRADING_TARGET_AVX2 std::int64_t avx2_sum_qty(const std::int64_t* qtys, std::size_t n) noexcept {
+    // Two accumulators: the adds of consecutive loads do not wait on each other.
+    __m256i     acc0 = _mm256_setzero_si256();
+    __m256i     acc1 = _mm256_setzero_si256();
+    std::size_t i    = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc0 = _mm256_add_epi64(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(qtys + i)));
+        acc1 = _mm256_add_epi64(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(qtys + i + 4)));
+    }
+    if (i + 4 <= n) {
+        acc0 = _mm256_add_epi64(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(qtys + i)));
+        i += 4;
+    }
+    acc0 = _mm256_add_epi64(acc0, acc1);
+
+    alignas(32) std::uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc0);
+    std::uint64_t sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; ++i) {
+        sum += static_cast<std::uint64_t>(qtys[i]);
+    }
+    return static_cast<std::int64_t>(sum);
+}
+
+// kCompactPerm[mask]: 32-bit lane indices that move the 64-bit lanes whose
+// mask bit is set to the front, in order.
+constexpr std::array<std::array<std::int32_t, 8>, 16> make_compact_perm() {
+    std::array<std::array<std::int32_t, 8>, 16> table{};
+    for (unsigned mask = 0; mask < 16; ++mask) {
+        unsigned out = 0;
+        for (unsigned lane = 0; lane < 4; ++lane) {
+            if ((mask >> lane) & 1u) {
+                table[mask][2 * out]     = static_cast<std::int32_t>(2 * lane);
+                table[mask][2 * out + 1] = static_cast<std::int32_t>(2 * lane + 1);
+                ++out;
+            }
+        }
+    }
+    return table;
+}
+
+alignas(32) constexpr std::array<std::array<std::int32_t, 8>, 16> kCompactPerm = make_compact_perm();
+
+TRADING_TARGET_AVX2 std::size_t avx2_compact_levels(std::int64_t* prices, std::int64_t* qtys,
+                                                    std::size_t n) noexcept {
+    // Four levels per step: full 4-lane stores at the output position are
+    // safe in place because it never runs ahead of the input.
+    const __m256i zero = _mm256_setzero_si256();
+    std::size_t   k    = 0;
+    std::size_t   i    = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256i q    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(qtys + i));
+        const __m256i p    = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prices + i));
+        const auto    mask = static_cast<unsigned>(
+            _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(q, zero))));
+        if (mask == 0xFu) {
+            if (k != i) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(qtys + k), q);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(prices + k), p);
+            }
+            k += 4;
+            continue;
+        }
+        const __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i*>(kCompactPerm[mask].data()));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(qtys + k), _mm256_permutevar8x32_epi32(q, perm));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(prices + k), _mm256_permutevar8x32_epi32(p, perm));
+        k += static_cast<std::size_t>(std::popcount(mask));
+    }
+    for (; i < n; ++i) {
+        if (qtys[i] > 0) {
+            prices[k] = prices[i];
+            qtys[k]   = qtys[i];
+            ++k;
+        }
+    }
+    return k;
+}
+
+// Fields of up to 16 characters (after the sign) are validated and converted
+// in one 16-byte register: digits are shifted right-aligned with the '.'
+// squeezed out, then combined pairwise 1 -> 2 -> 4 -> 8 digits with
+// multiply-adds. Longer fields, and the rare cases like "beyond 16 kept
+// digits", go to the scalar parser, which has the same contract.
+TRADING_TARGET_AVX2 bool avx2_parse_decimal(std::string_view s, unsigned decimals,
+                                            std::int64_t& out) noexcept {
+    const char* str = s.data();
+    std::size_t n   = s.size();
+    const bool  neg = n != 0 && str[0] == '-';
+    if (neg) {
+        ++str;
+        --n;
+    }
+    if (n == 0 || n > 16 || decimals > kMaxDecimals) {
+        return utils::parse_fixed_point(s, decimals, out);
+    }
+
+    // Gather the field into a register without reading past it: two
+    // overlapping fixed-size loads from its start and its end (single mov
+    // instructions), lanes >= n left zero.
+    std::uint64_t lo = 0;
+    std::uint64_t hi = 0;
+    if (n >= 8) {
+        std::memcpy(&lo, str, 8);
+        if (n > 8) {
+            std::memcpy(&hi, str + n - 8, 8);
+            hi >>= (16 - n) * 8; // bytes [8, n) of the field
+        }
+    } else if (n >= 4) {
+        std::uint32_t head = 0;
+        std::uint32_t tail = 0;
+        std::memcpy(&head, str, 4);
+        std::memcpy(&tail, str + n - 4, 4);
+        lo = head | (std::uint64_t{tail} << ((n - 4) * 8)); // overlap ORs equal bytes
+    } else {
+        for (std::size_t i = 0; i < n; ++i) {
+            lo |= std::uint64_t{static_cast<unsigned char>(str[i])} << (i * 8);
+        }
+    }
+    const __m128i v = _mm_set_epi64x(static_cast<long long>(hi), static_cast<long long>(lo));
+
+    const __m128i  iota   = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const unsigned in_str = (1u << n) - 1u;
+    const unsigned dots   = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('.')))) & in_str;
+
+    // v - '0' outside [0, 9] (signed) is exactly "not a digit".
+    const __m128i  digits = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    const __m128i  bad    = _mm_or_si128(_mm_cmpgt_epi8(_mm_setzero_si128(), digits),
+                                         _mm_cmpgt_epi8(digits, _mm_set1_epi8(9)));
+    const unsigned bad_mask = static_cast<unsigned>(_mm_movemask_epi8(bad)) & in_str & ~dots;
+    if (bad_mask != 0 || (dots & (dots - 1)) != 0 || n == (dots != 0 ? 1u : 0u)) {
+        return false; // non-digit, two dots, or no digit at all
+    }
+
+    const unsigned dot       = dots != 0 ? static_cast<unsigned>(std::countr_zero(dots)) : static_cast<unsigned>(n);
+    const unsigned frac      = dots != 0 ? static_cast<unsigned>(n) - dot - 1 : 0;
+    const unsigned kept_frac = frac < decimals ? frac : decimals;
+    const unsigned keep      = dot + kept_frac; // digits that make the value, <= 16
+
+    // Lane j of the result takes digit t = j - (16 - keep) of the field
+    // without its '.', i.e. character t (+1 past the dot); t < 0 -> zero.
+    const __m128i t   = _mm_sub_epi8(iota, _mm_set1_epi8(static_cast<char>(16 - keep)));
+    const __m128i idx = _mm_sub_epi8(t, _mm_cmpgt_epi8(t, _mm_set1_epi8(static_cast<char>(dot - 1))));
+    const __m128i d   = _mm_shuffle_epi8(digits, idx);
+
+    const __m128i d2 = _mm_maddubs_epi16(d, _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1));
+    const __m128i d4 = _mm_madd_epi16(d2, _mm_setr_epi16(100, 1, 100, 1, 100, 1, 100, 1));
+    const __m128i d8 = _mm_madd_epi16(_mm_packus_epi32(d4, d4),
+                                      _mm_setr_epi16(10000, 1, 10000, 1, 10000, 1, 10000, 1));
+    std::uint64_t value = static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_cvtsi128_si32(d8))) * 100'000'000u +
+                          static_cast<std::uint32_t>(_mm_extract_epi32(d8, 1));
+
+    constexpr std::uint64_t kLimit = static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+
+    const auto scale = static_cast<std::uint64_t>(kPow10[decimals - kept_frac]);
+    if (value > kLimit / scale) {
+        return false;
+    }
+    value *= scale;
+
+    // Digits beyond the tick: only the first one rounds (half away from zero).
+    if (frac > decimals && str[dot + 1 + decimals] >= '5') {
+        if (value == kLimit) {
+            return false;
+        }
+        ++value;
+    }
+
+    out = neg ? -static_cast<std::int64_t>(value) : static_cast<std::int64_t>(value);
+    return true;
+}
+
+constexpr Kernels kAvx2{avx2_sum_qty, avx2_compact_levels, avx2_parse_decimal};
+
+bool cpu_has_avx2() noexcept {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif // TRADING_SIMD_X86
+
+std::atomic<const Kernels*>& active_slot() noexcept {
+    static std::atomic<const Kernels*> slot{kernels(detected())};
+    return slot;
+}
+
+} // namespace
+
+const char* name(Level level) noexcept {
+    switch (level) {
+    case Level::Scalar: return "scalar";
+    case Level::Avx2:   return "avx2";
+    }
+    return "?";
+}
+
+Level detected() noexcept {
+#ifdef TRADING_SIMD_X86
+    static const bool avx2 = cpu_has_avx2();
+    if (avx2) {
+        return Level::Avx2;
+    }
+#endif
+    return Level::Scalar;
+}
+
+const Kernels* kernels(Level level) noexcept {
+    switch (level) {
+    case Level::Scalar:
+        return &kScalar;
+    case Level::Avx2:
+#ifdef TRADING_SIMD_X86
+        return detected() == Level::Avx2 ? &kAvx2 : nullptr;
+#else
+        return nullptr;
+#endif
+    }
+    return nullptr;
+}
+
+Level active() noexcept {
+    return active_slot().load(std::memory_order_relaxed) == &kScalar ? Level::Scalar : Level::Avx2;
+}
+
+bool set_active(Level level) noexcept {
+    const Kernels* k = kernels(level);
+    if (!k) {
+        return false;
+    }
+    active_slot().store(k, std::memory_order_relaxed);
+    return true;
+}
+
+const Kernels& active_kernels() noexcept {
+    return *active_slot().load(std::memory_order_relaxed);
+}
+
+} // namespace utils::simd
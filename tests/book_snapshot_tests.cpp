@@ -0,0 +1,298 @@
+#include <gtest/gtest.h>
+
+#include "trading/book_snapshot.hpp"
+#include "trading/order_book.hpp"
+
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace trading;
+
+namespace {
+
+// Unique file under the temp directory, removed at scope exit.
+struct TempFile {
+    explicit TempFile(const std::string& name)
+        : path((std::filesystem::temp_directory_path() /
+                (name + "_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed())))
+                   .string()) {}
+    ~TempFile() { std::remove(path.c_str()); }
+
+    std::string path;
+};
+
+// Uncrossed random flow with reused ids [1, 400], so slots and ids recycle.
+std::vector<Event> random_flow(std::size_t n, unsigned seed) {
+    std::mt19937                    rng(seed);
+    std::uniform_int_distribution<> pct(0, 99), tick(0, 9), qty(1, 9), id(1, 400);
+    std::vector<Event>              events(n);
+    for (Event& ev : events) {
+        const int r = pct(rng);
+        ev.side     = pct(rng) < 50 ? Side::Buy : Side::Sell;
+        ev.qty      = qty(rng);
+        if (r < 60) {
+            ev.type  = EventType::Add;
+            ev.price = ev.side == Side::Buy ? 100 - tick(rng) : 101 + tick(rng);
+            ev.id    = pct(rng) < 10 ? 0 : static_cast<OrderId>(id(rng));
+        } else if (r < 90) {
+            ev.type = EventType::Cancel;
+            ev.id   = static_cast<OrderId>(id(rng));
+        } else {
+            ev.type = EventType::Market;
+        }
+    }
+    return events;
+}
+
+template <typename Book>
+std::vector<Trade> apply_collect(Book& book, std::span<const Event> events) {
+    std::vector<Trade> fills;
+    book.apply(events, [&](const Trade& tr) { fills.push_back(tr); });
+    return fills;
+}
+
+template <typename A, typename B>
+void expect_same_depth(const A& a, const B& b) {
+    std::array<LevelInfo, 32> da{}, db{};
+    for (Side side : {Side::Buy, Side::Sell}) {
+        const std::size_t na = a.depth(side, da.size(), da);
+        ASSERT_EQ(na, b.depth(side, db.size(), db));
+        for (std::size_t i = 0; i < na; ++i) {
+            EXPECT_EQ(da[i].price, db[i].price);
+            EXPECT_EQ(da[i].qty, db[i].qty);
+            EXPECT_EQ(da[i].orders, db[i].orders);
+        }
+    }
+}
+
+} // namespace
+
+template <typename Book>
+class BookSnapshotTest : public ::testing::Test {};
+
+using RestoredBookTypes = ::testing::Types<OrderBook, LadderOrderBook, OrderBookWith<LadderLevels, DirectIdIndex>>;
+TYPED_TEST_SUITE(BookSnapshotTest, RestoredBookTypes);
+
+// The restored book must continue exactly like the saved one: same fills
+// (FIFO order within levels), same generated ids, same depth.
+TYPED_TEST(BookSnapshotTest, RestoredBookContinuesLikeTheOriginal) {
+    TempFile file("book_snapshot_continue.img");
+    const auto head = random_flow(5000, 11);
+    const auto tail = random_flow(5000, 12);
+
+    OrderBook original;
+    original.apply(head);
+    original.save_snapshot(file.path);
+
+    TypeParam restored;
+    restored.add_limit_order(Side::Buy, 1, 1); // overwritten by the load
+    restored.load_snapshot(file.path);
+    expect_same_depth(original, restored);
+
+    EXPECT_EQ(apply_collect(original, tail).size(), apply_collect(restored, tail).size());
+    expect_same_depth(original, restored);
+    EXPECT_EQ(original.add_limit_order(Side::Buy, 50, 1), restored.add_limit_order(Side::Buy, 50, 1));
+
+    const auto fills_a = apply_collect(original, random_flow(2000, 13));
+    const auto fills_b = apply_collect(restored, random_flow(2000, 13));
+    ASSERT_EQ(fills_a.size(), fills_b.size());
+    for (std::size_t i = 0; i < fills_a.size(); ++i) {
+        EXPECT_EQ(fills_a[i].maker_id, fills_b[i].maker_id);
+        EXPECT_EQ(fills_a[i].price, fills_b[i].price);
+        EXPECT_EQ(fills_a[i].qty, fills_b[i].qty);
+    }
+}
+
+TEST(BookSnapshot, EmptyBookRoundTrips) {
+    TempFile file("book_snapshot_empty.img");
+    OrderBook empty;
+    empty.save_snapshot(file.path);
+
+    LadderOrderBook book;
+    book.add_limit_order(Side::Sell, 105, 3);
+    book.load_snapshot(file.path);
+    EXPECT_TRUE(book.empty());
+    EXPECT_EQ(book.add_limit_order(Side::Buy, 100, 1), 1u);
+}
+
+TEST(BookSnapshot, RejectsMalformedImagesAndKeepsTheBook) {
+    TempFile file("book_snapshot_bad.img");
+    OrderBook source;
+    source.add_limit_order(Side::Buy, 100, 5);
+    source.add_limit_order(Side::Sell, 105, 2);
+    source.save_snapshot(file.path);
+
+    std::vector<char> bytes(std::filesystem::file_size(file.path));
+    std::ifstream(file.path, std::ios::binary).read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    const auto write = [&](const std::vector<char>& image) {
+        std::ofstream(file.path, std::ios::binary | std::ios::trunc)
+            .write(image.data(), static_cast<std::streamsize>(image.size()));
+    };
+
+    OrderBook book;
+    book.add_limit_order(Side::Buy, 90, 7);
+
+    auto bad_magic = bytes;
+    bad_magic[0]   = 'X';
+    write(bad_magic);
+    EXPECT_THROW(book.load_snapshot(file.path), std::runtime_error);
+
+    write(std::vector<char>(bytes.begin(), bytes.end() - 8));
+    EXPECT_THROW(book.load_snapshot(file.path), std::runtime_error);
+
+    // Two slots, no free slots, two index entries, then the bid level:
+    // point its head past the slot array.
+    auto bad_level = bytes;
+    const std::size_t level_off =
+        sizeof(BookSnapshotHeader) + 2 * sizeof(SnapshotOrder) + 2 * sizeof(SnapshotIndexEntry);
+    SnapshotLevel level;
+    std::memcpy(&level, bad_level.data() + level_off, sizeof(level));
+    ASSERT_EQ(level.price, 100);
+    level.head = 7;
+    std::memcpy(bad_level.data() + level_off, &level, sizeof(level));
+    write(bad_level);
+    EXPECT_THROW(book.load_snapshot(file.path), std::runtime_error);
+
+    EXPECT_EQ(book.best_bid().price, 90);
+    EXPECT_EQ(book.best_bid().qty, 7);
+
+    write(bytes);
+    book.load_snapshot(file.path);
+    EXPECT_EQ(book.best_bid().price, 100);
+    EXPECT_EQ(book.best_ask().price, 105);
+}
+
+namespace {
+
+// Hand-built image: bid level 100 holding slots 0 and 1 (FIFO 0 -> 1),
+// slot 2 free, both resting orders indexed. Tests corrupt one part of it.
+struct HandImage {
+    std::vector<SnapshotOrder>      orders;
+    std::vector<std::uint32_t>      free_slots{2};
+    std::vector<SnapshotIndexEntry> index;
+    std::vector<SnapshotLevel>      bids;
+    std::vector<SnapshotLevel>      asks;
+
+    HandImage() {
+        orders.resize(3);
+        for (std::uint32_t i = 0; i < 2; ++i) {
+            orders[i].id     = 10 + i;
+            orders[i].side   = static_cast<std::int32_t>(Side::Buy);
+            orders[i].price  = 100;
+            orders[i].qty    = 3;
+            orders[i].active = 1;
+            index.push_back(SnapshotIndexEntry{10 + i, i, 0});
+        }
+        orders[0].prev = kNoSlot;
+        orders[0].next = 1;
+        orders[1].prev = 0;
+        orders[1].next = kNoSlot;
+        orders[2].prev = orders[2].next = kNoSlot;
+        bids.push_back(SnapshotLevel{100, 0, 1, 6, 2, 0});
+    }
+
+    void write(const std::string& path) const {
+        write_book_snapshot(path, BookSnapshotView{20, orders, free_slots, index, bids, asks});
+    }
+};
+
+} // namespace
+
+TEST(BookSnapshot, RejectsInconsistentLinksFreeListAndIndex) {
+    TempFile file("book_snapshot_links.img");
+
+    OrderBook book;
+    HandImage{}.write(file.path);
+    book.load_snapshot(file.path);
+    EXPECT_EQ(book.best_bid().qty, 6);
+    EXPECT_EQ(book.best_bid().orders, 2u);
+    book.add_limit_order(Side::Buy, 90, 7);
+
+    const auto rejected = [&](const HandImage& image) {
+        image.write(file.path);
+        EXPECT_THROW(book.load_snapshot(file.path), std::runtime_error);
+        EXPECT_EQ(book.best_bid().price, 100); // unchanged
+        EXPECT_EQ(book.best_bid().qty, 6);
+    };
+
+    HandImage cycle; // 0 -> 1 -> 0, the level claiming three orders
+    cycle.orders[1].next      = 0;
+    cycle.orders[0].prev      = 1;
+    cycle.bids[0].order_count = 3;
+    rejected(cycle);
+
+    HandImage self_loop; // 0 -> 0 with a count that fits the walk
+    self_loop.orders[0].next = 0;
+    rejected(self_loop);
+
+    HandImage short_count; // the chain has two orders
+    short_count.bids[0].order_count = 1;
+    rejected(short_count);
+
+    HandImage wrong_tail;
+    wrong_tail.bids[0].tail = 0;
+    rejected(wrong_tail);
+
+    HandImage wrong_total;
+    wrong_total.bids[0].total_qty = 7;
+    rejected(wrong_total);
+
+    HandImage broken_prev;
+    broken_prev.orders[1].prev = kNoSlot;
+    rejected(broken_prev);
+
+    HandImage orphan; // active, but on no level
+    orphan.orders[0].next      = kNoSlot;
+    orphan.bids[0].tail        = 0;
+    orphan.bids[0].total_qty   = 3;
+    orphan.bids[0].order_count = 1;
+    rejected(orphan);
+
+    HandImage double_free;
+    double_free.free_slots = {2, 2};
+    rejected(double_free);
+
+    HandImage index_inactive;
+    index_inactive.index[1].slot = 2;
+    rejected(index_inactive);
+
+    HandImage index_other_id;
+    index_other_id.index[1].id = 99;
+    rejected(index_other_id);
+
+    HandImage index_twice;
+    index_twice.index[1].slot = 0;
+    index_twice.index[1].id   = 10;
+    rejected(index_twice);
+}
+
+TEST(BookSnapshot, LadderOutOfSpanKeepsTheBook) {
+    TempFile file("book_snapshot_span.img");
+
+    // Valid image, but two bid levels further apart than a ladder can hold.
+    HandImage image;
+    image.orders[1].price = 100 + static_cast<Price>(LadderPriceLevels<LevelInfo, std::less<Price>>::kMaxSpanTicks);
+    image.orders[0].next  = kNoSlot;
+    image.orders[1].prev  = kNoSlot;
+    image.bids = {SnapshotLevel{image.orders[1].price, 1, 1, 3, 1, 0}, SnapshotLevel{100, 0, 0, 3, 1, 0}};
+    image.write(file.path);
+
+    OrderBook map_book;
+    map_book.load_snapshot(file.path);
+    EXPECT_EQ(map_book.best_bid().price, image.orders[1].price);
+
+    LadderOrderBook book;
+    book.add_limit_order(Side::Buy, 90, 7);
+    EXPECT_THROW(book.load_snapshot(file.path), std::length_error);
+    EXPECT_EQ(book.best_bid().price, 90);
+    EXPECT_EQ(book.best_bid().qty, 7);
+    EXPECT_EQ(book.add_limit_order(Side::Sell, 95, 1), 2u);
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include "exchange/bybit_book_sync.hpp"
+
+#include <cstdint>
+#include <string>
+
+using namespace exchange;
+using trading::Side;
+
+namespace {
+
+constexpr BybitScale kScale{2, 0};
+
+// orderbook.50 frame with one bid level "price@qty"; u and seq as given.
+std::string frame(const char* type, std::uint64_t u, std::uint64_t seq, const char* price, const char* qty) {
+    return std::string(R"({"topic":"orderbook.50.BTCUSDT","type":")") + type +
+           R"(","ts":1000,"data":{"s":"BTCUSDT","b":[[")" + price + R"(",")" + qty +
+           R"("]],"a":[],"u":)" + std::to_string(u) + R"(,"seq":)" + std::to_string(seq) + "}}";
+}
+
+void feed(BybitBookSync& sync, const std::string& f) {
+    ASSERT_EQ(parse_bybit_message(f, kScale, sync), BybitParseStatus::Ok) << f;
+}
+
+trading::Quantity bid_qty(const trading::LevelBook& book, trading::Price price) {
+    return book.level_qty(Side::Buy, price);
+}
+
+OrderBookSnapshot rest_snapshot(std::int64_t seq, double price, double qty) {
+    OrderBookSnapshot snap;
+    snap.symbol = "BTCUSDT";
+    snap.seq    = seq;
+    snap.bids.push_back(OrderBookLevel{price, qty});
+    return snap;
+}
+
+} // namespace
+
+TEST(BybitBookSync, AppliesContiguousDeltasAndDropsStaleOnes) {
+    trading::LevelBook book;
+    BybitBookSync      sync(book);
+    EXPECT_EQ(sync.state(), BookSyncState::WaitingSnapshot);
+
+    feed(sync, frame("snapshot", 10, 100, "1.00", "5"));
+    EXPECT_TRUE(sync.live());
+    EXPECT_TRUE(sync.applied());
+    feed(sync, frame("delta", 11, 101, "1.00", "6"));
+    EXPECT_TRUE(sync.applied());
+    EXPECT_EQ(bid_qty(book, 100), 6);
+
+    feed(sync, frame("delta", 11, 101, "1.00", "9")); // duplicate
+    EXPECT_FALSE(sync.applied());
+    EXPECT_EQ(bid_qty(book, 100), 6);
+    EXPECT_EQ(sync.stats().stale_deltas, 1u);
+    EXPECT_EQ(sync.last_update_id(), 11u);
+}
+
+TEST(BybitBookSync, GapBuffersUntilWsSnapshotThenReplays) {
+    trading::LevelBook book;
+    BybitBookSync      sync(book);
+    feed(sync, frame("snapshot", 10, 100, "1.00", "5"));
+
+    feed(sync, frame("delta", 13, 130, "1.00", "7")); // 11, 12 lost
+    EXPECT_EQ(sync.state(), BookSyncState::Resyncing);
+    feed(sync, frame("delta", 14, 140, "2.00", "1"));
+    feed(sync, frame("delta", 15, 150, "3.00", "1"));
+    EXPECT_EQ(sync.buffered_deltas(), 3u);
+    EXPECT_EQ(bid_qty(book, 100), 5); // stale book is left alone
+    EXPECT_EQ(bid_qty(book, 200), 0);
+
+    // Re-subscribe snapshot at u=14: only u=15 is replayed on top of it.
+    feed(sync, frame("snapshot", 14, 145, "1.00", "8"));
+    EXPECT_TRUE(sync.live());
+    EXPECT_EQ(bid_qty(book, 100), 8);
+    EXPECT_EQ(bid_qty(book, 300), 1);
+    EXPECT_EQ(bid_qty(book, 200), 0); // cleared by the snapshot, not replayed
+    EXPECT_EQ(sync.last_update_id(), 15u);
+    EXPECT_EQ(sync.buffered_deltas(), 0u);
+    EXPECT_EQ(sync.stats().gaps, 1u);
+    EXPECT_EQ(sync.stats().replayed, 1u);
+
+    feed(sync, frame("delta", 16, 160, "3.00", "0"));
+    EXPECT_TRUE(sync.applied());
+    EXPECT_EQ(bid_qty(book, 300), 0);
+}
+
+TEST(BybitBookSync, RestSnapshotBridgesBySequence) {
+    trading::LevelBook book;
+    BybitBookSync      sync(book);
+    feed(sync, frame("snapshot", 10, 100, "1.00", "5"));
+    feed(sync, frame("delta", 12, 120, "2.00", "1")); // gap: chain front seq 120
+    feed(sync, frame("delta", 13, 130, "3.00", "1"));
+    feed(sync, frame("delta", 14, 140, "4.00", "1"));
+
+    // Older than the chain front: could miss u=11.
+    EXPECT_FALSE(sync.apply_snapshot(rest_snapshot(110, 1.0, 9), kScale));
+    EXPECT_EQ(sync.stats().stale_snapshots, 1u);
+    EXPECT_EQ(sync.state(), BookSyncState::Resyncing);
+
+    // Covers u=12 and 13; u=14 is replayed.
+    EXPECT_TRUE(sync.apply_snapshot(rest_snapshot(135, 1.0, 9), kScale));
+    EXPECT_TRUE(sync.live());
+    EXPECT_EQ(bid_qty(book, 100), 9);
+    EXPECT_EQ(bid_qty(book, 200), 0);
+    EXPECT_EQ(bid_qty(book, 400), 1);
+    EXPECT_EQ(sync.last_update_id(), 14u);
+
+    feed(sync, frame("delta", 15, 150, "5.00", "1"));
+    EXPECT_TRUE(sync.applied());
+    EXPECT_FALSE(sync.apply_snapshot(rest_snapshot(200, 1.0, 1), kScale)); // already live
+}
+
+TEST(BybitBookSync, RestSnapshotNewerThanBufferAnchorsOnSeq) {
+    trading::LevelBook book;
+    BybitBookSync      sync(book);
+    feed(sync, frame("snapshot", 10, 100, "1.00", "5"));
+    feed(sync, frame("delta", 12, 120, "2.00", "1"));
+
+    EXPECT_TRUE(sync.apply_snapshot(rest_snapshot(150, 1.0, 3), kScale));
+    EXPECT_EQ(sync.last_update_id(), 12u); // chain fully covered
+    feed(sync, frame("delta", 13, 130, "2.00", "4")); // older than the snapshot (seq 130 < 150) but u is next
+    EXPECT_TRUE(sync.applied());
+}
+
+TEST(BybitBookSync, FullBufferDiscardsOldestDeltas) {
+    trading::LevelBook book;
+    BybitBookSync      sync(book, 2); // two buffered levels
+    feed(sync, frame("snapshot", 10, 100, "1.00", "5"));
+    feed(sync, frame("delta", 12, 120, "2.00", "1"));
+    feed(sync, frame("delta", 13, 130, "3.00", "1"));
+    feed(sync, frame("delta", 14, 140, "4.00", "1"));
+    EXPECT_EQ(sync.buffered_deltas(), 2u);
+    EXPECT_EQ(sync.stats().buffer_overflows, 1u);
+
+    // The chain now starts at seq 130: a snapshot at 125 is not enough.
+    EXPECT_FALSE(sync.apply_snapshot(rest_snapshot(125, 1.0, 9), kScale));
+    EXPECT_TRUE(sync.apply_snapshot(rest_snapshot(130, 1.0, 9), kScale));
+    EXPECT_EQ(bid_qty(book, 400), 1);
+    EXPECT_EQ(sync.last_update_id(), 14u);
+}
+
+TEST(BybitBookSync, ResetWaitsForTheNextSnapshot) {
+    trading::LevelBook book;
+    BybitBookSync      sync(book);
+    feed(sync, frame("snapshot", 10, 100, "1.00", "5"));
+    sync.reset(); // new connection
+    EXPECT_EQ(sync.state(), BookSyncState::WaitingSnapshot);
+
+    feed(sync, frame("delta", 3, 200, "2.00", "1")); // before the subscribe snapshot
+    EXPECT_FALSE(sync.applied());
+    feed(sync, frame("snapshot", 2, 190, "1.00", "6"));
+    EXPECT_TRUE(sync.live());
+    EXPECT_EQ(bid_qty(book, 200), 1);
+    EXPECT_EQ(sync.last_update_id(), 3u);
+}
+
+TEST(BybitBookSync, SnapshotFailingHalfwayIsNotLive) {
+    trading::LevelBook book;
+    BybitBookSync      sync(book);
+    feed(sync, frame("snapshot", 10, 100, "1.00", "5"));
+
+    // Second bid level cut short: the first one is already in the book.
+    const std::string truncated =
+        R"({"topic":"orderbook.50.BTCUSDT","type":"snapshot","ts":1000,"data":{"s":"BTCUSDT",)"
+        R"("b":[["3.00","7"],["2.00"]],"a":[],"u":20,"seq":200}})";
+    EXPECT_EQ(parse_bybit_message(truncated, kScale, sync), BybitParseStatus::Error);
+    EXPECT_EQ(sync.state(), BookSyncState::Resyncing);
+    EXPECT_FALSE(sync.applied());
+
+    // Buffered, not applied to the half-built book.
+    feed(sync, frame("delta", 21, 210, "2.00", "6"));
+    feed(sync, frame("delta", 22, 220, "3.00", "8"));
+    EXPECT_FALSE(sync.applied());
+    EXPECT_EQ(sync.buffered_deltas(), 2u);
+
+    EXPECT_TRUE(sync.apply_snapshot(rest_snapshot(215, 2.0, 4), kScale));
+    EXPECT_EQ(bid_qty(book, 100), 0);
+    EXPECT_EQ(bid_qty(book, 200), 4);
+    EXPECT_EQ(bid_qty(book, 300), 8);
+    EXPECT_EQ(sync.last_update_id(), 22u);
+}
+
+TEST(BybitBookSync, LostDeltaRejectsOlderRestSnapshots) {
+    trading::LevelBook book;
+    BybitBookSync      sync(book, 1); // one buffered level
+    feed(sync, frame("snapshot", 10, 100, "1.00", "5"));
+
+    // Gap, and the delta revealing it has two levels: it does not fit.
+    const std::string big =
+        R"({"topic":"orderbook.50.BTCUSDT","type":"delta","ts":1000,"data":{"s":"BTCUSDT",)"
+        R"("b":[["2.00","1"],["3.00","1"]],"a":[],"u":12,"seq":120}})";
+    feed(sync, big);
+    EXPECT_EQ(sync.state(), BookSyncState::Resyncing);
+    EXPECT_EQ(sync.buffered_deltas(), 0u);
+    EXPECT_EQ(sync.stats().buffer_overflows, 1u);
+
+    // Older than the lost delta: would silently miss it.
+    EXPECT_FALSE(sync.apply_snapshot(rest_snapshot(115, 1.0, 9), kScale));
+    EXPECT_EQ(sync.stats().stale_snapshots, 1u);
+    EXPECT_EQ(sync.state(), BookSyncState::Resyncing);
+
+    EXPECT_TRUE(sync.apply_snapshot(rest_snapshot(120, 1.0, 9), kScale));
+    EXPECT_EQ(bid_qty(book, 100), 9);
+}
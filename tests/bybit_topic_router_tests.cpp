@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include "exchange/bybit_public_ws.hpp"
+#include "exchange/bybit_topic_router.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace exchange;
+
+namespace {
+
+const std::string kBookBtc =
+    R"({"topic":"orderbook.50.BTCUSDT","type":"delta","ts":1,"data":{"s":"BTCUSDT","b":[],"a":[],"u":2,"seq":3}})";
+const std::string kTradeEth =
+    R"({"topic":"publicTrade.ETHUSDT","type":"snapshot","ts":1,"data":[]})";
+const std::string kAck = R"({"success":true,"ret_msg":"subscribe","op":"subscribe"})";
+
+} // namespace
+
+TEST(FindBybitTopic, TopicAnywhereAtTopLevel) {
+    EXPECT_EQ(find_bybit_topic(kBookBtc), "orderbook.50.BTCUSDT");
+    // Key order is not guaranteed: earlier values are skipped, nested "topic" is not taken.
+    EXPECT_EQ(find_bybit_topic(R"({"ts":5, "data":{"topic":"x"}, "topic" : "publicTrade.BTCUSDT"})"),
+              "publicTrade.BTCUSDT");
+    EXPECT_TRUE(find_bybit_topic(kAck).empty());
+    EXPECT_TRUE(find_bybit_topic(R"({"topic":)").empty());
+    EXPECT_TRUE(find_bybit_topic("").empty());
+}
+
+TEST(BybitTopicRouter, RoutesByTopicWithoutCopy) {
+    BybitTopicRouter router;
+    std::vector<std::pair<TopicId, const char*>> seen;
+    auto record = [&](TopicId id, std::string_view frame, const WsFrameInfo&) { seen.emplace_back(id, frame.data()); };
+
+    const TopicId btc = router.add("orderbook.50.BTCUSDT", record);
+    const TopicId eth = router.add("publicTrade.ETHUSDT", record);
+    EXPECT_EQ(btc, 0u);
+    EXPECT_EQ(eth, 1u);
+    EXPECT_EQ(router.topics(), (std::vector<std::string>{"orderbook.50.BTCUSDT", "publicTrade.ETHUSDT"}));
+    EXPECT_EQ(router.find("publicTrade.ETHUSDT"), eth);
+    EXPECT_EQ(router.find("publicTrade.SOLUSDT"), kNoTopic);
+
+    std::vector<std::string> fallback;
+    router.set_fallback([&](std::string_view frame, const WsFrameInfo&) { fallback.emplace_back(frame); });
+
+    const WsFrameInfo info;
+    EXPECT_EQ(router.dispatch(kTradeEth, info), eth);
+    EXPECT_EQ(router.dispatch(kBookBtc, info), btc);
+    EXPECT_EQ(router.dispatch(kAck, info), kNoTopic);
+    EXPECT_EQ(router.dispatch(R"({"topic":"orderbook.50.SOLUSDT","data":{}})", info), kNoTopic);
+
+    ASSERT_EQ(seen.size(), 2u);
+    EXPECT_EQ(seen[0].first, eth);
+    EXPECT_EQ(seen[0].second, kTradeEth.data()); // the frame itself, not a copy
+    EXPECT_EQ(seen[1].first, btc);
+    EXPECT_EQ(fallback.size(), 2u);
+
+    EXPECT_EQ(router.stats().routed, 2u);
+    EXPECT_EQ(router.stats().control, 1u);
+    EXPECT_EQ(router.stats().unrouted, 1u);
+}
+
+TEST(BybitTopicRouter, ReAddKeepsIdAndReplacesHandler) {
+    BybitTopicRouter router;
+    int first  = 0;
+    int second = 0;
+    const TopicId id = router.add("orderbook.50.BTCUSDT", [&](TopicId, std::string_view, const WsFrameInfo&) { ++first; });
+    EXPECT_EQ(router.add("orderbook.50.BTCUSDT", [&](TopicId, std::string_view, const WsFrameInfo&) { ++second; }), id);
+    EXPECT_EQ(router.size(), 1u);
+
+    router.dispatch(kBookBtc, WsFrameInfo{});
+    EXPECT_EQ(first, 0);
+    EXPECT_EQ(second, 1);
+}
+
+TEST(BybitSubscribe, SplitsTopicsIntoRequestsOfTenArgs) {
+    EXPECT_TRUE(bybit_subscribe_messages({}).empty());
+
+    std::vector<std::string> topics;
+    for (int i = 0; i < 23; ++i) {
+        topics.push_back("orderbook.50.SYM" + std::to_string(i));
+    }
+    const std::vector<std::string> msgs = bybit_subscribe_messages(topics);
+    ASSERT_EQ(msgs.size(), 3u);
+
+    std::vector<std::string> args;
+    for (const std::string& m : msgs) {
+        const nlohmann::json j = nlohmann::json::parse(m);
+        EXPECT_EQ(j.at("op"), "subscribe");
+        EXPECT_LE(j.at("args").size(), kBybitMaxSubscribeArgs);
+        for (const auto& a : j.at("args")) {
+            args.push_back(a.get<std::string>());
+        }
+    }
+    EXPECT_EQ(args, topics); // every topic once, in order
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include "exchange/bybit_ws_parser.hpp"
+#include "utils/decimal.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace exchange;
+using trading::Side;
+
+// ---- decimal -> ticks ------------------------------------------------------
+
+TEST(ParseFixedPoint, ScalesPadsAndRounds) {
+    std::int64_t v = 0;
+
+    EXPECT_TRUE(utils::parse_fixed_point("16493.50", 2, v));
+    EXPECT_EQ(v, 1649350);
+
+    EXPECT_TRUE(utils::parse_fixed_point("16493.5", 2, v)); // padded
+    EXPECT_EQ(v, 1649350);
+
+    EXPECT_TRUE(utils::parse_fixed_point("42", 3, v));
+    EXPECT_EQ(v, 42000);
+
+    EXPECT_TRUE(utils::parse_fixed_point("0.000001", 6, v));
+    EXPECT_EQ(v, 1);
+
+    EXPECT_TRUE(utils::parse_fixed_point("16493.55", 1, v)); // half rounds up
+    EXPECT_EQ(v, 164936);
+
+    EXPECT_TRUE(utils::parse_fixed_point("16493.549", 1, v)); // only first dropped digit counts
+    EXPECT_EQ(v, 164935);
+
+    EXPECT_TRUE(utils::parse_fixed_point("-0.25", 2, v));
+    EXPECT_EQ(v, -25);
+
+    EXPECT_TRUE(utils::parse_fixed_point("0", 6, v));
+    EXPECT_EQ(v, 0);
+}
+
+TEST(ParseFixedPoint, RejectsMalformedAndOverflow) {
+    std::int64_t v = 7;
+
+    EXPECT_FALSE(utils::parse_fixed_point("", 2, v));
+    EXPECT_FALSE(utils::parse_fixed_point("-", 2, v));
+    EXPECT_FALSE(utils::parse_fixed_point(".", 2, v));
+    EXPECT_FALSE(utils::parse_fixed_point("1.2.3", 2, v));
+    EXPECT_FALSE(utils::parse_fixed_point("1e5", 2, v));
+    EXPECT_FALSE(utils::parse_fixed_point(" 1", 2, v));
+    EXPECT_FALSE(utils::parse_fixed_point("99999999999999999999", 0, v));
+    EXPECT_FALSE(utils::parse_fixed_point("9223372036854775807", 1, v)); // *10 overflows
+    EXPECT_EQ(v, 7); // untouched on failure
+}
+
+// ---- frames ----------------------------------------------------------------
+
+namespace {
+
+struct Recorder : BybitHandlerBase {
+    std::vector<BybitMessageHeader> begins;
+    std::vector<BybitMessageHeader> ends;
+    std::vector<BybitLevel>         levels;
+    std::vector<BybitTrade>         trades;
+    std::vector<std::string>        trade_ids;
+
+    void on_book_begin(const BybitMessageHeader& h) { begins.push_back(h); }
+    void on_level(const BybitLevel& l) { levels.push_back(l); }
+    void on_book_end(const BybitMessageHeader& h) { ends.push_back(h); }
+    void on_trade(const BybitMessageHeader&, const BybitTrade& t) {
+        trades.push_back(t);
+        trade_ids.emplace_back(t.trade_id);
+    }
+};
+
+constexpr BybitScale kScale{2, 3};
+
+} // namespace
+
+TEST(BybitWsParser, OrderbookSnapshot) {
+    const std::string frame =
+        R"({"topic":"orderbook.50.BTCUSDT","type":"snapshot","ts":1672304484978,)"
+        R"("data":{"s":"BTCUSDT","b":[["16493.50","0.006"],["16493.00","0.100"]],)"
+        R"("a":[["16611.00","0.029"]],"u":18521288,"seq":7961638724},"cts":1672304484976})";
+
+    Recorder rec;
+    ASSERT_EQ(parse_bybit_message(frame, kScale, rec), BybitParseStatus::Ok);
+
+    ASSERT_EQ(rec.begins.size(), 1u);
+    ASSERT_EQ(rec.ends.size(), 1u);
+    const auto& h = rec.ends[0];
+    EXPECT_EQ(h.kind, BybitMessageKind::OrderbookSnapshot);
+    EXPECT_EQ(h.symbol, "BTCUSDT");
+    EXPECT_EQ(h.ts_ms, 1672304484978);
+    EXPECT_EQ(h.cts_ms, 1672304484976);
+    EXPECT_EQ(h.update_id, 18521288u);
+    EXPECT_EQ(h.seq, 7961638724u);
+
+    ASSERT_EQ(rec.levels.size(), 3u);
+    EXPECT_EQ(rec.levels[0].side, Side::Buy);
+    EXPECT_EQ(rec.levels[0].price, 1649350);
+    EXPECT_EQ(rec.levels[0].qty, 6);
+    EXPECT_EQ(rec.levels[1].price, 1649300);
+    EXPECT_EQ(rec.levels[1].qty, 100);
+    EXPECT_EQ(rec.levels[2].side, Side::Sell);
+    EXPECT_EQ(rec.levels[2].price, 1661100);
+    EXPECT_EQ(rec.levels[2].qty, 29);
+}
+
+TEST(BybitWsParser, DeltaWithDataFirstAndWhitespace) {
+    // Key order is not guaranteed: data before topic/type, u before b.
+    const std::string frame =
+        "{ \"data\" : { \"u\" : 5, \"a\" : [ ], \"b\" : [ [ \"100.1\" , \"0\" ] ] } ,\n"
+        "  \"type\" : \"delta\", \"topic\" : \"orderbook.1.ETHUSDT\", \"ts\" : 7 }";
+
+    Recorder rec;
+    ASSERT_EQ(parse_bybit_message(frame, kScale, rec), BybitParseStatus::Ok);
+    ASSERT_EQ(rec.begins.size(), 1u);
+    EXPECT_EQ(rec.begins[0].kind, BybitMessageKind::OrderbookDelta);
+    EXPECT_EQ(rec.begins[0].update_id, 5u);
+    EXPECT_EQ(rec.begins[0].symbol, "ETHUSDT");
+    ASSERT_EQ(rec.levels.size(), 1u);
+    EXPECT_EQ(rec.levels[0].price, 10010);
+    EXPECT_EQ(rec.levels[0].qty, 0); // removal
+}
+
+TEST(BybitWsParser, PublicTrade) {
+    const std::string frame =
+        R"({"topic":"publicTrade.BTCUSDT","ts":1672304486868,"type":"snapshot","data":[)"
+        R"({"T":1672304486865,"s":"BTCUSDT","S":"Buy","v":"0.001","p":"16578.50","L":"PlusTick","i":"20f43950","BT":false},)"
+        R"({"T":1672304486866,"s":"BTCUSDT","S":"Sell","v":"1.5","p":"16578","i":"x\"y","BT":true}]})";
+
+    Recorder rec;
+    ASSERT_EQ(parse_bybit_message(frame, kScale, rec), BybitParseStatus::Ok);
+    ASSERT_EQ(rec.trades.size(), 2u);
+    EXPECT_EQ(rec.trades[0].taker_side, Side::Buy);
+    EXPECT_EQ(rec.trades[0].price, 1657850);
+    EXPECT_EQ(rec.trades[0].qty, 1);
+    EXPECT_EQ(rec.trades[0].ts_ms, 1672304486865);
+    EXPECT_EQ(rec.trade_ids[0], "20f43950");
+    EXPECT_EQ(rec.trades[1].taker_side, Side::Sell);
+    EXPECT_EQ(rec.trades[1].price, 1657800);
+    EXPECT_EQ(rec.trades[1].qty, 1500);
+    EXPECT_EQ(rec.trade_ids[1], "x\\\"y"); // raw, escapes not decoded
+    EXPECT_TRUE(rec.levels.empty());
+}
+
+TEST(BybitWsParser, ControlUnsupportedAndErrors) {
+    Recorder rec;
+
+    EXPECT_EQ(parse_bybit_message(
+                  R"({"success":true,"ret_msg":"subscribe","conn_id":"abc","op":"subscribe"})",
+                  kScale, rec),
+              BybitParseStatus::Control);
+    EXPECT_EQ(parse_bybit_message(R"({"topic":"tickers.BTCUSDT","data":{}})", kScale, rec),
+              BybitParseStatus::Unsupported);
+
+    EXPECT_EQ(parse_bybit_message("", kScale, rec), BybitParseStatus::Error);
+    EXPECT_EQ(parse_bybit_message(R"({"topic":"orderbook.1.X","type":"delta"})", kScale, rec),
+              BybitParseStatus::Error); // no data
+    EXPECT_EQ(parse_bybit_message(
+                  R"({"topic":"orderbook.1.X","type":"delta","data":{"b":[["1.0","abc"]]}})",
+                  kScale, rec),
+              BybitParseStatus::Error);
+    EXPECT_EQ(parse_bybit_message(R"({"topic":"orderbook.1.X","type":"delta","data":{"b":[)",
+                                  kScale, rec),
+              BybitParseStatus::Error); // truncated
+
+    EXPECT_TRUE(rec.ends.empty());
+}
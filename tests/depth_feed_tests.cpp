@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include "trading/depth_feed.hpp"
+#include "trading/level_book.hpp"
+#include "trading/order_book.hpp"
+
+#include <array>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace trading;
+
+template <typename Book>
+class DepthTest : public ::testing::Test {};
+
+using DepthBookTypes = ::testing::Types<OrderBook, LadderOrderBook>;
+TYPED_TEST_SUITE(DepthTest, DepthBookTypes);
+
+TYPED_TEST(DepthTest, DepthIsBestFirstAndBoundedByBuffer) {
+    TypeParam book;
+    book.add_limit_order(Side::Buy, 100, 5);
+    book.add_limit_order(Side::Buy, 100, 2);
+    book.add_limit_order(Side::Buy, 98, 1);
+    book.add_limit_order(Side::Buy, 99, 3);
+    book.add_limit_order(Side::Sell, 105, 4);
+
+    std::array<LevelInfo, 8> out{};
+    ASSERT_EQ(book.depth(Side::Buy, 10, out), 3u);
+    EXPECT_EQ(out[0].price, 100);
+    EXPECT_EQ(out[0].qty, 7);
+    EXPECT_EQ(out[0].orders, 2u);
+    EXPECT_EQ(out[1].price, 99);
+    EXPECT_EQ(out[2].price, 98);
+    EXPECT_TRUE(out[2].valid);
+
+    EXPECT_EQ(book.depth(Side::Buy, 2, out), 2u);
+    EXPECT_EQ(book.depth(Side::Buy, 10, std::span<LevelInfo>(out.data(), 1)), 1u);
+    EXPECT_EQ(book.depth(Side::Sell, 10, out), 1u);
+    EXPECT_EQ(out[0].price, 105);
+
+    book.clear();
+    EXPECT_EQ(book.depth(Side::Sell, 10, out), 0u);
+}
+
+TEST(LevelBookDepth, AggregatedLevelsBestFirst) {
+    LadderLevelBook book;
+    book.set_level(Side::Sell, 103, 2);
+    book.set_level(Side::Sell, 101, 4);
+    book.set_level(Side::Sell, 102, 1);
+
+    std::array<LevelInfo, 2> out{};
+    ASSERT_EQ(book.depth(Side::Sell, 5, out), 2u);
+    EXPECT_EQ(out[0].price, 101);
+    EXPECT_EQ(out[0].qty, 4);
+    EXPECT_EQ(out[1].price, 102);
+}
+
+TEST(DepthFeed, ReportsSnapshotThenOnlyChanges) {
+    LevelBook book;
+    DepthFeed feed(2);
+    book.set_level(Side::Buy, 100, 5);
+    book.set_level(Side::Buy, 99, 3);
+    book.set_level(Side::Buy, 98, 1);
+    book.set_level(Side::Sell, 101, 2);
+
+    auto changes = feed.update(book);
+    ASSERT_EQ(changes.size(), 3u); // 100, 99 (top 2 bids), 101
+    EXPECT_EQ(changes[0].price, 100);
+    EXPECT_EQ(changes[1].price, 99);
+    EXPECT_EQ(changes[2].side, Side::Sell);
+
+    EXPECT_TRUE(feed.update(book).empty());
+
+    book.set_level(Side::Buy, 98, 7); // below the top 2: not reported
+    EXPECT_TRUE(feed.update(book).empty());
+
+    book.set_level(Side::Buy, 100, 0); // 99 becomes best, 98 enters the top 2
+    changes = feed.update(book);
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].price, 100);
+    EXPECT_EQ(changes[0].qty, 0);
+    EXPECT_EQ(changes[1].price, 98);
+    EXPECT_EQ(changes[1].qty, 7);
+
+    book.set_level(Side::Buy, 101, 1); // pushes 98 out
+    book.set_level(Side::Sell, 101, 0);
+    changes = feed.update(book);
+    ASSERT_EQ(changes.size(), 3u);
+    EXPECT_EQ(changes[0].price, 101);
+    EXPECT_EQ(changes[1].price, 98);
+    EXPECT_EQ(changes[1].qty, 0);
+    EXPECT_EQ(changes[2].side, Side::Sell);
+    EXPECT_EQ(changes[2].qty, 0);
+
+    feed.reset();
+    EXPECT_EQ(feed.update(book).size(), 2u);
+}
+
+TYPED_TEST(DepthTest, FeedReplayedOntoMirrorMatchesDepth) {
+    constexpr std::size_t kLevels = 5;
+    TypeParam             book;
+    DepthFeed             feed(kLevels);
+    std::map<Price, LevelInfo, std::greater<Price>> bids;
+    std::map<Price, LevelInfo>                      asks;
+
+    std::mt19937                    rng(7);
+    std::uniform_int_distribution<> pct(0, 99), px(90, 110), qty(1, 5);
+    std::vector<OrderId>            ids;
+
+    for (int step = 0; step < 3000; ++step) {
+        const int r = pct(rng);
+        if (r < 55) {
+            const Side side = pct(rng) < 50 ? Side::Buy : Side::Sell;
+            // Keep the book uncrossed: bids below 100, asks above.
+            const Price price = side == Side::Buy ? px(rng) % 10 + 90 : px(rng) % 10 + 101;
+            ids.push_back(book.add_limit_order(side, price, qty(rng)));
+        } else if (r < 90 && !ids.empty()) {
+            const std::size_t i = static_cast<std::size_t>(rng()) % ids.size();
+            book.cancel(ids[i]);
+            ids[i] = ids.back();
+            ids.pop_back();
+        } else {
+            book.execute_market_order(pct(rng) < 50 ? Side::Buy : Side::Sell, qty(rng));
+        }
+
+        for (const DepthChange& c : feed.update(book)) {
+            const LevelInfo info{true, c.price, c.qty, c.orders};
+            if (c.side == Side::Buy) {
+                c.qty == 0 ? (void)bids.erase(c.price) : (void)(bids[c.price] = info);
+            } else {
+                c.qty == 0 ? (void)asks.erase(c.price) : (void)(asks[c.price] = info);
+            }
+        }
+
+        std::array<LevelInfo, kLevels> want{};
+        const std::size_t nb = book.depth(Side::Buy, kLevels, want);
+        ASSERT_EQ(bids.size(), nb);
+        std::size_t k = 0;
+        for (const auto& [price, info] : bids) {
+            ASSERT_EQ(price, want[k].price);
+            ASSERT_EQ(info.qty, want[k].qty);
+            ASSERT_EQ(info.orders, want[k].orders);
+            ++k;
+        }
+        const std::size_t na = book.depth(Side::Sell, kLevels, want);
+        ASSERT_EQ(asks.size(), na);
+        k = 0;
+        for (const auto& [price, info] : asks) {
+            ASSERT_EQ(price, want[k].price);
+            ASSERT_EQ(info.qty, want[k].qty);
+            ++k;
+        }
+    }
+}
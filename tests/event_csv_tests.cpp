@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include "trading/event_csv.hpp"
+#include "utils/line_reader.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace trading;
+
+TEST(EventCsv, ParsesReplayFormat) {
+    Event ev;
+    ASSERT_EQ(parse_csv_event("ADD, sell ,101,5,9\r", ev), CsvParseStatus::Ok);
+    EXPECT_EQ(ev.type, EventType::Add);
+    EXPECT_EQ(ev.side, Side::Sell);
+    EXPECT_EQ(ev.price, 101);
+    EXPECT_EQ(ev.qty, 5);
+    EXPECT_EQ(ev.id, 9u);
+
+    ASSERT_EQ(parse_csv_event("mkt,B,3", ev), CsvParseStatus::Ok);
+    EXPECT_EQ(ev.type, EventType::Market);
+    EXPECT_EQ(ev.side, Side::Buy);
+    EXPECT_EQ(ev.qty, 3);
+
+    ASSERT_EQ(parse_csv_event("CXL,9", ev), CsvParseStatus::Ok);
+    EXPECT_EQ(ev.type, EventType::Cancel);
+    EXPECT_EQ(ev.id, 9u);
+
+    EXPECT_EQ(parse_csv_event("  # comment", ev), CsvParseStatus::Skip);
+    EXPECT_EQ(parse_csv_event(" \r", ev), CsvParseStatus::Skip);
+}
+
+TEST(EventCsv, RejectsMalformedLinesWithoutThrowing) {
+    Event ev;
+    for (std::string_view line : {"ADD,BUY,abc,1,1", "ADD,BUY,100,1", "ADD,UP,100,1,1",
+                                  "ADD,BUY,100.5,1,1", "ADD,BUY,12abc,1,1", "MKT,SELL",
+                                  "CANCEL,-1", "CANCEL,99999999999999999999", "FOO,1"}) {
+        EXPECT_EQ(parse_csv_event(line, ev), CsvParseStatus::Error) << line;
+    }
+}
+
+TEST(EventCsv, ParsesFeedFormat) {
+    Event ev;
+    ASSERT_EQ(parse_feed_event("1700000000123,A,b,10050,3,extra", ev), CsvParseStatus::Ok);
+    EXPECT_EQ(ev.type, EventType::Add);
+    EXPECT_EQ(ev.side, Side::Buy);
+    EXPECT_EQ(ev.ts_ns, 1700000000123);
+    EXPECT_EQ(ev.price, 10050);
+    EXPECT_EQ(ev.qty, 3);
+    EXPECT_EQ(ev.id, 0u);
+
+    ASSERT_EQ(parse_feed_event("5,T,S,0,2", ev), CsvParseStatus::Ok);
+    EXPECT_EQ(ev.type, EventType::Market);
+    EXPECT_EQ(ev.side, Side::Sell);
+
+    EXPECT_EQ(parse_feed_event("", ev), CsvParseStatus::Skip);
+    EXPECT_EQ(parse_feed_event("5,X,S,0,2", ev), CsvParseStatus::Error);
+    EXPECT_EQ(parse_feed_event("5,A,B,100", ev), CsvParseStatus::Error);
+}
+
+TEST(LineReader, SplitsLinesAcrossBlockBoundaries) {
+    const std::string path =
+        (std::filesystem::temp_directory_path() / "line_reader_blocks.txt").string();
+
+    // Lines longer than the 8-byte block force buffer growth; no trailing '\n'.
+    const std::vector<std::string> lines = {"a", "", "0123456789abcdef", "xyz", "last"};
+    {
+        std::ofstream out(path, std::ios::binary);
+        for (std::size_t i = 0; i < lines.size(); ++i) {
+            out << lines[i] << (i + 1 < lines.size() ? "\n" : "");
+        }
+    }
+
+    utils::LineReader in(path, 8);
+    ASSERT_FALSE(in.failed());
+    std::vector<std::string> got;
+    std::string_view         line;
+    while (in.next(line)) {
+        got.emplace_back(line);
+    }
+    EXPECT_EQ(got, lines);
+    EXPECT_EQ(in.line_number(), lines.size());
+    EXPECT_FALSE(in.failed());
+    std::remove(path.c_str());
+
+    utils::LineReader missing("/nonexistent/dir/file.csv");
+    EXPECT_TRUE(missing.failed());
+    EXPECT_FALSE(missing.next(line));
+}
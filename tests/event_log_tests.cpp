@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include "trading/event_log.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace trading;
+
+namespace {
+
+// Unique file under the temp directory, removed at scope exit.
+struct TempFile {
+    explicit TempFile(const std::string& name)
+        : path((std::filesystem::temp_directory_path() /
+                (name + "_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed())))
+                   .string()) {}
+    ~TempFile() { std::remove(path.c_str()); }
+
+    std::string path;
+};
+
+std::vector<Event> sample_events() {
+    std::vector<Event> events(3);
+    events[0].type       = EventType::Add;
+    events[0].side       = Side::Sell;
+    events[0].price      = 10050;
+    events[0].qty        = 7;
+    events[0].id         = 42;
+    events[0].ts_ns      = 123456789;
+    events[0].instrument = 3;
+    events[1].type       = EventType::Market;
+    events[1].side       = Side::Buy;
+    events[1].qty        = 2;
+    events[2].type       = EventType::Cancel;
+    events[2].id         = 42;
+    return events;
+}
+
+} // namespace
+
+TEST(EventLog, RoundTripsEventsThroughMapping) {
+    TempFile file("event_log_roundtrip.bin");
+    const auto events = sample_events();
+    {
+        EventLogWriter writer(file.path, EventLogScale{2, 6});
+        writer.write(events);
+        EXPECT_EQ(writer.count(), events.size());
+    }
+
+    ASSERT_TRUE(is_event_log(file.path));
+    MappedEventLog log(file.path);
+    EXPECT_EQ(log.header().price_decimals, 2u);
+    EXPECT_EQ(log.header().qty_decimals, 6u);
+    ASSERT_EQ(log.size(), events.size());
+
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        const Event& got = log.events()[i];
+        EXPECT_EQ(got.type, events[i].type);
+        EXPECT_EQ(got.side, events[i].side);
+        EXPECT_EQ(got.price, events[i].price);
+        EXPECT_EQ(got.qty, events[i].qty);
+        EXPECT_EQ(got.id, events[i].id);
+        EXPECT_EQ(got.ts_ns, events[i].ts_ns);
+        EXPECT_EQ(got.instrument, events[i].instrument);
+    }
+}
+
+TEST(EventLog, RejectsForeignAndTruncatedFiles) {
+    TempFile csv("event_log_not_a_log.csv");
+    {
+        std::ofstream out(csv.path);
+        out << "# type,side,price,qty,id\n"
+               "ADD,BUY,100,1,1\n"
+               "and some more text to go past the 64-byte header size ......\n";
+    }
+    EXPECT_FALSE(is_event_log(csv.path));
+    EXPECT_THROW(MappedEventLog{csv.path}, std::runtime_error);
+
+    TempFile bin("event_log_truncated.bin");
+    {
+        EventLogWriter writer(bin.path);
+        writer.write(sample_events());
+    }
+    std::filesystem::resize_file(bin.path, sizeof(EventLogHeader) + sizeof(EventRecord) + 1);
+    EXPECT_THROW(MappedEventLog{bin.path}, std::runtime_error);
+
+    EXPECT_THROW(MappedEventLog{"/nonexistent/dir/events.bin"}, std::runtime_error);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include "trading/id_index.hpp"
+#include "trading/order_book.hpp"
+
+#include <random>
+#include <unordered_map>
+
+using namespace trading;
+
+template <typename Index>
+class IdIndexTest : public ::testing::Test {};
+
+using IdIndexTypes = ::testing::Types<FlatIdIndex, DirectIdIndex>;
+TYPED_TEST_SUITE(IdIndexTest, IdIndexTypes);
+
+TYPED_TEST(IdIndexTest, InsertFindEraseIncludingIdZero) {
+    TypeParam index;
+
+    EXPECT_EQ(index.find(0), kNoSlot);
+    EXPECT_EQ(index.find(42), kNoSlot);
+
+    index.insert(0, 5);
+    index.insert(42, 7);
+    EXPECT_EQ(index.size(), 2u);
+    EXPECT_EQ(index.find(0), 5u);
+    EXPECT_EQ(index.find(42), 7u);
+
+    index.insert(42, 8); // overwrite
+    EXPECT_EQ(index.size(), 2u);
+    EXPECT_EQ(index.find(42), 8u);
+
+    EXPECT_TRUE(index.erase(0));
+    EXPECT_FALSE(index.erase(0));
+    EXPECT_EQ(index.find(0), kNoSlot);
+    EXPECT_EQ(index.size(), 1u);
+
+    index.clear();
+    EXPECT_EQ(index.find(42), kNoSlot);
+    EXPECT_EQ(index.size(), 0u);
+}
+
+TYPED_TEST(IdIndexTest, MatchesUnorderedMapOnRandomOps) {
+    TypeParam index;
+    std::unordered_map<OrderId, std::uint32_t> ref;
+
+    std::mt19937_64 rng(3);
+    std::uniform_int_distribution<OrderId> id_dist(1, 50'000);
+    std::uniform_int_distribution<int>     op_dist(0, 2);
+
+    for (std::uint32_t i = 0; i < 200'000; ++i) {
+        OrderId id = id_dist(rng);
+        switch (op_dist(rng)) {
+        case 0:
+            index.insert(id, i);
+            ref[id] = i;
+            break;
+        case 1:
+            ASSERT_EQ(index.erase(id), ref.erase(id) == 1);
+            break;
+        default: {
+            auto it = ref.find(id);
+            ASSERT_EQ(index.find(id), it == ref.end() ? kNoSlot : it->second);
+            break;
+        }
+        }
+        ASSERT_EQ(index.size(), ref.size());
+    }
+}
+
+TEST(DirectIdIndex, RejectsIdsAboveLimit) {
+    DirectIdIndex index;
+    EXPECT_THROW(index.insert(DirectIdIndex::kMaxId + 1, 0), std::length_error);
+    EXPECT_EQ(index.find(DirectIdIndex::kMaxId + 1), kNoSlot);
+}
+
+TEST(DirectIdIndex, OrderBookWithDenseIds) {
+    OrderBookWith<LadderLevels, DirectIdIndex> book;
+
+    for (OrderId id = 1; id <= 5'000; ++id) {
+        book.add_limit_order_with_id(id, Side::Buy, 100 - static_cast<Price>(id % 10), 1);
+    }
+    for (OrderId id = 1; id <= 5'000; id += 2) {
+        EXPECT_TRUE(book.cancel(id));
+    }
+    EXPECT_FALSE(book.cancel(1));
+
+    auto mr = book.execute_market_order(Side::Sell, 10'000);
+    EXPECT_EQ(mr.filled, 2'500);
+    EXPECT_TRUE(book.empty());
+}
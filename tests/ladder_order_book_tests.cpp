@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include "trading/order_book.hpp"
+#include "trading/types.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace trading;
+
+TEST(LadderOrderBook, BestLevelsFollowInsertAndCancel) {
+    LadderOrderBook book;
+
+    auto id100 = book.add_limit_order(Side::Buy, 100, 1);
+    auto id101 = book.add_limit_order(Side::Buy, 101, 2);
+    book.add_limit_order(Side::Sell, 110, 3);
+    auto id109 = book.add_limit_order(Side::Sell, 109, 4);
+
+    EXPECT_EQ(book.best_bid().price, 101);
+    EXPECT_EQ(book.best_ask().price, 109);
+
+    EXPECT_TRUE(book.cancel(id101));
+    EXPECT_TRUE(book.cancel(id109));
+
+    EXPECT_EQ(book.best_bid().price, 100);
+    EXPECT_EQ(book.best_ask().price, 110);
+
+    EXPECT_TRUE(book.cancel(id100));
+    EXPECT_FALSE(book.best_bid().valid);
+}
+
+TEST(LadderOrderBook, CursorSkipsEmptyWordsOfTheBitmap) {
+    LadderOrderBook book;
+
+    // 1000 ticks apart -> the cursor has to walk across many bitmap words.
+    book.add_limit_order(Side::Buy, 10'000, 1);
+    book.add_limit_order(Side::Buy, 9'000, 2);
+    book.add_limit_order(Side::Sell, 10'001, 3);
+    book.add_limit_order(Side::Sell, 11'001, 4);
+
+    auto mr = book.execute_market_order(Side::Sell, 1);
+    EXPECT_EQ(mr.filled, 1);
+    EXPECT_EQ(book.best_bid().price, 9'000);
+
+    mr = book.execute_market_order(Side::Buy, 3);
+    EXPECT_EQ(mr.filled, 3);
+    EXPECT_EQ(book.best_ask().price, 11'001);
+}
+
+TEST(LadderOrderBook, RecentersWhenPriceLeavesTheWindow) {
+    LadderOrderBook book;
+
+    book.add_limit_order(Side::Buy, 1'000, 5);
+    // Far outside the default 4096-tick window on both sides.
+    book.add_limit_order(Side::Buy, 100'000, 1); // crosses nothing, becomes best bid
+    book.add_limit_order(Side::Sell, 200'000, 7);
+
+    auto bb = book.best_bid();
+    auto ba = book.best_ask();
+    EXPECT_EQ(bb.price, 100'000);
+    EXPECT_EQ(bb.qty, 1);
+    EXPECT_EQ(ba.price, 200'000);
+    EXPECT_EQ(ba.qty, 7);
+
+    auto mr = book.execute_market_order(Side::Sell, 6);
+    EXPECT_EQ(mr.filled, 6);
+    EXPECT_FALSE(book.best_bid().valid);
+}
+
+TEST(LadderOrderBook, MatchesMapBackendOnRandomStream) {
+    OrderBook       map_book;
+    LadderOrderBook ladder_book;
+
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<int>      type_dist(0, 99);
+    std::uniform_int_distribution<int>      side_dist(0, 1);
+    std::uniform_int_distribution<Price>    price_dist(90, 110);
+    std::uniform_int_distribution<Quantity> qty_dist(1, 10);
+
+    std::vector<OrderId> ids;
+    OrderId              next_id = 1;
+
+    for (int i = 0; i < 20'000; ++i) {
+        int  r    = type_dist(rng);
+        Side side = side_dist(rng) == 0 ? Side::Buy : Side::Sell;
+
+        if (r < 60 || ids.empty()) {
+            Price    px = price_dist(rng);
+            Quantity q  = qty_dist(rng);
+            map_book.add_limit_order_with_id(next_id, side, px, q);
+            ladder_book.add_limit_order_with_id(next_id, side, px, q);
+            ids.push_back(next_id++);
+        } else if (r < 90) {
+            Quantity q  = qty_dist(rng);
+            auto     m1 = map_book.execute_market_order(side, q);
+            auto     m2 = ladder_book.execute_market_order(side, q);
+            ASSERT_EQ(m1.filled, m2.filled);
+        } else {
+            std::uniform_int_distribution<std::size_t> idx_dist(0, ids.size() - 1);
+            std::size_t                                idx = idx_dist(rng);
+            ASSERT_EQ(map_book.cancel(ids[idx]), ladder_book.cancel(ids[idx]));
+            ids[idx] = ids.back();
+            ids.pop_back();
+        }
+
+        auto b1 = map_book.best_bid();
+        auto b2 = ladder_book.best_bid();
+        auto a1 = map_book.best_ask();
+        auto a2 = ladder_book.best_ask();
+        ASSERT_EQ(b1.valid, b2.valid);
+        ASSERT_EQ(b1.price, b2.price);
+        ASSERT_EQ(b1.qty, b2.qty);
+        ASSERT_EQ(a1.valid, a2.valid);
+        ASSERT_EQ(a1.price, a2.price);
+        ASSERT_EQ(a1.qty, a2.qty);
+    }
+}
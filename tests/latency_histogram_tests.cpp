@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "utils/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+using utils::LatencyHistogram;
+
+TEST(LatencyHistogram, BucketsAreContiguousAndNarrow) {
+    // Every bucket starts right after the previous one ends.
+    for (std::size_t i = 1; i < LatencyHistogram::kBucketCount; ++i) {
+        ASSERT_EQ(LatencyHistogram::lowest_in_bucket(i), LatencyHistogram::highest_in_bucket(i - 1) + 1) << i;
+    }
+    for (std::uint64_t v : {0ull, 1ull, 127ull, 128ull, 129ull, 1000ull, 123456789ull, (1ull << 39) + 7}) {
+        const std::size_t b = LatencyHistogram::bucket_index(v);
+        EXPECT_LE(LatencyHistogram::lowest_in_bucket(b), v);
+        EXPECT_GE(LatencyHistogram::highest_in_bucket(b), v);
+        const std::uint64_t width = LatencyHistogram::highest_in_bucket(b) - LatencyHistogram::lowest_in_bucket(b) + 1;
+        EXPECT_LE(width * LatencyHistogram::kSubBuckets, std::max<std::uint64_t>(v, LatencyHistogram::kSubBuckets));
+    }
+    EXPECT_EQ(LatencyHistogram::bucket_index(~0ull), LatencyHistogram::kBucketCount - 1);
+}
+
+TEST(LatencyHistogram, SmallValuesAreExact) {
+    LatencyHistogram h;
+    for (std::uint64_t v = 1; v <= 100; ++v) {
+        h.record(v);
+    }
+    EXPECT_EQ(h.count(), 100u);
+    EXPECT_EQ(h.min(), 1u);
+    EXPECT_EQ(h.max(), 100u);
+    EXPECT_DOUBLE_EQ(h.mean(), 50.5);
+    EXPECT_EQ(h.percentile(0.0), 1u);
+    EXPECT_EQ(h.percentile(0.5), 50u);
+    EXPECT_EQ(h.percentile(0.99), 99u);
+    EXPECT_EQ(h.percentile(1.0), 100u);
+}
+
+TEST(LatencyHistogram, PercentilesMatchSortedSamplesWithinBucketWidth) {
+    std::mt19937_64                    rng(42);
+    std::lognormal_distribution<double> dist(8.0, 1.5); // ~3 us median, long tail
+
+    auto h = std::make_unique<LatencyHistogram>();
+    std::vector<std::uint64_t> samples;
+    for (int i = 0; i < 200'000; ++i) {
+        const auto v = static_cast<std::uint64_t>(dist(rng));
+        samples.push_back(v);
+        h->record(v);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    for (double q : {0.5, 0.9, 0.99, 0.999, 0.9999}) {
+        const std::uint64_t exact = samples[static_cast<std::size_t>(q * samples.size()) - 1];
+        const std::uint64_t got   = h->percentile(q);
+        EXPECT_GE(got, exact) << q;
+        EXPECT_LE(static_cast<double>(got), static_cast<double>(exact) * (1.0 + 1.0 / LatencyHistogram::kSubBuckets) + 1.0) << q;
+    }
+    EXPECT_EQ(h->percentile(1.0), samples.back());
+}
+
+TEST(LatencyHistogram, MergeEqualsRecordingEverythingInOne) {
+    auto a   = std::make_unique<LatencyHistogram>();
+    auto b   = std::make_unique<LatencyHistogram>();
+    auto all = std::make_unique<LatencyHistogram>();
+    for (std::uint64_t v = 0; v < 5000; ++v) {
+        (v % 3 ? *a : *b).record(v * 37);
+        all->record(v * 37);
+    }
+    a->merge(*b);
+    EXPECT_EQ(a->count(), all->count());
+    EXPECT_EQ(a->sum(), all->sum());
+    EXPECT_EQ(a->min(), all->min());
+    EXPECT_EQ(a->max(), all->max());
+    for (std::size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+        ASSERT_EQ(a->count_at(i), all->count_at(i)) << i;
+    }
+
+    a->reset();
+    EXPECT_TRUE(a->empty());
+    EXPECT_EQ(a->percentile(0.5), 0u);
+    EXPECT_EQ(a->min(), 0u);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include "trading/level_book.hpp"
+
+#include <map>
+#include <random>
+
+using namespace trading;
+
+template <typename Book>
+class LevelBookTest : public ::testing::Test {};
+
+using LevelBookTypes = ::testing::Types<LevelBook, LadderLevelBook>;
+TYPED_TEST_SUITE(LevelBookTest, LevelBookTypes);
+
+TYPED_TEST(LevelBookTest, SetReplaceAndRemoveLevels) {
+    TypeParam book;
+    EXPECT_TRUE(book.empty());
+
+    book.set_level(Side::Buy, 100, 5);
+    book.set_level(Side::Buy, 101, 7);
+    book.set_level(Side::Sell, 103, 2);
+    book.set_level(Side::Sell, 102, 4);
+
+    auto top = book.top_of_book();
+    ASSERT_TRUE(top.bid.valid);
+    ASSERT_TRUE(top.ask.valid);
+    EXPECT_EQ(top.bid.price, 101);
+    EXPECT_EQ(top.bid.qty, 7);
+    EXPECT_EQ(top.ask.price, 102);
+    EXPECT_EQ(top.ask.qty, 4);
+    EXPECT_EQ(book.level_count(Side::Buy), 2u);
+    EXPECT_EQ(book.level_count(Side::Sell), 2u);
+
+    // Delta semantics: absolute quantity, 0 removes the level.
+    book.set_level(Side::Buy, 101, 3);
+    EXPECT_EQ(book.best_bid().qty, 3);
+    EXPECT_EQ(book.level_count(Side::Buy), 2u);
+
+    book.set_level(Side::Buy, 101, 0);
+    EXPECT_EQ(book.best_bid().price, 100);
+    EXPECT_EQ(book.level_qty(Side::Buy, 101), 0);
+    EXPECT_EQ(book.level_count(Side::Buy), 1u);
+
+    // Removing an absent level is a no-op.
+    book.set_level(Side::Sell, 999, 0);
+    EXPECT_EQ(book.level_count(Side::Sell), 2u);
+
+    book.clear();
+    EXPECT_TRUE(book.empty());
+    EXPECT_FALSE(book.best_bid().valid);
+    EXPECT_FALSE(book.best_ask().valid);
+    EXPECT_EQ(book.level_count(Side::Buy), 0u);
+}
+
+TYPED_TEST(LevelBookTest, RandomDeltasMatchReferenceMap) {
+    TypeParam book;
+    std::map<Price, Quantity, std::greater<Price>> ref_bids;
+    std::map<Price, Quantity>                      ref_asks;
+
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int>      side(0, 1);
+    std::uniform_int_distribution<Price>    price(1000, 1200);
+    std::uniform_int_distribution<Quantity> qty(-3, 10); // <= 0 removes
+
+    for (int i = 0; i < 20000; ++i) {
+        const Side     s = side(rng) == 0 ? Side::Buy : Side::Sell;
+        const Price    p = price(rng);
+        const Quantity q = qty(rng);
+        book.set_level(s, p, q);
+
+        if (s == Side::Buy) {
+            if (q > 0) ref_bids[p] = q; else ref_bids.erase(p);
+        } else {
+            if (q > 0) ref_asks[p] = q; else ref_asks.erase(p);
+        }
+
+        const auto top = book.top_of_book();
+        ASSERT_EQ(top.bid.valid, !ref_bids.empty());
+        ASSERT_EQ(top.ask.valid, !ref_asks.empty());
+        if (top.bid.valid) {
+            ASSERT_EQ(top.bid.price, ref_bids.begin()->first);
+            ASSERT_EQ(top.bid.qty, ref_bids.begin()->second);
+        }
+        if (top.ask.valid) {
+            ASSERT_EQ(top.ask.price, ref_asks.begin()->first);
+            ASSERT_EQ(top.ask.qty, ref_asks.begin()->second);
+        }
+        ASSERT_EQ(book.level_count(Side::Buy), ref_bids.size());
+        ASSERT_EQ(book.level_count(Side::Sell), ref_asks.size());
+    }
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include "trading/event.hpp"
+#include "trading/level_book.hpp"
+#include "trading/order_book.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+using namespace trading;
+
+// ---- allocation counting hook ----------------------------------------------
+// Global operator new/delete are replaced for this test binary only; the
+// counter is armed around the code under test.
+
+namespace {
+
+std::atomic<bool>        g_counting{false};
+std::atomic<std::size_t> g_allocations{0};
+
+struct AllocationCounter {
+    AllocationCounter() {
+        g_allocations.store(0);
+        g_counting.store(true);
+    }
+    ~AllocationCounter() { g_counting.store(false); }
+
+    std::size_t count() const { return g_allocations.load(); }
+};
+
+void* counted_alloc(std::size_t size) {
+    if (g_counting.load(std::memory_order_relaxed))
+        g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc{};
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return counted_alloc(size); }
+void* operator new[](std::size_t size) { return counted_alloc(size); }
+void  operator delete(void* p) noexcept { std::free(p); }
+void  operator delete[](void* p) noexcept { std::free(p); }
+void  operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void  operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+// ---- helpers ---------------------------------------------------------------
+
+namespace {
+
+constexpr std::size_t kMaxLive = 2000;
+
+// Deterministic add/cancel/market stream in a 200-tick band with at most
+// kMaxLive resting orders, so it stays inside the config used below.
+std::vector<Event> make_stream(std::size_t n, std::uint32_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<int> kind(0, 9);
+    std::uniform_int_distribution<int> offset(0, 99);
+    std::uniform_int_distribution<int> qty(1, 10);
+
+    std::vector<Event>   events;
+    std::vector<OrderId> live;
+    events.reserve(n);
+    live.reserve(n);
+
+    OrderId next_id = 1;
+    for (std::size_t i = 0; i < n; ++i) {
+        Event ev;
+        const int k = kind(rng);
+        if ((k < 6 && live.size() < kMaxLive) || live.empty()) {
+            ev.type  = EventType::Add;
+            ev.side  = (k % 2 == 0) ? Side::Buy : Side::Sell;
+            // Bids in [900, 999], asks in [1001, 1100]: limits never cross.
+            ev.price = ev.side == Side::Buy ? 999 - offset(rng) : 1001 + offset(rng);
+            ev.qty   = qty(rng);
+            ev.id    = next_id++;
+            live.push_back(ev.id);
+        } else if (k < 9) {
+            std::uniform_int_distribution<std::size_t> pick(0, live.size() - 1);
+            const std::size_t j = pick(rng);
+            ev.type = EventType::Cancel;
+            ev.id   = live[j];
+            live[j] = live.back();
+            live.pop_back();
+        } else {
+            ev.type = EventType::Market;
+            ev.side = (k % 2 == 0) ? Side::Buy : Side::Sell;
+            ev.qty  = qty(rng);
+        }
+        events.push_back(ev);
+    }
+    return events;
+}
+
+template <typename Book>
+void apply(Book& book, const std::vector<Event>& events) {
+    for (const Event& ev : events) {
+        switch (ev.type) {
+        case EventType::Add:
+            book.add_limit_order_with_id(ev.id, ev.side, ev.price, ev.qty);
+            break;
+        case EventType::Cancel:
+            (void)book.cancel(ev.id);
+            break;
+        case EventType::Market:
+            (void)book.execute_market_order(ev.side, ev.qty);
+            break;
+        case EventType::End:
+            break;
+        }
+    }
+}
+
+} // namespace
+
+// ---- tests -----------------------------------------------------------------
+
+TEST(AllocationHook, CountsHeapAllocations) {
+    AllocationCounter counter;
+    auto* p = new int(42);
+    delete p;
+    EXPECT_EQ(counter.count(), 1u);
+}
+
+template <typename Book>
+class PreallocatedBookTest : public ::testing::Test {};
+
+using BookTypes = ::testing::Types<OrderBookWith<MapLevels, FlatIdIndex>,
+                                   OrderBookWith<MapLevels, DirectIdIndex>,
+                                   OrderBookWith<LadderLevels, FlatIdIndex>,
+                                   OrderBookWith<LadderLevels, DirectIdIndex>>;
+TYPED_TEST_SUITE(PreallocatedBookTest, BookTypes);
+
+TYPED_TEST(PreallocatedBookTest, ReplayMakesNoAllocationsAfterReserve) {
+    constexpr std::size_t kEvents = 50000;
+    const auto events = make_stream(kEvents, 7);
+
+    // Ids of the stream are dense, so max_orders also covers DirectIdIndex.
+    OrderBookConfig config;
+    config.max_orders = kEvents;
+    config.max_levels = 256;
+    TypeParam book(config);
+
+    std::size_t allocations = 0;
+    {
+        AllocationCounter counter;
+        apply(book, events);
+        allocations = counter.count();
+    }
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_FALSE(book.empty());
+}
+
+TYPED_TEST(PreallocatedBookTest, ClearKeepsReservedMemory) {
+    const auto events = make_stream(20000, 11);
+
+    OrderBookConfig config;
+    config.max_orders = 20000;
+    config.max_levels = 256;
+    TypeParam book(config);
+
+    apply(book, events);
+    book.clear();
+
+    std::size_t allocations = 0;
+    {
+        AllocationCounter counter;
+        apply(book, events);
+        allocations = counter.count();
+    }
+    EXPECT_EQ(allocations, 0u);
+}
+
+TEST(PreallocatedBook, DefaultMapBookAllocatesPerLevel) {
+    // Sanity check of the hook: an unreserved map side pays for new levels.
+    OrderBookConfig config;
+    config.max_levels = 0;
+    OrderBook book(config);
+
+    std::size_t allocations = 0;
+    {
+        AllocationCounter counter;
+        for (Price p = 1; p <= 10; ++p)
+            book.add_limit_order(Side::Buy, p, 1);
+        allocations = counter.count();
+    }
+    EXPECT_GE(allocations, 10u);
+}
+
+TEST(PreallocatedBook, LevelBookDeltasMakeNoAllocationsAfterReserve) {
+    LevelBook book(256);
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<Price>    price(1000, 1100);
+    std::uniform_int_distribution<Quantity> qty(0, 5);
+
+    std::size_t allocations = 0;
+    {
+        AllocationCounter counter;
+        for (int i = 0; i < 20000; ++i) {
+            book.set_level(i % 2 == 0 ? Side::Buy : Side::Sell, price(rng), qty(rng));
+        }
+        book.clear();
+        allocations = counter.count();
+    }
+    EXPECT_EQ(allocations, 0u);
+}
@@ -1,8 +1,14 @@
 #include <gtest/gtest.h>
 
+#include "trading/event.hpp"
 #include "trading/order_book.hpp"
 #include "trading/types.hpp"
 
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
 using namespace trading;
 constexpr Quantity qty8 = 8;
 constexpr Quantity qty12 = 12;
@@ -274,3 +280,395 @@ TEST(OrderBookCancel, CancelNonExistingOrderReturnsFalseAndKeepsState) {
     EXPECT_EQ(ba_after.price, ba_before.price);
     EXPECT_EQ(ba_after.qty,   ba_before.qty);
 }
+
+TEST(OrderBookCancel, CancelFromMiddleOfLevelKeepsFifoOrder) {
+    OrderBook book;
+
+    auto id1 = book.add_limit_order(Side::Sell, 100, 1);
+    auto id2 = book.add_limit_order(Side::Sell, 100, 2);
+    auto id3 = book.add_limit_order(Side::Sell, 100, 4);
+
+    EXPECT_TRUE(book.cancel(id2));
+    EXPECT_EQ(book.best_ask().qty, 5);
+
+    // FIFO: id1 (1) заполняется первым, затем id3.
+    auto result = book.execute_market_order(Side::Buy, 2);
+    EXPECT_EQ(result.filled, 2);
+    EXPECT_FALSE(book.cancel(id1)); // уже исполнен
+    EXPECT_EQ(book.best_ask().qty, 3);
+    EXPECT_TRUE(book.cancel(id3));
+    EXPECT_TRUE(book.empty());
+}
+
+TEST(OrderBookMarketSell, PartialFillKeepsRestOfLevel) {
+    OrderBook book;
+
+    book.add_limit_order(Side::Buy, 100, 5);
+    book.add_limit_order(Side::Buy, 100, 3);
+
+    auto result = book.execute_market_order(Side::Sell, 2);
+    EXPECT_EQ(result.filled, 2);
+
+    auto bb = book.best_bid();
+    EXPECT_TRUE(bb.valid);
+    EXPECT_EQ(bb.qty, 6); // 3 от первого ордера + 3 от второго
+}
+
+TEST(OrderBookAddLimit, DuplicateIdReplacesRestingOrder) {
+    OrderBook book;
+
+    book.add_limit_order_with_id(7, Side::Buy, 100, 5);
+    book.add_limit_order_with_id(7, Side::Buy, 99, 2);
+
+    auto bb = book.best_bid();
+    EXPECT_TRUE(bb.valid);
+    EXPECT_EQ(bb.price, 99);
+    EXPECT_EQ(bb.qty, 2);
+
+    EXPECT_TRUE(book.cancel(7));
+    EXPECT_TRUE(book.empty());
+}
+
+TEST(OrderBookTopOfBook, ReturnsBothSidesWithAggregates) {
+    OrderBook book;
+
+    auto empty_top = book.top_of_book();
+    EXPECT_FALSE(empty_top.bid.valid);
+    EXPECT_FALSE(empty_top.ask.valid);
+
+    book.add_limit_order(Side::Buy, 100, 2);
+    auto bid_id = book.add_limit_order(Side::Buy, 100, 3);
+    book.add_limit_order(Side::Sell, 105, 4);
+
+    auto top = book.top_of_book();
+    EXPECT_TRUE(top.bid.valid);
+    EXPECT_EQ(top.bid.price, 100);
+    EXPECT_EQ(top.bid.qty, 5);
+    EXPECT_EQ(top.bid.orders, 2u);
+    EXPECT_TRUE(top.ask.valid);
+    EXPECT_EQ(top.ask.price, 105);
+    EXPECT_EQ(top.ask.qty, 4);
+    EXPECT_EQ(top.ask.orders, 1u);
+
+    // Частичное исполнение и отмена обновляют агрегаты уровня.
+    book.execute_market_order(Side::Sell, 1);
+    EXPECT_TRUE(book.cancel(bid_id));
+
+    top = book.top_of_book();
+    EXPECT_EQ(top.bid.qty, 1);
+    EXPECT_EQ(top.bid.orders, 1u);
+}
+
+TEST(OrderBookFills, MarketOrderReportsEveryMakerFill) {
+    OrderBook book;
+
+    auto id1 = book.add_limit_order(Side::Sell, 100, 2);
+    auto id2 = book.add_limit_order(Side::Sell, 100, 3);
+    auto id3 = book.add_limit_order(Side::Sell, 101, 4);
+
+    std::vector<Trade> fills;
+    auto result = book.execute_market_order(Side::Buy, 6, [&](const Trade& t) {
+        fills.push_back(t);
+    });
+
+    EXPECT_EQ(result.filled, 6);
+    ASSERT_EQ(fills.size(), 3u);
+
+    EXPECT_EQ(fills[0].maker_id, id1);
+    EXPECT_EQ(fills[0].price, 100);
+    EXPECT_EQ(fills[0].qty, 2);
+    EXPECT_EQ(fills[0].taker_side, Side::Buy);
+
+    EXPECT_EQ(fills[1].maker_id, id2);
+    EXPECT_EQ(fills[1].price, 100);
+    EXPECT_EQ(fills[1].qty, 3);
+
+    EXPECT_EQ(fills[2].maker_id, id3);
+    EXPECT_EQ(fills[2].price, 101);
+    EXPECT_EQ(fills[2].qty, 1);
+}
+
+TEST(OrderBookFills, CrossingLimitReportsTakerFillsAtMakerPrice) {
+    OrderBook book;
+
+    auto maker = book.add_limit_order(Side::Buy, 100, 5);
+
+    Quantity filled = 0;
+    Price    px     = 0;
+    OrderId  rest   = book.add_limit_order_with_id(42, Side::Sell, 99, 8, [&](const Trade& t) {
+        EXPECT_EQ(t.maker_id, maker);
+        EXPECT_EQ(t.taker_side, Side::Sell);
+        filled += t.qty;
+        px = t.price;
+    });
+
+    EXPECT_EQ(rest, 42u);
+    EXPECT_EQ(filled, 5);
+    EXPECT_EQ(px, 100);
+
+    auto ba = book.best_ask();
+    EXPECT_TRUE(ba.valid);
+    EXPECT_EQ(ba.price, 99);
+    EXPECT_EQ(ba.qty, 3);
+}
+
+TEST(OrderBookApply, BatchReportsCountsFillsAndTopOfBook) {
+    OrderBook book;
+
+    std::vector<Event> events;
+    auto add = [&](Side side, Price price, Quantity qty, OrderId id) {
+        Event ev;
+        ev.type  = EventType::Add;
+        ev.side  = side;
+        ev.price = price;
+        ev.qty   = qty;
+        ev.id    = id;
+        events.push_back(ev);
+    };
+    auto mkt = [&](Side side, Quantity qty) {
+        Event ev;
+        ev.type = EventType::Market;
+        ev.side = side;
+        ev.qty  = qty;
+        events.push_back(ev);
+    };
+    auto cxl = [&](OrderId id) {
+        Event ev;
+        ev.type = EventType::Cancel;
+        ev.id   = id;
+        events.push_back(ev);
+    };
+
+    add(Side::Sell, 101, 5, 1);
+    add(Side::Sell, 102, 5, 2);
+    add(Side::Buy,  99,  4, 3);
+    mkt(Side::Buy, 3);           // full: 3 @ 101
+    add(Side::Buy, 101, 4, 4);   // crosses 2 @ 101, rests 2 @ 101
+    cxl(2);                      // hit
+    cxl(2);                      // miss
+    mkt(Side::Buy, 1);           // zero: no asks left
+    mkt(Side::Sell, 10);         // partial: 2 @ 101 + 4 @ 99
+
+    Quantity sink_qty = 0;
+    const ApplyStats st = book.apply(events, [&](const Trade& t) { sink_qty += t.qty; });
+
+    EXPECT_EQ(st.adds, 4u);
+    EXPECT_EQ(st.markets, 3u);
+    EXPECT_EQ(st.cancels, 2u);
+    EXPECT_EQ(st.cancels_hit, 1u);
+    EXPECT_EQ(st.events(), 9u);
+    EXPECT_EQ(st.markets_full, 1u);
+    EXPECT_EQ(st.markets_zero, 1u);
+    EXPECT_EQ(st.market_filled_buy, 3);
+    EXPECT_EQ(st.market_filled_sell, 6);
+    EXPECT_EQ(st.limit_filled, 2);
+    EXPECT_EQ(st.filled(), 11);
+    EXPECT_EQ(sink_qty, st.filled());
+
+    EXPECT_TRUE(book.empty());
+    EXPECT_FALSE(st.top.bid.valid);
+    EXPECT_FALSE(st.top.ask.valid);
+}
+
+TEST(OrderBookApply, EventHookRunsAfterEachEvent) {
+    OrderBook          book;
+    std::vector<Event> events(4);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        events[i].type  = EventType::Add;
+        events[i].side  = Side::Buy;
+        events[i].price = 100 + static_cast<Price>(i);
+        events[i].qty   = 1;
+        events[i].id    = i + 1;
+    }
+
+    // The hook sees the book with events[0..i] applied.
+    std::vector<std::size_t> seen;
+    book.apply(events, NullFillSink{}, [&](std::size_t i) {
+        seen.push_back(i);
+        EXPECT_EQ(book.best_bid().price, 100 + static_cast<Price>(i));
+    });
+    EXPECT_EQ(seen, (std::vector<std::size_t>{0, 1, 2, 3}));
+}
+
+TEST(OrderBookApply, IdZeroAddsGetGeneratedIdsAndTopIsFinal) {
+    OrderBook book;
+
+    std::vector<Event> events(3);
+    for (auto& ev : events) {
+        ev.type  = EventType::Add;
+        ev.side  = Side::Buy;
+        ev.qty   = 1;
+    }
+    events[0].price = 100;
+    events[1].price = 101;
+    events[2].price = 101;
+
+    ApplyStats total;
+    total += book.apply(std::span<const Event>(events).first(1));
+    total += book.apply(std::span<const Event>(events).subspan(1));
+
+    EXPECT_EQ(total.adds, 3u);
+    EXPECT_TRUE(total.top.bid.valid);
+    EXPECT_EQ(total.top.bid.price, 101);
+    EXPECT_EQ(total.top.bid.qty, 2);
+    EXPECT_EQ(total.top.bid.orders, 2u);
+
+    // Generated ids start at 1 and can be cancelled.
+    EXPECT_TRUE(book.cancel(1));
+    EXPECT_TRUE(book.cancel(3));
+    EXPECT_EQ(book.best_bid().qty, 1);
+}
+
+TEST(OrderBookLoadLevels, MatchesPerLevelAddsAndReplacesContent) {
+    const std::vector<PriceLevel> bids{{100, 5}, {99, 0}, {98, 7}};
+    const std::vector<PriceLevel> asks{{101, 3}, {103, 4}};
+
+    OrderBook expected;
+    for (const auto& lvl : bids) expected.add_limit_order(Side::Buy, lvl.price, lvl.qty);
+    for (const auto& lvl : asks) expected.add_limit_order(Side::Sell, lvl.price, lvl.qty);
+
+    OrderBook book;
+    book.add_limit_order(Side::Buy, 50, 1); // dropped by load_levels
+    book.load_levels(bids, asks);
+
+    std::vector<LevelInfo> a(8), b(8);
+    for (Side side : {Side::Buy, Side::Sell}) {
+        const std::size_t n = expected.depth(side, a.size(), a);
+        ASSERT_EQ(book.depth(side, b.size(), b), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(a[i].price, b[i].price);
+            EXPECT_EQ(a[i].qty, b[i].qty);
+        }
+    }
+    EXPECT_EQ(book.depth(Side::Buy, 8, b), 2u); // qty 0 level skipped
+
+    // Same generated ids: order 3 is the 101 ask, and the next id continues.
+    EXPECT_TRUE(book.cancel(3));
+    EXPECT_EQ(book.best_ask().price, 103);
+    EXPECT_EQ(book.add_limit_order(Side::Buy, 90, 1), expected.add_limit_order(Side::Buy, 90, 1));
+
+    // Resting orders behave like any other: a market sell fills 100 then 98.
+    const MatchResult mr = book.execute_market_order(Side::Sell, 6);
+    EXPECT_EQ(mr.filled, 6);
+    EXPECT_EQ(book.best_bid().price, 98);
+    EXPECT_EQ(book.best_bid().qty, 6);
+}
+
+TEST(OrderBookLoadLevels, RejectsUnsortedOrCrossedLevelsAndKeepsBook) {
+    OrderBook book;
+    book.add_limit_order(Side::Buy, 10, 1);
+
+    const std::vector<PriceLevel> unsorted{{99, 1}, {100, 1}};
+    const std::vector<PriceLevel> dup{{101, 1}, {101, 2}};
+    const std::vector<PriceLevel> bids{{100, 1}};
+    const std::vector<PriceLevel> crossing{{100, 1}, {102, 1}};
+
+    EXPECT_THROW(book.load_levels(unsorted, {}), std::invalid_argument);
+    EXPECT_THROW(book.load_levels({}, dup), std::invalid_argument);
+    EXPECT_THROW(book.load_levels(bids, crossing), std::invalid_argument);
+    EXPECT_EQ(book.best_bid().price, 10);
+    EXPECT_FALSE(book.best_ask().valid);
+
+    LadderOrderBook ladder;
+    ladder.load_levels(bids, std::vector<PriceLevel>{{101, 2}, {5000, 1}});
+    EXPECT_EQ(ladder.best_bid().price, 100);
+    EXPECT_EQ(ladder.best_ask().price, 101);
+    EXPECT_EQ(ladder.execute_market_order(Side::Buy, 3).filled, 3);
+    EXPECT_TRUE(ladder.best_bid().valid);
+    EXPECT_FALSE(ladder.best_ask().valid);
+}
+
+// Instrument-tuned variant: 0.1 price ticks, 1e-6 qty ticks, ladder levels,
+// direct ids, 4096 orders / 256 levels reserved by the default constructor.
+using BtcTicks = TickScale<1, 6>;
+using BtcBook  = BasicOrderBook<OrderBookTraits<LadderLevels, DirectIdIndex, BtcTicks, 4096, 256>>;
+
+TEST(OrderBookTraits, TickScaleConvertsAtTheEdges) {
+    static_assert(std::is_same_v<BtcBook::tick_scale, BtcTicks>);
+    static_assert(OrderBook::tick_scale::price_decimals == 2 && OrderBook::tick_scale::qty_decimals == 0);
+    static_assert(BtcTicks::price_mult == 10 && BtcTicks::qty_mult == 1'000'000);
+
+    EXPECT_EQ(BtcTicks::to_price_ticks(16493.5), 164935);
+    EXPECT_EQ(BtcTicks::to_qty_ticks(0.012345), 12345);
+    EXPECT_DOUBLE_EQ(BtcTicks::from_price_ticks(164935), 16493.5);
+
+    Price p = 0;
+    EXPECT_TRUE(BtcTicks::parse_price("16493.50", p));
+    EXPECT_EQ(p, 164935);
+    Quantity q = 0;
+    EXPECT_TRUE(BtcTicks::parse_qty("0.5", q));
+    EXPECT_EQ(q, 500'000);
+}
+
+TEST(OrderBookTraits, CustomTraitsBookMatchesDefaultBook) {
+    // Same flow through both sides: resting adds, crossing limits, markets, cancels.
+    OrderBook          ref;
+    BtcBook            book;
+    std::vector<Trade> ref_fills, fills;
+    const auto         ref_sink = [&](const Trade& t) { ref_fills.push_back(t); };
+    const auto         sink     = [&](const Trade& t) { fills.push_back(t); };
+
+    for (OrderId id = 1; id <= 20; ++id) {
+        const Side  side  = id % 2 ? Side::Buy : Side::Sell;
+        const Price price = side == Side::Buy ? 1000 - static_cast<Price>(id % 5) : 1001 + static_cast<Price>(id % 5);
+        ref.add_limit_order_with_id(id, side, price, static_cast<Quantity>(id));
+        book.add_limit_order_with_id(id, side, price, static_cast<Quantity>(id));
+    }
+    EXPECT_EQ(ref.add_limit_order_with_id(21, Side::Buy, 1002, 30, ref_sink),
+              book.add_limit_order_with_id(21, Side::Buy, 1002, 30, sink));
+    EXPECT_EQ(ref.add_limit_order_with_id(22, Side::Sell, 998, 25, ref_sink),
+              book.add_limit_order_with_id(22, Side::Sell, 998, 25, sink));
+    EXPECT_EQ(ref.execute_market_order(Side::Buy, 17, ref_sink).filled,
+              book.execute_market_order(Side::Buy, 17, sink).filled);
+    EXPECT_EQ(ref.cancel(3), book.cancel(3));
+    EXPECT_EQ(ref.cancel(4), book.cancel(4));
+
+    ASSERT_EQ(fills.size(), ref_fills.size());
+    for (std::size_t i = 0; i < fills.size(); ++i) {
+        EXPECT_EQ(fills[i].maker_id, ref_fills[i].maker_id);
+        EXPECT_EQ(fills[i].taker_side, ref_fills[i].taker_side);
+        EXPECT_EQ(fills[i].price, ref_fills[i].price);
+        EXPECT_EQ(fills[i].qty, ref_fills[i].qty);
+    }
+
+    std::vector<LevelInfo> a(8), b(8);
+    for (Side side : {Side::Buy, Side::Sell}) {
+        const std::size_t n = ref.depth(side, a.size(), a);
+        ASSERT_EQ(book.depth(side, b.size(), b), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(a[i].price, b[i].price);
+            EXPECT_EQ(a[i].qty, b[i].qty);
+            EXPECT_EQ(a[i].orders, b[i].orders);
+        }
+    }
+}
+
+static_assert(std::is_copy_constructible_v<OrderBook> && std::is_copy_assignable_v<OrderBook>);
+static_assert(std::is_copy_constructible_v<LadderOrderBook> && std::is_copy_assignable_v<LadderOrderBook>);
+
+TEST(OrderBookCopy, CopyIsIndependentOfTheOriginal) {
+    OrderBook book;
+    book.add_limit_order_with_id(1, Side::Buy, 100, 5);
+    book.add_limit_order_with_id(2, Side::Buy, 100, 3);
+    book.add_limit_order_with_id(3, Side::Sell, 105, 4);
+
+    OrderBook copy(book);
+    EXPECT_TRUE(book.cancel(1));
+    EXPECT_EQ(book.best_bid().qty, 3);
+    EXPECT_EQ(copy.best_bid().qty, 8);
+
+    // FIFO and ids survive the copy: the market sell fills id 1 first.
+    std::vector<Trade> fills;
+    copy.execute_market_order(Side::Sell, 6, [&](const Trade& t) { fills.push_back(t); });
+    ASSERT_EQ(fills.size(), 2u);
+    EXPECT_EQ(fills[0].maker_id, 1u);
+    EXPECT_EQ(fills[1].maker_id, 2u);
+    EXPECT_EQ(book.best_bid().qty, 3);
+
+    book = copy;
+    EXPECT_EQ(book.best_bid().qty, 2);
+    EXPECT_EQ(book.best_ask().price, 105);
+    EXPECT_TRUE(book.cancel(2));
+    EXPECT_FALSE(book.best_bid().valid);
+    EXPECT_EQ(copy.best_bid().qty, 2);
+}
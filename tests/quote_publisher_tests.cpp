@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include "trading/level_book.hpp"
+#include "trading/order_book.hpp"
+#include "trading/quote_publisher.hpp"
+#include "utils/seqlock.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using namespace trading;
+
+TEST(QuotePublisher, PublishesTopAndDepth) {
+    QuotePublisher<2> quotes;
+    EXPECT_EQ(quotes.update(), 0u);
+    EXPECT_EQ(quotes.read().update, 0u);
+
+    OrderBook book;
+    book.add_limit_order(Side::Buy, 100, 5);
+    book.add_limit_order(Side::Buy, 99, 3);
+    book.add_limit_order(Side::Buy, 98, 1);
+    book.add_limit_order(Side::Sell, 101, 7);
+
+    quotes.publish(book, 42);
+    const auto q = quotes.read();
+    EXPECT_EQ(q.update, 1u);
+    EXPECT_EQ(quotes.update(), 1u);
+    EXPECT_EQ(q.ts_ns, 42);
+    ASSERT_EQ(q.bid_levels, 2u); // capped at Depth
+    ASSERT_EQ(q.ask_levels, 1u);
+    EXPECT_EQ(q.bids[0].price, 100);
+    EXPECT_EQ(q.bids[1].price, 99);
+    EXPECT_EQ(q.asks[0].qty, 7);
+    EXPECT_TRUE(q.top.bid.valid);
+    EXPECT_EQ(q.top.bid.price, 100);
+    EXPECT_EQ(q.top.ask.price, 101);
+
+    book.add_limit_order(Side::Sell, 100, 5); // takes out the best bid
+    quotes.publish(book);
+    EXPECT_EQ(quotes.read().top.bid.price, 99);
+    EXPECT_EQ(quotes.update(), 2u);
+}
+
+TEST(QuotePublisher, TopOnlyFromBookOrApplyStats) {
+    QuotePublisher<> quotes;
+    LevelBook        book;
+    book.set_level(Side::Buy, 10, 1);
+    quotes.publish(book);
+    EXPECT_EQ(quotes.read().top.bid.price, 10);
+    EXPECT_FALSE(quotes.read().top.ask.valid);
+
+    TopOfBook top;
+    top.ask = LevelInfo{true, 12, 3, 1};
+    quotes.publish(top, 7);
+    const auto q = quotes.read();
+    EXPECT_EQ(q.update, 2u);
+    EXPECT_EQ(q.top.ask.price, 12);
+    EXPECT_FALSE(q.top.bid.valid);
+}
+
+// Every word of the value is the same counter: a torn read would mix two.
+struct Wide {
+    std::uint64_t w[9];
+};
+
+TEST(Seqlock, ReadersNeverSeeTornValues) {
+    utils::Seqlock<Wide> slot;
+    static_assert(alignof(utils::Seqlock<Wide>) == utils::kCacheLineSize);
+
+    constexpr std::uint64_t    kStores = 200000;
+    std::atomic<bool>          done{false};
+    std::atomic<std::uint64_t> torn{0};
+
+    std::thread reader([&] {
+        std::uint64_t last = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            const Wide v = slot.load();
+            for (std::uint64_t x : v.w) {
+                if (x != v.w[0]) {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            if (v.w[0] < last) { // values only grow
+                torn.fetch_add(1, std::memory_order_relaxed);
+            }
+            last = v.w[0];
+        }
+    });
+
+    for (std::uint64_t i = 1; i <= kStores; ++i) {
+        Wide v;
+        for (std::uint64_t& x : v.w) {
+            x = i;
+        }
+        slot.store(v);
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_EQ(slot.version(), kStores);
+    EXPECT_EQ(slot.load().w[8], kStores);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include "utils/shm_ring.hpp"
+
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+using utils::ShmRing;
+
+namespace {
+
+std::string ring_name(const char* test) {
+    return std::string("trading_shm_ring_test_") + test + "_" + std::to_string(::getpid());
+}
+
+} // namespace
+
+TEST(ShmRing, ProducerAndConsumerShareMessagesInPlace) {
+    ShmRing consumer(ring_name("basic"), 4096);
+    ShmRing producer(consumer.name());
+    EXPECT_EQ(producer.capacity(), 4096u);
+
+    std::string_view msg;
+    EXPECT_FALSE(consumer.front(msg));
+
+    ASSERT_TRUE(producer.try_push("first"));
+    ASSERT_TRUE(producer.try_push(""));
+    ASSERT_TRUE(producer.try_push("third message"));
+
+    ASSERT_TRUE(consumer.front(msg));
+    EXPECT_EQ(msg, "first");
+    consumer.pop();
+    ASSERT_TRUE(consumer.front(msg));
+    EXPECT_EQ(msg, "");
+    consumer.pop();
+    ASSERT_TRUE(consumer.front(msg));
+    EXPECT_EQ(msg, "third message");
+    consumer.pop();
+    EXPECT_FALSE(consumer.front(msg));
+
+    EXPECT_FALSE(consumer.closed());
+    producer.close();
+    EXPECT_TRUE(consumer.closed());
+}
+
+TEST(ShmRing, FullRingRejectsAndRecordsWrapAround) {
+    ShmRing consumer(ring_name("wrap"), 4096);
+    ShmRing producer(consumer.name());
+
+    const std::string big(1000, 'x'); // 1008 bytes per record
+    int pushed = 0;
+    while (producer.try_push(big)) {
+        ++pushed;
+    }
+    EXPECT_EQ(pushed, 4);
+    EXPECT_FALSE(producer.try_push(std::string(3000, 'y'))); // more than half the ring
+
+    // Drain one by one while refilling: records keep wrapping at the end.
+    std::deque<std::string> queued(4, big);
+    std::string_view        msg;
+    for (int i = 0; i < 50; ++i) {
+        ASSERT_TRUE(consumer.front(msg));
+        EXPECT_EQ(msg, queued.front());
+        consumer.pop();
+        queued.pop_front();
+        queued.emplace_back(1000 - static_cast<std::size_t>(i), static_cast<char>('a' + i % 26));
+        ASSERT_TRUE(producer.try_push(queued.back())) << i;
+    }
+    while (consumer.front(msg)) {
+        EXPECT_EQ(msg, queued.front());
+        consumer.pop();
+        queued.pop_front();
+    }
+    EXPECT_TRUE(queued.empty());
+}
+
+TEST(ShmRing, StreamsAcrossThreads) {
+    ShmRing consumer(ring_name("threads"), 1 << 14);
+
+    constexpr int kMessages = 20000;
+    std::thread producer_thread([name = consumer.name()] {
+        ShmRing producer(name);
+        for (int i = 0; i < kMessages; ++i) {
+            const std::string msg = std::to_string(i);
+            while (!producer.try_push(msg)) {
+                std::this_thread::yield();
+            }
+        }
+        producer.close();
+    });
+
+    int              expected = 0;
+    std::string_view msg;
+    for (;;) {
+        if (consumer.front(msg)) {
+            ASSERT_EQ(msg, std::to_string(expected));
+            consumer.pop();
+            ++expected;
+            continue;
+        }
+        if (consumer.closed() && !consumer.front(msg)) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+    producer_thread.join();
+    EXPECT_EQ(expected, kMessages);
+}
+
+TEST(ShmRing, AttachToMissingRingThrows) {
+    EXPECT_THROW(ShmRing(ring_name("missing")), std::runtime_error);
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include "utils/decimal.hpp"
+#include "utils/simd_kernels.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace utils;
+
+namespace {
+
+// Every tier this CPU can run; Scalar always, the reference.
+std::vector<const simd::Kernels*> available() {
+    std::vector<const simd::Kernels*> out;
+    for (simd::Level level : {simd::Level::Scalar, simd::Level::Avx2}) {
+        if (const simd::Kernels* k = simd::kernels(level)) {
+            out.push_back(k);
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+TEST(SimdKernels, DispatchFollowsSetActive) {
+    const simd::Level detected = simd::detected();
+    EXPECT_EQ(simd::active(), detected);
+    ASSERT_NE(simd::kernels(simd::Level::Scalar), nullptr);
+
+    EXPECT_TRUE(simd::set_active(simd::Level::Scalar));
+    EXPECT_EQ(simd::active(), simd::Level::Scalar);
+    EXPECT_EQ(&simd::active_kernels(), simd::kernels(simd::Level::Scalar));
+
+    EXPECT_EQ(simd::set_active(simd::Level::Avx2), simd::kernels(simd::Level::Avx2) != nullptr);
+    EXPECT_TRUE(simd::set_active(detected));
+}
+
+TEST(SimdKernels, SumAndCompactMatchScalar) {
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<std::int64_t> qty_dist(-3, 5); // about half the levels empty
+
+    for (std::size_t n = 0; n < 70; ++n) {
+        std::vector<std::int64_t> prices(n);
+        std::vector<std::int64_t> qtys(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            prices[i] = 100'000 + static_cast<std::int64_t>(i);
+            qtys[i]   = qty_dist(rng);
+        }
+        if (n > 8) {
+            qtys[3] = std::int64_t{1} << 62; // large values wrap the same way
+            qtys[4] = std::int64_t{1} << 62;
+        }
+
+        std::vector<std::int64_t> want_p = prices;
+        std::vector<std::int64_t> want_q = qtys;
+        const simd::Kernels&      ref    = *simd::kernels(simd::Level::Scalar);
+        const std::int64_t        sum    = ref.sum_qty(qtys.data(), n);
+        const std::size_t         kept   = ref.compact_levels(want_p.data(), want_q.data(), n);
+
+        for (const simd::Kernels* k : available()) {
+            EXPECT_EQ(k->sum_qty(qtys.data(), n), sum) << "n=" << n;
+
+            std::vector<std::int64_t> p = prices;
+            std::vector<std::int64_t> q = qtys;
+            ASSERT_EQ(k->compact_levels(p.data(), q.data(), n), kept) << "n=" << n;
+            for (std::size_t i = 0; i < kept; ++i) {
+                EXPECT_EQ(p[i], want_p[i]) << "n=" << n << " i=" << i;
+                EXPECT_EQ(q[i], want_q[i]) << "n=" << n << " i=" << i;
+                EXPECT_GT(q[i], 0);
+            }
+        }
+    }
+}
+
+TEST(SimdKernels, ParseDecimalMatchesParseFixedPoint) {
+    const char* const cases[] = {
+        "16493.50", "16493.5", "42", "0.000001", "16493.55", "16493.549", "-0.25", "0",
+        ".5", "5.", ".", "-", "", "1.2.3", "12a4", "+1", " 1", "-12.999",
+        "999999999999999", "9999999999999999", "99999999999999999", "1234567890.12345",
+        "0.0000000000000005", "9223372036854775807", "9223372036854775808", "00000000000001.5",
+        "1e5", "1\xff", "\x80", "3.14159265358979",
+    };
+    for (const char* c : cases) {
+        for (unsigned decimals = 0; decimals <= 19; ++decimals) {
+            std::int64_t want = 11;
+            const bool   ok   = parse_fixed_point(c, decimals, want);
+            for (const simd::Kernels* k : available()) {
+                std::int64_t got = 11;
+                EXPECT_EQ(k->parse_decimal(c, decimals, got), ok) << '"' << c << "\" d=" << decimals;
+                EXPECT_EQ(got, want) << '"' << c << "\" d=" << decimals;
+            }
+        }
+    }
+
+    // Random fields, mostly well formed.
+    std::mt19937                       rng(11);
+    std::uniform_int_distribution<int> len_dist(0, 20);
+    std::uniform_int_distribution<int> char_dist(0, 40);
+    for (int iter = 0; iter < 50'000; ++iter) {
+        std::string s;
+        const int   len = len_dist(rng);
+        for (int i = 0; i < len; ++i) {
+            const int c = char_dist(rng);
+            s += c < 36 ? static_cast<char>('0' + c % 10) : c < 39 ? '.' : c < 40 ? '-' : 'x';
+        }
+        const unsigned decimals = static_cast<unsigned>(iter % 12);
+        std::int64_t   want     = 0;
+        const bool     ok       = parse_fixed_point(s, decimals, want);
+        for (const simd::Kernels* k : available()) {
+            std::int64_t got = 0;
+            ASSERT_EQ(k->parse_decimal(s, decimals, got), ok) << '"' << s << "\" d=" << decimals;
+            if (ok) {
+                ASSERT_EQ(got, want) << '"' << s << "\" d=" << decimals;
+            }
+        }
+    }
+}
+
+TEST(SimdKernels, ParseDecimalAtPageEnd) {
+    // A field ending right before an unmapped page must not be read past.
+    const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    void*      mem  = ::mmap(nullptr, 2 * page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(mem, MAP_FAILED);
+    char* base = static_cast<char*>(mem);
+    ASSERT_EQ(::mprotect(base + page, page, PROT_NONE), 0);
+
+    const std::string field = "16493.5";
+    char*             at    = base + page - field.size();
+    std::memcpy(at, field.data(), field.size());
+
+    for (const simd::Kernels* k : available()) {
+        std::int64_t v = 0;
+        EXPECT_TRUE(k->parse_decimal(std::string_view(at, field.size()), 2, v));
+        EXPECT_EQ(v, 1649350);
+    }
+    ::munmap(mem, 2 * page);
+}
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include "utils/spsc_queue.hpp"
+#include "utils/spsc_queue_v2.hpp"
+#include "utils/wait_strategy.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using utils::SpscQueue;
+using utils::SpscQueueV2;
+
+TEST(SpscQueueV2, CapacityIsRoundedUpToPowerOfTwo) {
+    EXPECT_EQ(SpscQueueV2<int>(1).capacity(), 2u);
+    EXPECT_EQ(SpscQueueV2<int>(64).capacity(), 64u);
+    EXPECT_EQ(SpscQueueV2<int>(1000).capacity(), 1024u);
+}
+
+TEST(SpscQueueV2, IndexBlocksLiveOnSeparateCacheLines) {
+    EXPECT_GE(alignof(SpscQueueV2<int>), utils::kCacheLineSize);
+    EXPECT_GE(sizeof(SpscQueueV2<int>), 3 * utils::kCacheLineSize);
+}
+
+TEST(SpscQueueV2, EveryCellIsUsable) {
+    SpscQueueV2<int> q(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(q.push(i));
+    }
+    EXPECT_TRUE(q.full());
+    EXPECT_FALSE(q.push(99));
+    EXPECT_EQ(q.size(), 4u);
+
+    int v = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(q.pop(v));
+        EXPECT_EQ(v, i);
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.pop(v));
+}
+
+TEST(SpscQueueV2, BulkTransfersWrapAroundAndStopAtBounds) {
+    SpscQueueV2<int> q(8);
+    std::array<int, 16> in{};
+    std::iota(in.begin(), in.end(), 0);
+    std::array<int, 16> out{};
+
+    // Move the indices off zero so the next bulk push wraps.
+    ASSERT_EQ(q.push_bulk(in.data(), 5), 5u);
+    ASSERT_EQ(q.pop_bulk(out.data(), 5), 5u);
+
+    // Only capacity() items fit; the rest is reported as not pushed.
+    EXPECT_EQ(q.push_bulk(in.data(), in.size()), 8u);
+    EXPECT_EQ(q.push_bulk(in.data(), 1), 0u);
+
+    EXPECT_EQ(q.pop_bulk(out.data(), 3), 3u);
+    EXPECT_EQ(q.pop_bulk(out.data() + 3, out.size()), 5u);
+    EXPECT_EQ(q.pop_bulk(out.data(), out.size()), 0u);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_EQ(out[static_cast<std::size_t>(i)], i);
+    }
+}
+
+// One producer, one consumer, mixed single / bulk calls: every value arrives
+// exactly once and in order. Yield on full / empty so the test stays fast on
+// a single core.
+template <typename Queue>
+void check_two_thread_order(Queue& q, std::uint64_t n) {
+    std::thread producer([&] {
+        std::array<std::uint64_t, 7> chunk{};
+        std::uint64_t next = 0;
+        while (next < n) {
+            if constexpr (requires { q.push_bulk(chunk.data(), chunk.size()); }) {
+                if (next % 3 == 0) {
+                    std::size_t k = 0;
+                    while (k < chunk.size() && next + k < n) {
+                        chunk[k] = next + k;
+                        ++k;
+                    }
+                    const std::size_t pushed = q.push_bulk(chunk.data(), k);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                    next += pushed;
+                    continue;
+                }
+            }
+            if (q.push(next)) {
+                ++next;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::vector<std::uint64_t> received;
+    received.reserve(n);
+    std::array<std::uint64_t, 5> buf{};
+    while (received.size() < n) {
+        if constexpr (requires { q.pop_bulk(buf.data(), buf.size()); }) {
+            const std::size_t k = q.pop_bulk(buf.data(), buf.size());
+            if (k == 0) {
+                std::this_thread::yield();
+            }
+            received.insert(received.end(), buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(k));
+        } else {
+            std::uint64_t v = 0;
+            if (q.pop(v)) {
+                received.push_back(v);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+    producer.join();
+
+    for (std::uint64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(received[static_cast<std::size_t>(i)], i);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueueV2, TwoThreadsPreserveOrder) {
+    SpscQueueV2<std::uint64_t> q(64);
+    check_two_thread_order(q, 200000);
+}
+
+TEST(SpscQueue, TwoThreadsPreserveOrder) {
+    SpscQueue<std::uint64_t> q(64);
+    check_two_thread_order(q, 200000);
+}
+
+// Park mode: a consumer that has gone to sleep on an empty queue must wake
+// for every item, i.e. notify() racing with park() is never lost.
+TEST(WaitStrategy, ParkedConsumerSeesEveryItem) {
+    SpscQueueV2<std::uint64_t> q(8);
+    utils::WakeSignal          signal;
+    constexpr std::uint64_t    kItems = 20000;
+
+    std::thread producer([&] {
+        for (std::uint64_t i = 0; i < kItems; ++i) {
+            while (!q.push(i)) {
+                std::this_thread::yield();
+            }
+            signal.notify();
+        }
+    });
+
+    utils::Waiter waiter(utils::WaitMode::Park, &signal, /*spin_limit=*/0);
+    std::uint64_t expected = 0;
+    while (expected < kItems) {
+        std::uint64_t v = 0;
+        if (q.pop(v)) {
+            ASSERT_EQ(v, expected);
+            ++expected;
+            waiter.reset();
+            continue;
+        }
+        waiter.idle([&] { return !q.empty(); });
+    }
+    producer.join();
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(WaitStrategy, ParsesModeNames) {
+    utils::WaitMode mode = utils::WaitMode::Yield;
+    EXPECT_TRUE(utils::parse_wait_mode("park", mode));
+    EXPECT_EQ(mode, utils::WaitMode::Park);
+    EXPECT_STREQ(utils::to_string(mode), "park");
+    EXPECT_FALSE(utils::parse_wait_mode("sleep", mode));
+    EXPECT_EQ(mode, utils::WaitMode::Park);
+}
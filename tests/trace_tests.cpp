@@ -0,0 +1,82 @@
+// The tracing layer is compiled in by TRADING_TRACE; force it on here so the
+// test covers it whatever ENABLE_TRACING the tree is configured with.
+#undef TRADING_TRACE
+#define TRADING_TRACE 1
+
+#include <gtest/gtest.h>
+
+#include "utils/trace.hpp"
+
+#include <cstddef>
+#include <string_view>
+#include <thread>
+
+namespace trace = utils::trace;
+
+namespace {
+
+const trace::StageSummary* find_stage(const trace::Report& report, std::string_view name) {
+    for (const auto& s : report.stages) {
+        if (s.name == name) {
+            return &s;
+        }
+    }
+    return nullptr;
+}
+
+void traced_work(int n) {
+    for (int i = 0; i < n; ++i) {
+        TRADING_TRACE_SCOPE("test.work");
+    }
+}
+
+} // namespace
+
+TEST(Trace, ScopesAreCountedPerStageAfterFlush) {
+    trace::Registry::instance().reset();
+    traced_work(100);
+    {
+        TRADING_TRACE_SCOPE("test.outer");
+        traced_work(10);
+    }
+    TRADING_TRACE_FLUSH();
+
+    const trace::Report report = trace::Registry::instance().report();
+    const auto* work  = find_stage(report, "test.work");
+    const auto* outer = find_stage(report, "test.outer");
+    ASSERT_NE(work, nullptr);
+    ASSERT_NE(outer, nullptr);
+    EXPECT_EQ(work->count, 110u);
+    EXPECT_EQ(outer->count, 1u);
+    EXPECT_LE(work->p50_ns, work->max_ns);
+    EXPECT_EQ(report.dropped, 0u);
+}
+
+TEST(Trace, SameNameSharesOneStage) {
+    EXPECT_EQ(trace::stage("test.shared"), trace::stage("test.shared"));
+    EXPECT_NE(trace::stage("test.shared"), trace::stage("test.other"));
+}
+
+TEST(Trace, RecordsOfFinishedThreadsAreFlushed) {
+    trace::Registry::instance().reset();
+    std::thread t([] { traced_work(50); });
+    t.join();
+
+    const trace::Report report = trace::Registry::instance().report();
+    const auto* work = find_stage(report, "test.work");
+    ASSERT_NE(work, nullptr);
+    EXPECT_EQ(work->count, 50u);
+}
+
+TEST(Trace, FullRingDropsAndCounts) {
+    trace::Registry::instance().reset();
+    const std::size_t extra = 10;
+    std::thread t([&] { traced_work(static_cast<int>(trace::kRingCapacity + extra)); });
+    t.join();
+
+    const trace::Report report = trace::Registry::instance().report();
+    const auto* work = find_stage(report, "test.work");
+    ASSERT_NE(work, nullptr);
+    EXPECT_EQ(work->count, trace::kRingCapacity);
+    EXPECT_EQ(report.dropped, extra);
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include "utils/tsc_timer.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+TEST(TscTimer, FrequencyIsDetected) {
+    const bench::TscInfo& info = bench::tsc_info();
+    EXPECT_GT(info.ghz, 0.1);
+    EXPECT_LT(info.ghz, 20.0);
+    EXPECT_NEAR(info.ghz * info.ns_per_tick, 1.0, 1e-9);
+    EXPECT_DOUBLE_EQ(bench::detail::tsc_ns_per_tick(), info.ns_per_tick);
+}
+
+TEST(TscTimer, CalibrationAgreesWithDetectedFrequency) {
+    const double calibrated = bench::detail::tsc_ghz_calibrated(3, std::chrono::milliseconds(10));
+    EXPECT_NEAR(calibrated, bench::tsc_info().ghz, bench::tsc_info().ghz * 0.05);
+}
+
+TEST(TscTimer, FencedReadsAreOrderedAndMeasureSleep) {
+    if (!bench::tsc_info().has_rdtscp) {
+        GTEST_SKIP() << "no rdtscp";
+    }
+    const auto t0 = bench::TscTimer::start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    const auto t1 = bench::TscTimer::stop();
+    ASSERT_GT(t1, t0);
+
+    const double ns = bench::TscTimer::to_ns(t0, t1);
+    EXPECT_GE(ns, 4.5e6);
+    EXPECT_LT(ns, 1e9);
+
+    std::uint32_t aux = 0;
+    EXPECT_GE(bench::detail::read_tscp(aux), t1);
+}
@@ -6,6 +6,8 @@ import time
 
 import websockets  # pip install websockets
 
+from shm_ring import ShmRingWriter
+
 WS_URL = "wss://stream.bybit.com/v5/public/spot"  # check Bybit docs if needed
 SYMBOL = "BTCUSDT"
 CHANNEL = f"publicTrade.{SYMBOL}"
@@ -14,7 +16,20 @@ PRICE_SCALE = 100      # price_int = int(price * PRICE_SCALE)
 QTY_SCALE   = 1000     # qty_int   = int(qty * QTY_SCALE)
 
 
+def make_sink():
+    """stdout pipe (default) or `--shm NAME`: utils::ShmRing created by trading_live_feed."""
+    if len(sys.argv) > 2 and sys.argv[1] == "--shm":
+        ring = ShmRingWriter(sys.argv[2])
+        return lambda line: ring.push(line.encode())
+
+    def write(line):
+        sys.stdout.write(line)
+        sys.stdout.flush()
+    return write
+
+
 async def main():
+    sink = make_sink()
     async with websockets.connect(WS_URL) as ws:
         sub_msg = {"op": "subscribe", "args": [CHANNEL]}
         await ws.send(json.dumps(sub_msg))
@@ -51,8 +66,7 @@ async def main():
                 ts_ns = ts_ms * 1_000_000
 
                 line = f"{ts_ns},T,{side_char},{price_int},{qty_int}\n"
-                sys.stdout.write(line)
-                sys.stdout.flush()
+                sink(line)
 
 
 if __name__ == "__main__":
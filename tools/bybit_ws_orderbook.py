@@ -5,6 +5,8 @@ import signal
 
 import websockets  # pip install websockets (в твоём venv уже стоит)
 
+from shm_ring import ShmRingWriter
+
 WS_URL = "wss://stream.bybit.com/v5/public/spot"
 SYMBOL = "BTCUSDT"
 CHANNEL = f"orderbook.50.{SYMBOL}"
@@ -14,11 +16,18 @@ signal.signal(signal.SIGPIPE, signal.SIG_DFL)
 
 
 async def main() -> None:
+    # `--shm NAME`: frames go as they are into utils::ShmRing created by
+    # trading_ws_orderbook_snapshot source=shm:NAME, instead of stdout.
+    ring = ShmRingWriter(sys.argv[2]) if len(sys.argv) > 2 and sys.argv[1] == "--shm" else None
+
     async with websockets.connect(WS_URL) as ws:
         sub_msg = {"op": "subscribe", "args": [CHANNEL]}
         await ws.send(json.dumps(sub_msg))
 
         async for raw in ws:
+            if ring is not None:
+                ring.push(raw.encode() if isinstance(raw, str) else raw)
+                continue
             line = raw.strip() + "\n"
             try:
                 sys.stdout.write(line)
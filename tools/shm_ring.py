@@ -0,0 +1,80 @@
+"""Producer side of utils::ShmRing (include/utils/shm_ring.hpp).
+
+The C++ consumer creates /dev/shm/<name>; this module attaches to it and
+appends length-prefixed records. Layout and protocol are described in
+shm_ring.hpp. Python has no release store: the record is written before the
+write position, which is enough on x86 (TSO), the only target of these tools.
+"""
+import mmap
+import os
+import struct
+import time
+
+MAGIC = b"TRDSHMRG"
+VERSION = 1
+HEADER_SIZE = 192
+WRAP_MARK = 0xFFFFFFFF
+
+_CAPACITY = 16
+_CLOSED = 24
+_WRITE = 64
+_READ = 128
+
+
+class ShmRingWriter:
+    def __init__(self, name: str, wait_s: float = 10.0):
+        path = "/dev/shm/" + name.lstrip("/")
+        self._path = path
+        deadline = time.monotonic() + wait_s
+        while True:  # the consumer may still be starting
+            try:
+                fd = os.open(path, os.O_RDWR)
+                break
+            except FileNotFoundError:
+                if time.monotonic() > deadline:
+                    raise
+                time.sleep(0.05)
+        try:
+            while os.fstat(fd).st_size < HEADER_SIZE:  # created, not sized yet
+                time.sleep(0.01)
+            self._m = mmap.mmap(fd, 0)
+        finally:
+            os.close(fd)
+        while self._m[:8] != MAGIC and time.monotonic() < deadline:
+            time.sleep(0.01)  # header is written magic-last
+
+        version, header_size = struct.unpack_from("<II", self._m, 8)
+        if self._m[:8] != MAGIC or version != VERSION or header_size != HEADER_SIZE:
+            raise RuntimeError(f"ShmRing: not a ring: {name}")
+        (self._cap,) = struct.unpack_from("<Q", self._m, _CAPACITY)
+        (self._pos,) = struct.unpack_from("<Q", self._m, _WRITE)
+
+    def push(self, payload: bytes) -> None:
+        """Append one message, waiting while the ring is full.
+
+        Raises BrokenPipeError once the consumer is gone (ring unlinked),
+        like a write to a closed pipe."""
+        need = (4 + len(payload) + 7) & ~7
+        if need > self._cap // 2:
+            raise ValueError("message larger than half the ring")
+        off = self._pos & (self._cap - 1)
+        tail = self._cap - off
+        room = tail + need if tail < need else need
+        while self._pos + room - struct.unpack_from("<Q", self._m, _READ)[0] > self._cap:
+            if not os.path.exists(self._path):
+                raise BrokenPipeError(self._path)
+            time.sleep(0)  # consumer behind: yield
+
+        pos = self._pos
+        if tail < need:
+            struct.pack_into("<I", self._m, HEADER_SIZE + off, WRAP_MARK)
+            pos += tail
+        rec = HEADER_SIZE + (pos & (self._cap - 1))
+        struct.pack_into("<I", self._m, rec, len(payload))
+        self._m[rec + 4:rec + 4 + len(payload)] = payload
+
+        self._pos = pos + need
+        struct.pack_into("<Q", self._m, _WRITE, self._pos)  # publish
+
+    def close(self) -> None:
+        struct.pack_into("<I", self._m, _CLOSED, 1)